@@ -24,6 +24,7 @@ const (
 	PAM_SelectBroker_FullMethodName             = "/authd.PAM/SelectBroker"
 	PAM_GetAuthenticationModes_FullMethodName   = "/authd.PAM/GetAuthenticationModes"
 	PAM_SelectAuthenticationMode_FullMethodName = "/authd.PAM/SelectAuthenticationMode"
+	PAM_BeginAuthentication_FullMethodName      = "/authd.PAM/BeginAuthentication"
 	PAM_IsAuthenticated_FullMethodName          = "/authd.PAM/IsAuthenticated"
 	PAM_EndSession_FullMethodName               = "/authd.PAM/EndSession"
 	PAM_SetDefaultBrokerForUser_FullMethodName  = "/authd.PAM/SetDefaultBrokerForUser"
@@ -38,6 +39,7 @@ type PAMClient interface {
 	SelectBroker(ctx context.Context, in *SBRequest, opts ...grpc.CallOption) (*SBResponse, error)
 	GetAuthenticationModes(ctx context.Context, in *GAMRequest, opts ...grpc.CallOption) (*GAMResponse, error)
 	SelectAuthenticationMode(ctx context.Context, in *SAMRequest, opts ...grpc.CallOption) (*SAMResponse, error)
+	BeginAuthentication(ctx context.Context, in *BARequest, opts ...grpc.CallOption) (*BAResponse, error)
 	IsAuthenticated(ctx context.Context, in *IARequest, opts ...grpc.CallOption) (*IAResponse, error)
 	EndSession(ctx context.Context, in *ESRequest, opts ...grpc.CallOption) (*Empty, error)
 	SetDefaultBrokerForUser(ctx context.Context, in *SDBFURequest, opts ...grpc.CallOption) (*Empty, error)
@@ -96,6 +98,15 @@ func (c *pAMClient) SelectAuthenticationMode(ctx context.Context, in *SAMRequest
 	return out, nil
 }
 
+func (c *pAMClient) BeginAuthentication(ctx context.Context, in *BARequest, opts ...grpc.CallOption) (*BAResponse, error) {
+	out := new(BAResponse)
+	err := c.cc.Invoke(ctx, PAM_BeginAuthentication_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 func (c *pAMClient) IsAuthenticated(ctx context.Context, in *IARequest, opts ...grpc.CallOption) (*IAResponse, error) {
 	out := new(IAResponse)
 	err := c.cc.Invoke(ctx, PAM_IsAuthenticated_FullMethodName, in, out, opts...)
@@ -132,6 +143,7 @@ type PAMServer interface {
 	SelectBroker(context.Context, *SBRequest) (*SBResponse, error)
 	GetAuthenticationModes(context.Context, *GAMRequest) (*GAMResponse, error)
 	SelectAuthenticationMode(context.Context, *SAMRequest) (*SAMResponse, error)
+	BeginAuthentication(context.Context, *BARequest) (*BAResponse, error)
 	IsAuthenticated(context.Context, *IARequest) (*IAResponse, error)
 	EndSession(context.Context, *ESRequest) (*Empty, error)
 	SetDefaultBrokerForUser(context.Context, *SDBFURequest) (*Empty, error)
@@ -157,6 +169,9 @@ func (UnimplementedPAMServer) GetAuthenticationModes(context.Context, *GAMReques
 func (UnimplementedPAMServer) SelectAuthenticationMode(context.Context, *SAMRequest) (*SAMResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method SelectAuthenticationMode not implemented")
 }
+func (UnimplementedPAMServer) BeginAuthentication(context.Context, *BARequest) (*BAResponse, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method BeginAuthentication not implemented")
+}
 func (UnimplementedPAMServer) IsAuthenticated(context.Context, *IARequest) (*IAResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method IsAuthenticated not implemented")
 }
@@ -269,6 +284,24 @@ func _PAM_SelectAuthenticationMode_Handler(srv interface{}, ctx context.Context,
 	return interceptor(ctx, in, info, handler)
 }
 
+func _PAM_BeginAuthentication_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(BARequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(PAMServer).BeginAuthentication(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: PAM_BeginAuthentication_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(PAMServer).BeginAuthentication(ctx, req.(*BARequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 func _PAM_IsAuthenticated_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(IARequest)
 	if err := dec(in); err != nil {
@@ -350,6 +383,10 @@ var PAM_ServiceDesc = grpc.ServiceDesc{
 			MethodName: "SelectAuthenticationMode",
 			Handler:    _PAM_SelectAuthenticationMode_Handler,
 		},
+		{
+			MethodName: "BeginAuthentication",
+			Handler:    _PAM_BeginAuthentication_Handler,
+		},
 		{
 			MethodName: "IsAuthenticated",
 			Handler:    _PAM_IsAuthenticated_Handler,
@@ -368,14 +405,18 @@ var PAM_ServiceDesc = grpc.ServiceDesc{
 }
 
 const (
-	NSS_GetPasswdByName_FullMethodName  = "/authd.NSS/GetPasswdByName"
-	NSS_GetPasswdByUID_FullMethodName   = "/authd.NSS/GetPasswdByUID"
-	NSS_GetPasswdEntries_FullMethodName = "/authd.NSS/GetPasswdEntries"
-	NSS_GetGroupByName_FullMethodName   = "/authd.NSS/GetGroupByName"
-	NSS_GetGroupByGID_FullMethodName    = "/authd.NSS/GetGroupByGID"
-	NSS_GetGroupEntries_FullMethodName  = "/authd.NSS/GetGroupEntries"
-	NSS_GetShadowByName_FullMethodName  = "/authd.NSS/GetShadowByName"
-	NSS_GetShadowEntries_FullMethodName = "/authd.NSS/GetShadowEntries"
+	NSS_GetPasswdByName_FullMethodName     = "/authd.NSS/GetPasswdByName"
+	NSS_GetPasswdByUID_FullMethodName      = "/authd.NSS/GetPasswdByUID"
+	NSS_GetPasswdEntries_FullMethodName    = "/authd.NSS/GetPasswdEntries"
+	NSS_StreamPasswdEntries_FullMethodName = "/authd.NSS/StreamPasswdEntries"
+	NSS_GetGroupByName_FullMethodName      = "/authd.NSS/GetGroupByName"
+	NSS_GetGroupByGID_FullMethodName       = "/authd.NSS/GetGroupByGID"
+	NSS_GetGroupEntries_FullMethodName     = "/authd.NSS/GetGroupEntries"
+	NSS_StreamGroupEntries_FullMethodName  = "/authd.NSS/StreamGroupEntries"
+	NSS_GetUserGroups_FullMethodName       = "/authd.NSS/GetUserGroups"
+	NSS_GetShadowByName_FullMethodName     = "/authd.NSS/GetShadowByName"
+	NSS_GetShadowEntries_FullMethodName    = "/authd.NSS/GetShadowEntries"
+	NSS_StreamShadowEntries_FullMethodName = "/authd.NSS/StreamShadowEntries"
 )
 
 // NSSClient is the client API for NSS service.
@@ -385,11 +426,15 @@ type NSSClient interface {
 	GetPasswdByName(ctx context.Context, in *GetByNameRequest, opts ...grpc.CallOption) (*PasswdEntry, error)
 	GetPasswdByUID(ctx context.Context, in *GetByIDRequest, opts ...grpc.CallOption) (*PasswdEntry, error)
 	GetPasswdEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*PasswdEntries, error)
+	StreamPasswdEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (NSS_StreamPasswdEntriesClient, error)
 	GetGroupByName(ctx context.Context, in *GetByNameRequest, opts ...grpc.CallOption) (*GroupEntry, error)
 	GetGroupByGID(ctx context.Context, in *GetByIDRequest, opts ...grpc.CallOption) (*GroupEntry, error)
 	GetGroupEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*GroupEntries, error)
+	StreamGroupEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (NSS_StreamGroupEntriesClient, error)
+	GetUserGroups(ctx context.Context, in *GetByNameRequest, opts ...grpc.CallOption) (*UserGroups, error)
 	GetShadowByName(ctx context.Context, in *GetByNameRequest, opts ...grpc.CallOption) (*ShadowEntry, error)
 	GetShadowEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*ShadowEntries, error)
+	StreamShadowEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (NSS_StreamShadowEntriesClient, error)
 }
 
 type nSSClient struct {
@@ -427,6 +472,38 @@ func (c *nSSClient) GetPasswdEntries(ctx context.Context, in *Empty, opts ...grp
 	return out, nil
 }
 
+func (c *nSSClient) StreamPasswdEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (NSS_StreamPasswdEntriesClient, error) {
+	stream, err := c.cc.NewStream(ctx, &NSS_ServiceDesc.Streams[0], NSS_StreamPasswdEntries_FullMethodName, opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &nSSStreamPasswdEntriesClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type NSS_StreamPasswdEntriesClient interface {
+	Recv() (*PasswdEntry, error)
+	grpc.ClientStream
+}
+
+type nSSStreamPasswdEntriesClient struct {
+	grpc.ClientStream
+}
+
+func (x *nSSStreamPasswdEntriesClient) Recv() (*PasswdEntry, error) {
+	m := new(PasswdEntry)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 func (c *nSSClient) GetGroupByName(ctx context.Context, in *GetByNameRequest, opts ...grpc.CallOption) (*GroupEntry, error) {
 	out := new(GroupEntry)
 	err := c.cc.Invoke(ctx, NSS_GetGroupByName_FullMethodName, in, out, opts...)
@@ -454,6 +531,47 @@ func (c *nSSClient) GetGroupEntries(ctx context.Context, in *Empty, opts ...grpc
 	return out, nil
 }
 
+func (c *nSSClient) StreamGroupEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (NSS_StreamGroupEntriesClient, error) {
+	stream, err := c.cc.NewStream(ctx, &NSS_ServiceDesc.Streams[1], NSS_StreamGroupEntries_FullMethodName, opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &nSSStreamGroupEntriesClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type NSS_StreamGroupEntriesClient interface {
+	Recv() (*GroupEntry, error)
+	grpc.ClientStream
+}
+
+type nSSStreamGroupEntriesClient struct {
+	grpc.ClientStream
+}
+
+func (x *nSSStreamGroupEntriesClient) Recv() (*GroupEntry, error) {
+	m := new(GroupEntry)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
+func (c *nSSClient) GetUserGroups(ctx context.Context, in *GetByNameRequest, opts ...grpc.CallOption) (*UserGroups, error) {
+	out := new(UserGroups)
+	err := c.cc.Invoke(ctx, NSS_GetUserGroups_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 func (c *nSSClient) GetShadowByName(ctx context.Context, in *GetByNameRequest, opts ...grpc.CallOption) (*ShadowEntry, error) {
 	out := new(ShadowEntry)
 	err := c.cc.Invoke(ctx, NSS_GetShadowByName_FullMethodName, in, out, opts...)
@@ -472,6 +590,38 @@ func (c *nSSClient) GetShadowEntries(ctx context.Context, in *Empty, opts ...grp
 	return out, nil
 }
 
+func (c *nSSClient) StreamShadowEntries(ctx context.Context, in *Empty, opts ...grpc.CallOption) (NSS_StreamShadowEntriesClient, error) {
+	stream, err := c.cc.NewStream(ctx, &NSS_ServiceDesc.Streams[2], NSS_StreamShadowEntries_FullMethodName, opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &nSSStreamShadowEntriesClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type NSS_StreamShadowEntriesClient interface {
+	Recv() (*ShadowEntry, error)
+	grpc.ClientStream
+}
+
+type nSSStreamShadowEntriesClient struct {
+	grpc.ClientStream
+}
+
+func (x *nSSStreamShadowEntriesClient) Recv() (*ShadowEntry, error) {
+	m := new(ShadowEntry)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 // NSSServer is the server API for NSS service.
 // All implementations must embed UnimplementedNSSServer
 // for forward compatibility
@@ -479,11 +629,15 @@ type NSSServer interface {
 	GetPasswdByName(context.Context, *GetByNameRequest) (*PasswdEntry, error)
 	GetPasswdByUID(context.Context, *GetByIDRequest) (*PasswdEntry, error)
 	GetPasswdEntries(context.Context, *Empty) (*PasswdEntries, error)
+	StreamPasswdEntries(*Empty, NSS_StreamPasswdEntriesServer) error
 	GetGroupByName(context.Context, *GetByNameRequest) (*GroupEntry, error)
 	GetGroupByGID(context.Context, *GetByIDRequest) (*GroupEntry, error)
 	GetGroupEntries(context.Context, *Empty) (*GroupEntries, error)
+	StreamGroupEntries(*Empty, NSS_StreamGroupEntriesServer) error
+	GetUserGroups(context.Context, *GetByNameRequest) (*UserGroups, error)
 	GetShadowByName(context.Context, *GetByNameRequest) (*ShadowEntry, error)
 	GetShadowEntries(context.Context, *Empty) (*ShadowEntries, error)
+	StreamShadowEntries(*Empty, NSS_StreamShadowEntriesServer) error
 	mustEmbedUnimplementedNSSServer()
 }
 
@@ -500,6 +654,9 @@ func (UnimplementedNSSServer) GetPasswdByUID(context.Context, *GetByIDRequest) (
 func (UnimplementedNSSServer) GetPasswdEntries(context.Context, *Empty) (*PasswdEntries, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetPasswdEntries not implemented")
 }
+func (UnimplementedNSSServer) StreamPasswdEntries(*Empty, NSS_StreamPasswdEntriesServer) error {
+	return status.Errorf(codes.Unimplemented, "method StreamPasswdEntries not implemented")
+}
 func (UnimplementedNSSServer) GetGroupByName(context.Context, *GetByNameRequest) (*GroupEntry, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetGroupByName not implemented")
 }
@@ -509,12 +666,21 @@ func (UnimplementedNSSServer) GetGroupByGID(context.Context, *GetByIDRequest) (*
 func (UnimplementedNSSServer) GetGroupEntries(context.Context, *Empty) (*GroupEntries, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetGroupEntries not implemented")
 }
+func (UnimplementedNSSServer) StreamGroupEntries(*Empty, NSS_StreamGroupEntriesServer) error {
+	return status.Errorf(codes.Unimplemented, "method StreamGroupEntries not implemented")
+}
+func (UnimplementedNSSServer) GetUserGroups(context.Context, *GetByNameRequest) (*UserGroups, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method GetUserGroups not implemented")
+}
 func (UnimplementedNSSServer) GetShadowByName(context.Context, *GetByNameRequest) (*ShadowEntry, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetShadowByName not implemented")
 }
 func (UnimplementedNSSServer) GetShadowEntries(context.Context, *Empty) (*ShadowEntries, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method GetShadowEntries not implemented")
 }
+func (UnimplementedNSSServer) StreamShadowEntries(*Empty, NSS_StreamShadowEntriesServer) error {
+	return status.Errorf(codes.Unimplemented, "method StreamShadowEntries not implemented")
+}
 func (UnimplementedNSSServer) mustEmbedUnimplementedNSSServer() {}
 
 // UnsafeNSSServer may be embedded to opt out of forward compatibility for this service.
@@ -582,6 +748,27 @@ func _NSS_GetPasswdEntries_Handler(srv interface{}, ctx context.Context, dec fun
 	return interceptor(ctx, in, info, handler)
 }
 
+func _NSS_StreamPasswdEntries_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(Empty)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(NSSServer).StreamPasswdEntries(m, &nSSStreamPasswdEntriesServer{stream})
+}
+
+type NSS_StreamPasswdEntriesServer interface {
+	Send(*PasswdEntry) error
+	grpc.ServerStream
+}
+
+type nSSStreamPasswdEntriesServer struct {
+	grpc.ServerStream
+}
+
+func (x *nSSStreamPasswdEntriesServer) Send(m *PasswdEntry) error {
+	return x.ServerStream.SendMsg(m)
+}
+
 func _NSS_GetGroupByName_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(GetByNameRequest)
 	if err := dec(in); err != nil {
@@ -636,6 +823,45 @@ func _NSS_GetGroupEntries_Handler(srv interface{}, ctx context.Context, dec func
 	return interceptor(ctx, in, info, handler)
 }
 
+func _NSS_StreamGroupEntries_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(Empty)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(NSSServer).StreamGroupEntries(m, &nSSStreamGroupEntriesServer{stream})
+}
+
+type NSS_StreamGroupEntriesServer interface {
+	Send(*GroupEntry) error
+	grpc.ServerStream
+}
+
+type nSSStreamGroupEntriesServer struct {
+	grpc.ServerStream
+}
+
+func (x *nSSStreamGroupEntriesServer) Send(m *GroupEntry) error {
+	return x.ServerStream.SendMsg(m)
+}
+
+func _NSS_GetUserGroups_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(GetByNameRequest)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(NSSServer).GetUserGroups(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: NSS_GetUserGroups_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(NSSServer).GetUserGroups(ctx, req.(*GetByNameRequest))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 func _NSS_GetShadowByName_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(GetByNameRequest)
 	if err := dec(in); err != nil {
@@ -672,6 +898,27 @@ func _NSS_GetShadowEntries_Handler(srv interface{}, ctx context.Context, dec fun
 	return interceptor(ctx, in, info, handler)
 }
 
+func _NSS_StreamShadowEntries_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(Empty)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(NSSServer).StreamShadowEntries(m, &nSSStreamShadowEntriesServer{stream})
+}
+
+type NSS_StreamShadowEntriesServer interface {
+	Send(*ShadowEntry) error
+	grpc.ServerStream
+}
+
+type nSSStreamShadowEntriesServer struct {
+	grpc.ServerStream
+}
+
+func (x *nSSStreamShadowEntriesServer) Send(m *ShadowEntry) error {
+	return x.ServerStream.SendMsg(m)
+}
+
 // NSS_ServiceDesc is the grpc.ServiceDesc for NSS service.
 // It's only intended for direct use with grpc.RegisterService,
 // and not to be introspected or modified (even as a copy)
@@ -703,6 +950,10 @@ var NSS_ServiceDesc = grpc.ServiceDesc{
 			MethodName: "GetGroupEntries",
 			Handler:    _NSS_GetGroupEntries_Handler,
 		},
+		{
+			MethodName: "GetUserGroups",
+			Handler:    _NSS_GetUserGroups_Handler,
+		},
 		{
 			MethodName: "GetShadowByName",
 			Handler:    _NSS_GetShadowByName_Handler,
@@ -712,6 +963,112 @@ var NSS_ServiceDesc = grpc.ServiceDesc{
 			Handler:    _NSS_GetShadowEntries_Handler,
 		},
 	},
+	Streams: []grpc.StreamDesc{
+		{
+			StreamName:    "StreamPasswdEntries",
+			Handler:       _NSS_StreamPasswdEntries_Handler,
+			ServerStreams: true,
+		},
+		{
+			StreamName:    "StreamGroupEntries",
+			Handler:       _NSS_StreamGroupEntries_Handler,
+			ServerStreams: true,
+		},
+		{
+			StreamName:    "StreamShadowEntries",
+			Handler:       _NSS_StreamShadowEntries_Handler,
+			ServerStreams: true,
+		},
+	},
+	Metadata: "authd.proto",
+}
+
+const (
+	Debug_GetLatencies_FullMethodName = "/authd.Debug/GetLatencies"
+)
+
+// DebugClient is the client API for Debug service.
+//
+// For semantics around ctx use and closing/ending streaming RPCs, please refer to https://pkg.go.dev/google.golang.org/grpc/?tab=doc#ClientConn.NewStream.
+type DebugClient interface {
+	GetLatencies(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*Latencies, error)
+}
+
+type debugClient struct {
+	cc grpc.ClientConnInterface
+}
+
+func NewDebugClient(cc grpc.ClientConnInterface) DebugClient {
+	return &debugClient{cc}
+}
+
+func (c *debugClient) GetLatencies(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*Latencies, error) {
+	out := new(Latencies)
+	err := c.cc.Invoke(ctx, Debug_GetLatencies_FullMethodName, in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
+// DebugServer is the server API for Debug service.
+// All implementations must embed UnimplementedDebugServer
+// for forward compatibility
+type DebugServer interface {
+	GetLatencies(context.Context, *Empty) (*Latencies, error)
+	mustEmbedUnimplementedDebugServer()
+}
+
+// UnimplementedDebugServer must be embedded to have forward compatible implementations.
+type UnimplementedDebugServer struct {
+}
+
+func (UnimplementedDebugServer) GetLatencies(context.Context, *Empty) (*Latencies, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method GetLatencies not implemented")
+}
+func (UnimplementedDebugServer) mustEmbedUnimplementedDebugServer() {}
+
+// UnsafeDebugServer may be embedded to opt out of forward compatibility for this service.
+// Use of this interface is not recommended, as added methods to DebugServer will
+// result in compilation errors.
+type UnsafeDebugServer interface {
+	mustEmbedUnimplementedDebugServer()
+}
+
+func RegisterDebugServer(s grpc.ServiceRegistrar, srv DebugServer) {
+	s.RegisterService(&Debug_ServiceDesc, srv)
+}
+
+func _Debug_GetLatencies_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(Empty)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(DebugServer).GetLatencies(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: Debug_GetLatencies_FullMethodName,
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(DebugServer).GetLatencies(ctx, req.(*Empty))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
+// Debug_ServiceDesc is the grpc.ServiceDesc for Debug service.
+// It's only intended for direct use with grpc.RegisterService,
+// and not to be introspected or modified (even as a copy)
+var Debug_ServiceDesc = grpc.ServiceDesc{
+	ServiceName: "authd.Debug",
+	HandlerType: (*DebugServer)(nil),
+	Methods: []grpc.MethodDesc{
+		{
+			MethodName: "GetLatencies",
+			Handler:    _Debug_GetLatencies_Handler,
+		},
+	},
 	Streams:  []grpc.StreamDesc{},
 	Metadata: "authd.proto",
 }
@@ -34,6 +34,7 @@ type systemPaths struct {
 	BrokersConf string
 	Cache       string
 	Socket      string
+	NSSSnapshot string
 }
 
 // daemonConfig defines configuration parameters of the daemon.
@@ -62,6 +63,7 @@ func New() *App {
 					BrokersConf: consts.DefaultBrokersConfPath,
 					Cache:       consts.DefaultCacheDir,
 					Socket:      "",
+					NSSSnapshot: consts.DefaultNSSSnapshotPath,
 				},
 			}
 
@@ -107,7 +109,7 @@ func (a *App) serve(config daemonConfig) error {
 		return fmt.Errorf("error initializing cache directory at %q: %v", cacheDir, err)
 	}
 
-	m, err := services.NewManager(ctx, cacheDir, config.Paths.BrokersConf, config.Brokers)
+	m, err := services.NewManager(ctx, cacheDir, config.Paths.NSSSnapshot, config.Paths.BrokersConf, config.Brokers)
 	if err != nil {
 		close(a.ready)
 		return err
@@ -322,6 +322,7 @@ func TestNoConfigSetDefaults(t *testing.T) {
 	require.Equal(t, consts.DefaultBrokersConfPath, a.Config().Paths.BrokersConf, "Default brokers configuration path")
 	require.Equal(t, consts.DefaultCacheDir, a.Config().Paths.Cache, "Default cache directory")
 	require.Equal(t, "", a.Config().Paths.Socket, "No socket address as default")
+	require.Equal(t, consts.DefaultNSSSnapshotPath, a.Config().Paths.NSSSnapshot, "Default NSS snapshot path")
 }
 
 func TestBadConfigReturnsError(t *testing.T) {
@@ -47,6 +47,9 @@ func GenerateTestConfig(t *testing.T, origConf *daemonConfig) string {
 	if conf.Paths.Socket == "" {
 		conf.Paths.Socket = filepath.Join(t.TempDir(), "authd.socket")
 	}
+	if conf.Paths.NSSSnapshot == "" {
+		conf.Paths.NSSSnapshot = filepath.Join(t.TempDir(), "nss.snapshot")
+	}
 	d, err := yaml.Marshal(conf)
 	require.NoError(t, err, "Setup: could not marshal configuration for tests")
 
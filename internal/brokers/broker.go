@@ -9,10 +9,12 @@ import (
 	"path/filepath"
 	"strings"
 	"sync"
+	"time"
 
 	"github.com/godbus/dbus/v5"
 	"github.com/ubuntu/authd/internal/brokers/responses"
 	"github.com/ubuntu/authd/internal/log"
+	"github.com/ubuntu/authd/internal/metrics"
 	"github.com/ubuntu/authd/internal/users"
 	"github.com/ubuntu/decorate"
 	"golang.org/x/exp/slices"
@@ -20,6 +22,13 @@ import (
 
 const (
 	localBrokerName = "local"
+
+	// maxCachedValidators is the maximum number of distinct sets of supported UI layouts for which the layout
+	// validators are kept compiled.
+	maxCachedValidators = 32
+
+	// cancelGracePeriod is the time given to a broker to answer an IsAuthenticated call once it was cancelled.
+	cancelGracePeriod = 5 * time.Second
 )
 
 type brokerer interface {
@@ -38,6 +47,9 @@ type Broker struct {
 	BrandIconPath      string
 	layoutValidators   map[string]map[string]layoutValidator
 	layoutValidatorsMu *sync.Mutex
+	// compiledValidators are the layout validators generated for each set of supported UI layouts, which clients
+	// usually send identically for all their sessions. It's protected by layoutValidatorsMu.
+	compiledValidators map[string]map[string]layoutValidator
 	brokerer           brokerer
 }
 
@@ -78,12 +90,15 @@ func newBroker(ctx context.Context, name, configFile string, bus *dbus.Conn) (b
 		brokerer:           broker,
 		layoutValidators:   make(map[string]map[string]layoutValidator),
 		layoutValidatorsMu: &sync.Mutex{},
+		compiledValidators: make(map[string]map[string]layoutValidator),
 	}, nil
 }
 
 // newSession calls the broker corresponding method, expanding sessionID with the broker ID prefix.
 func (b Broker) newSession(ctx context.Context, username, lang string) (sessionID, encryptionKey string, err error) {
+	start := time.Now()
 	sessionID, encryptionKey, err = b.brokerer.NewSession(ctx, username, lang)
+	b.observeCall("NewSession", start)
 	if err != nil {
 		return "", "", err
 	}
@@ -100,10 +115,12 @@ func (b *Broker) GetAuthenticationModes(ctx context.Context, sessionID string, s
 	sessionID = b.parseSessionID(sessionID)
 
 	b.layoutValidatorsMu.Lock()
-	b.layoutValidators[sessionID] = generateValidators(ctx, sessionID, supportedUILayouts)
+	b.layoutValidators[sessionID] = b.validatorsFor(ctx, sessionID, supportedUILayouts)
 	b.layoutValidatorsMu.Unlock()
 
+	start := time.Now()
 	authenticationModes, err = b.brokerer.GetAuthenticationModes(ctx, sessionID, supportedUILayouts)
+	b.observeCall("GetAuthenticationModes", start)
 	if err != nil {
 		return nil, err
 	}
@@ -122,7 +139,9 @@ func (b *Broker) GetAuthenticationModes(ctx context.Context, sessionID string, s
 // SelectAuthenticationMode calls the broker corresponding method, stripping broker ID prefix from sessionID.
 func (b Broker) SelectAuthenticationMode(ctx context.Context, sessionID, authenticationModeName string) (uiLayoutInfo map[string]string, err error) {
 	sessionID = b.parseSessionID(sessionID)
+	start := time.Now()
 	uiLayoutInfo, err = b.brokerer.SelectAuthenticationMode(ctx, sessionID, authenticationModeName)
+	b.observeCall("SelectAuthenticationMode", start)
 	if err != nil {
 		return nil, err
 	}
@@ -134,21 +153,38 @@ func (b Broker) IsAuthenticated(ctx context.Context, sessionID, authenticationDa
 	sessionID = b.parseSessionID(sessionID)
 
 	// monitor ctx in goroutine to call cancel
-	done := make(chan struct{})
+	type result struct {
+		access, data string
+		err          error
+	}
+	// The call outlives ctx for the grace period given to the broker to answer once cancelled, and is abandoned when
+	// returning, so that it can't be left waiting for a broker which never answers.
+	callCtx, cancelCall := context.WithCancel(context.WithoutCancel(ctx))
+	defer cancelCall()
+	done := make(chan result, 1)
 	go func() {
-		access, data, err = b.brokerer.IsAuthenticated(ctx, sessionID, authenticationData)
-		close(done)
+		defer b.observeCall("IsAuthenticated", time.Now())
+		access, data, err := b.brokerer.IsAuthenticated(callCtx, sessionID, authenticationData)
+		done <- result{access: access, data: data, err: err}
 	}()
 
+	var r result
 	select {
-	case <-done:
-		if err != nil {
-			return "", "", err
-		}
+	case r = <-done:
 	case <-ctx.Done():
-		b.cancelIsAuthenticated(ctx, sessionID)
-		<-done
+		// Wait for the broker to acknowledge the cancellation, but don't keep the caller waiting for a broker
+		// which ignores it, or doesn't even answer the cancellation request.
+		go b.cancelIsAuthenticated(ctx, sessionID)
+		select {
+		case r = <-done:
+		case <-time.After(cancelGracePeriod):
+			return "", "", fmt.Errorf("broker did not acknowledge cancellation of session %q: %v", sessionID, ctx.Err())
+		}
 	}
+	if r.err != nil {
+		return "", "", r.err
+	}
+	access, data = r.access, r.data
 
 	// Validate access authentication.
 	if !slices.Contains(responses.AuthReplies, access) {
@@ -194,7 +230,17 @@ func (b Broker) IsAuthenticated(ctx context.Context, sessionID, authenticationDa
 // endSession calls the broker corresponding method, stripping broker ID prefix from sessionID.
 func (b Broker) endSession(ctx context.Context, sessionID string) (err error) {
 	sessionID = b.parseSessionID(sessionID)
-	return b.brokerer.EndSession(ctx, sessionID)
+	start := time.Now()
+	err = b.brokerer.EndSession(ctx, sessionID)
+	b.observeCall("EndSession", start)
+	if err != nil {
+		return err
+	}
+
+	b.layoutValidatorsMu.Lock()
+	delete(b.layoutValidators, sessionID)
+	b.layoutValidatorsMu.Unlock()
+	return nil
 }
 
 // cancelIsAuthenticated calls the broker corresponding method.
@@ -202,9 +248,41 @@ func (b Broker) endSession(ctx context.Context, sessionID string) (err error) {
 //
 // Even though this is a public method, it should only be interacted with through IsAuthenticated and ctx cancellation.
 func (b Broker) cancelIsAuthenticated(ctx context.Context, sessionID string) {
+	// ctx is already cancelled, only its values are kept for the call, which is bounded by the grace period.
+	ctx, cancel := context.WithTimeout(context.WithoutCancel(ctx), cancelGracePeriod)
+	defer cancel()
 	b.brokerer.CancelIsAuthenticated(ctx, sessionID)
 }
 
+// observeCall records the duration of the call to method of the broker, started at start.
+func (b Broker) observeCall(method string, start time.Time) {
+	metrics.Observe("broker/"+b.Name+"/"+method, start)
+}
+
+// validatorsFor returns the layout validators for supportedUILayouts, generating them only if they were not already
+// for the same set of layouts. The returned validators must not be modified.
+//
+// It must be called with layoutValidatorsMu held.
+func (b Broker) validatorsFor(ctx context.Context, sessionID string, supportedUILayouts []map[string]string) map[string]layoutValidator {
+	// Map keys are sorted when marshaling, so the same layouts always give the same key.
+	k, err := json.Marshal(supportedUILayouts)
+	if err != nil {
+		return generateValidators(ctx, sessionID, supportedUILayouts)
+	}
+	key := string(k)
+
+	if validators, exists := b.compiledValidators[key]; exists {
+		return validators
+	}
+
+	validators := generateValidators(ctx, sessionID, supportedUILayouts)
+	if len(b.compiledValidators) >= maxCachedValidators {
+		clear(b.compiledValidators)
+	}
+	b.compiledValidators[key] = validators
+	return validators
+}
+
 // generateValidators generates layout validators based on what is supported by the system.
 //
 // The layout validators are in the form:
@@ -12,6 +12,7 @@ import (
 	"github.com/stretchr/testify/require"
 	"github.com/ubuntu/authd/internal/brokers"
 	"github.com/ubuntu/authd/internal/brokers/responses"
+	"github.com/ubuntu/authd/internal/metrics"
 	"github.com/ubuntu/authd/internal/testutils"
 	brokertestutils "github.com/ubuntu/authd/internal/testutils/broker"
 )
@@ -90,6 +91,60 @@ func TestNewBroker(t *testing.T) {
 	}
 }
 
+func TestNewSessionActivationTimeout(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		activationTimeout time.Duration
+		callerTimeout     time.Duration
+		activated         bool
+
+		wantActivationErr bool
+		wantErr           bool
+	}{
+		"Successfully start a slow session once the broker is activated": {activated: true},
+
+		"Error when the broker is not activated in time":                {wantActivationErr: true, wantErr: true},
+		"Error when the caller gives up before the broker is activated": {activationTimeout: 10 * time.Second, callerTimeout: 100 * time.Millisecond, wantErr: true},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			if tc.activationTimeout == 0 {
+				tc.activationTimeout = 100 * time.Millisecond
+			}
+
+			b := newBrokerForTests(t, "", "")
+			b.SetActivationTimeout(tc.activationTimeout)
+
+			if tc.activated {
+				_, _, err := b.NewSession(context.Background(), prefixID(t, "success"), "some_lang")
+				require.NoError(t, err, "Setup: NewSession should not return an error, but did")
+			}
+
+			ctx := context.Background()
+			if tc.callerTimeout != 0 {
+				var cancel context.CancelFunc
+				ctx, cancel = context.WithTimeout(ctx, tc.callerTimeout)
+				defer cancel()
+			}
+			_, _, err := b.NewSession(ctx, prefixID(t, "NS_slow"), "some_lang")
+			if !tc.wantErr {
+				require.NoError(t, err, "NewSession should not return an error, but did")
+				return
+			}
+			require.Error(t, err, "NewSession should return an error, but did not")
+			if tc.wantActivationErr {
+				require.ErrorContains(t, err, "could not be activated", "NewSession should report the activation timeout, but did not")
+				return
+			}
+			require.NotContains(t, err.Error(), "could not be activated", "NewSession should not report the caller's timeout as an activation timeout")
+		})
+	}
+}
+
 func TestGetAuthenticationModes(t *testing.T) {
 	t.Parallel()
 
@@ -143,6 +198,29 @@ func TestGetAuthenticationModes(t *testing.T) {
 	}
 }
 
+func TestGetAuthenticationModesReusesValidators(t *testing.T) {
+	t.Parallel()
+
+	b := newBrokerForTests(t, "", "")
+
+	layouts := []map[string]string{supportedLayouts["required-entry"], supportedLayouts["optional-entry"]}
+	otherLayouts := []map[string]string{supportedLayouts["required-entry"]}
+
+	ids := map[string]string{
+		"first":     prefixID(t, "first") + brokertestutils.IDSeparator + "success",
+		"second":    prefixID(t, "second") + brokertestutils.IDSeparator + "success",
+		"different": prefixID(t, "different") + brokertestutils.IDSeparator + "success",
+	}
+	for name, l := range map[string][]map[string]string{"first": layouts, "second": layouts, "different": otherLayouts} {
+		_, err := b.GetAuthenticationModes(context.Background(), ids[name], l)
+		require.NoError(t, err, "Setup: GetAuthenticationModes should not return an error, but did")
+	}
+
+	require.True(t, b.HasSameLayoutValidators(ids["first"], ids["second"]), "Sessions with the same supported layouts should share their validators")
+	require.False(t, b.HasSameLayoutValidators(ids["first"], ids["different"]), "Sessions with different supported layouts should not share their validators")
+	require.Equal(t, b.LayoutValidatorsString(ids["first"]), b.LayoutValidatorsString(ids["second"]), "Shared validators should be the same as generated ones")
+}
+
 func TestSelectAuthenticationMode(t *testing.T) {
 	t.Parallel()
 
@@ -287,9 +365,12 @@ func TestCancelIsAuthenticated(t *testing.T) {
 		sessionID string
 
 		wantAnswer string
+		wantErr    bool
 	}{
 		"Successfully cancels IsAuthenticated": {sessionID: "IA_wait", wantAnswer: responses.AuthCancelled},
 		"Call returns denied if not cancelled": {sessionID: "IA_timeout", wantAnswer: responses.AuthDenied},
+
+		"Error when the broker does not answer the cancellation": {sessionID: "IA_cancel_unanswered", wantErr: true},
 	}
 	for name, tc := range tests {
 		tc := tc
@@ -297,25 +378,57 @@ func TestCancelIsAuthenticated(t *testing.T) {
 			t.Parallel()
 
 			var access string
+			var err error
 			ctx, cancel := context.WithCancel(context.Background())
 			done := make(chan struct{})
 			go func() {
-				access, _, _ = b.IsAuthenticated(ctx, prefixID(t, tc.sessionID), "password")
+				access, _, err = b.IsAuthenticated(ctx, prefixID(t, tc.sessionID), "password")
 				close(done)
 			}()
 			defer cancel()
 
-			if tc.sessionID == "IA_wait" {
+			if tc.sessionID != "IA_timeout" {
 				// Give some time for the IsAuthenticated routine to start.
 				time.Sleep(time.Second)
 				cancel()
 			}
-			<-done
+			select {
+			case <-done:
+			case <-time.After(10 * time.Second):
+				t.Fatal("IsAuthenticated should return once cancelled, but did not")
+			}
+			if tc.wantErr {
+				require.Error(t, err, "IsAuthenticated should return an error, but did not")
+				return
+			}
+			require.NoError(t, err, "IsAuthenticated should not return an error, but did")
 			require.Equal(t, tc.wantAnswer, access, "IsAuthenticated should return the expected access, but did not")
 		})
 	}
 }
 
+func TestIsAuthenticatedAbandonsUnansweredCallAfterCancellation(t *testing.T) {
+	t.Parallel()
+
+	// The broker is only used by this test, so that its calls are the only ones recorded under its name.
+	b := newBrokerForTests(t, "", "")
+
+	ctx, cancel := context.WithCancel(context.Background())
+	go func() {
+		// Give some time for the IsAuthenticated routine to start.
+		time.Sleep(time.Second)
+		cancel()
+	}()
+	_, _, err := b.IsAuthenticated(ctx, prefixID(t, "IA_cancel_unanswered"), "password")
+	require.Error(t, err, "IsAuthenticated should return an error, but did not")
+
+	// The call is recorded once the routine calling the broker exits.
+	callExited := func() bool {
+		return metrics.DefaultRegistry.Histogram("broker/"+b.Name+"/IsAuthenticated").Summary("").Count == 1
+	}
+	require.Eventually(t, callExited, 5*time.Second, 10*time.Millisecond, "Call to the broker should be abandoned once IsAuthenticated returned")
+}
+
 func newBrokerForTests(t *testing.T, cfgDir, brokerName string) (b brokers.Broker) {
 	t.Helper()
 
@@ -2,7 +2,10 @@ package brokers
 
 import (
 	"context"
+	"errors"
 	"fmt"
+	"sync/atomic"
+	"time"
 
 	"github.com/godbus/dbus/v5"
 	"github.com/ubuntu/authd/internal/log"
@@ -13,8 +16,16 @@ import (
 // DbusInterface is the expected interface that should be implemented by the brokers.
 const DbusInterface string = "com.ubuntu.authd.Broker"
 
+// defaultActivationTimeout bounds the calls to a broker until one of them went through: the bus activates the broker
+// service on its first call, and a broker slow to start should not hold a login for the whole bus activation timeout.
+const defaultActivationTimeout = 10 * time.Second
+
 type dbusBroker struct {
-	dbusObject dbus.BusObject
+	dbusObject        dbus.BusObject
+	activationTimeout time.Duration
+
+	// activated is true once a call to the broker went through.
+	activated *atomic.Bool
 }
 
 // newDbusBroker returns a dbus broker and broker attributes from its configuration file.
@@ -49,18 +60,32 @@ func newDbusBroker(ctx context.Context, bus *dbus.Conn, configFile string) (b db
 	}
 
 	return dbusBroker{
-		dbusObject: bus.Object(dbusName.String(), dbus.ObjectPath(objectName.String())),
+		dbusObject:        bus.Object(dbusName.String(), dbus.ObjectPath(objectName.String())),
+		activationTimeout: defaultActivationTimeout,
+		activated:         &atomic.Bool{},
 	}, fullNameVal.String(), brandIconVal.String(), nil
 }
 
 // NewSession calls the corresponding method on the broker bus and returns the session ID and encryption key.
+// As the first call of any login, it's bounded by the activation timeout until the broker service is activated.
 func (b dbusBroker) NewSession(ctx context.Context, username, lang string) (sessionID, encryptionKey string, err error) {
 	dbusMethod := DbusInterface + ".NewSession"
 
-	call := b.dbusObject.CallWithContext(ctx, dbusMethod, 0, username, lang)
+	callCtx := ctx
+	if !b.activated.Load() {
+		var cancel context.CancelFunc
+		callCtx, cancel = context.WithTimeout(ctx, b.activationTimeout)
+		defer cancel()
+	}
+	call := b.dbusObject.CallWithContext(callCtx, dbusMethod, 0, username, lang)
 	if err = call.Err; err != nil {
+		// Only the activation timeout is reported as such, not the caller's context being done.
+		if ctx.Err() == nil && errors.Is(callCtx.Err(), context.DeadlineExceeded) && !b.activated.Load() {
+			return "", "", fmt.Errorf("broker service could not be activated in %v: %w", b.activationTimeout, err)
+		}
 		return "", "", err
 	}
+	b.activated.Store(true)
 	if err = call.Store(&sessionID, &encryptionKey); err != nil {
 		return "", "", err
 	}
@@ -99,10 +124,10 @@ func (b dbusBroker) SelectAuthenticationMode(ctx context.Context, sessionID, aut
 }
 
 // IsAuthenticated calls the corresponding method on the broker bus and returns the user information and access.
-func (b dbusBroker) IsAuthenticated(_ context.Context, sessionID, authenticationData string) (access, data string, err error) {
+func (b dbusBroker) IsAuthenticated(ctx context.Context, sessionID, authenticationData string) (access, data string, err error) {
 	dbusMethod := DbusInterface + ".IsAuthenticated"
 
-	call := b.dbusObject.Call(dbusMethod, 0, sessionID, authenticationData)
+	call := b.dbusObject.CallWithContext(ctx, dbusMethod, 0, sessionID, authenticationData)
 	if err = call.Err; err != nil {
 		return "", "", err
 	}
@@ -129,7 +154,7 @@ func (b dbusBroker) EndSession(ctx context.Context, sessionID string) (err error
 func (b dbusBroker) CancelIsAuthenticated(ctx context.Context, sessionID string) {
 	dbusMethod := DbusInterface + ".CancelIsAuthenticated"
 
-	call := b.dbusObject.Call(dbusMethod, 0, sessionID)
+	call := b.dbusObject.CallWithContext(ctx, dbusMethod, 0, sessionID)
 	if call.Err != nil {
 		log.Errorf(ctx, "could not cancel IsAuthenticated call for session %q: %v", sessionID, call.Err)
 	}
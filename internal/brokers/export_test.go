@@ -3,7 +3,9 @@ package brokers
 import (
 	"context"
 	"fmt"
+	"reflect"
 	"sort"
+	"time"
 
 	"github.com/godbus/dbus/v5"
 )
@@ -13,13 +15,25 @@ func NewBroker(ctx context.Context, name, configFile string, bus *dbus.Conn) (Br
 	return newBroker(ctx, name, configFile, bus)
 }
 
+// NewSession exports the private newSession method for testing purposes.
+func (b Broker) NewSession(ctx context.Context, username, lang string) (sessionID, encryptionKey string, err error) {
+	return b.newSession(ctx, username, lang)
+}
+
+// SetActivationTimeout sets the timeout of the calls to the dbus broker until it's activated.
+//
+// This is to be used only in tests.
+func (b *Broker) SetActivationTimeout(timeout time.Duration) {
+	broker := b.brokerer.(dbusBroker)
+	broker.activationTimeout = timeout
+	b.brokerer = broker
+}
+
 // SetBrokerForSession sets the broker for a given session.
 //
 // This is to be used only in tests.
 func (m *Manager) SetBrokerForSession(b *Broker, sessionID string) {
-	m.transactionsToBrokerMu.Lock()
-	m.transactionsToBroker[sessionID] = b
-	m.transactionsToBrokerMu.Unlock()
+	m.transactionsToBroker.set(sessionID, b)
 }
 
 // GenerateLayoutValidators generates the layout validators and assign them to the specified broker.
@@ -29,6 +43,16 @@ func GenerateLayoutValidators(b *Broker, sessionID string, supportedUILayouts []
 	b.layoutValidators[sessionID] = generateValidators(context.Background(), sessionID, supportedUILayouts)
 }
 
+// HasSameLayoutValidators returns true if the layout validators of both sessions are the same compiled ones.
+func (b *Broker) HasSameLayoutValidators(sessionID1, sessionID2 string) bool {
+	b.layoutValidatorsMu.Lock()
+	defer b.layoutValidatorsMu.Unlock()
+
+	v1, exists1 := b.layoutValidators[sessionID1]
+	v2, exists2 := b.layoutValidators[sessionID2]
+	return exists1 && exists2 && reflect.ValueOf(v1).UnsafePointer() == reflect.ValueOf(v2).UnsafePointer()
+}
+
 // LayoutValidatorsString returns a string representation of the layout validators.
 func (b *Broker) LayoutValidatorsString(sessionID string) string {
 	// Gets the map keys and sort them
@@ -6,6 +6,7 @@ import (
 	"context"
 	"errors"
 	"fmt"
+	"hash/fnv"
 	"io/fs"
 	"os"
 	"path/filepath"
@@ -24,12 +25,65 @@ type Manager struct {
 	usersToBroker   map[string]*Broker
 	usersToBrokerMu sync.RWMutex
 
-	transactionsToBroker   map[string]*Broker
-	transactionsToBrokerMu sync.RWMutex
+	transactionsToBroker *sessionTable
 
 	cleanup func()
 }
 
+// sessionShards is the number of shards of the session table, which must be a power of 2.
+const sessionShards = 16
+
+// sessionTable maps the active session IDs to their broker. It's sharded by session ID, so that concurrent logins
+// don't all contend on the same lock.
+type sessionTable struct {
+	shards [sessionShards]sessionShard
+}
+
+type sessionShard struct {
+	mu       sync.RWMutex
+	sessions map[string]*Broker
+}
+
+func newSessionTable() *sessionTable {
+	var t sessionTable
+	for i := range t.shards {
+		t.shards[i].sessions = make(map[string]*Broker)
+	}
+	return &t
+}
+
+// shard returns the shard holding sessionID.
+func (t *sessionTable) shard(sessionID string) *sessionShard {
+	h := fnv.New32a()
+	h.Write([]byte(sessionID))
+	return &t.shards[h.Sum32()&(sessionShards-1)]
+}
+
+// get returns the broker of sessionID, if any.
+func (t *sessionTable) get(sessionID string) (b *Broker, exists bool) {
+	s := t.shard(sessionID)
+	s.mu.RLock()
+	defer s.mu.RUnlock()
+	b, exists = s.sessions[sessionID]
+	return b, exists
+}
+
+// set assigns sessionID to the broker b.
+func (t *sessionTable) set(sessionID string, b *Broker) {
+	s := t.shard(sessionID)
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	s.sessions[sessionID] = b
+}
+
+// delete removes sessionID from the table.
+func (t *sessionTable) delete(sessionID string) {
+	s := t.shard(sessionID)
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	delete(s.sessions, sessionID)
+}
+
 // NewManager creates a new broker manager object.
 func NewManager(ctx context.Context, brokersConfPath string, configuredBrokers []string) (m *Manager, err error) {
 	defer decorate.OnError(&err /*i18n.G(*/, "can't create brokers detection object") //)
@@ -77,7 +131,7 @@ func NewManager(ctx context.Context, brokersConfPath string, configuredBrokers [
 	brokersOrder = append(brokersOrder, b.ID)
 	brokers[b.ID] = &b
 
-	// Load brokers configuration
+	// Load brokers configuration. Their D-Bus services are only activated on their first call, see dbusBroker.
 	for _, n := range configuredBrokers {
 		configFile := filepath.Join(brokersConfPath, n)
 		b, err := newBroker(ctx, n, configFile, bus)
@@ -94,7 +148,7 @@ func NewManager(ctx context.Context, brokersConfPath string, configuredBrokers [
 		brokersOrder: brokersOrder,
 
 		usersToBroker:        make(map[string]*Broker),
-		transactionsToBroker: make(map[string]*Broker),
+		transactionsToBroker: newSessionTable(),
 
 		cleanup: cleanup,
 	}, nil
@@ -130,15 +184,12 @@ func (m *Manager) BrokerForUser(username string) (broker *Broker) {
 
 // BrokerFromSessionID returns broker currently in use for a given transaction sessionID.
 func (m *Manager) BrokerFromSessionID(id string) (broker *Broker, err error) {
-	m.transactionsToBrokerMu.RLock()
-	defer m.transactionsToBrokerMu.RUnlock()
-
 	// no session ID means local broker
 	if id == "" {
 		return m.brokerFromID(localBrokerName)
 	}
 
-	broker, exists := m.transactionsToBroker[id]
+	broker, exists := m.transactionsToBroker.get(id)
 	if !exists {
 		return nil, fmt.Errorf("no broker found for session %q", id)
 	}
@@ -158,9 +209,7 @@ func (m *Manager) NewSession(brokerID, username, lang string) (sessionID string,
 		return "", "", err
 	}
 
-	m.transactionsToBrokerMu.Lock()
-	defer m.transactionsToBrokerMu.Unlock()
-	m.transactionsToBroker[sessionID] = broker
+	m.transactionsToBroker.set(sessionID, broker)
 	return sessionID, encryptionKey, nil
 }
 
@@ -176,9 +225,7 @@ func (m *Manager) EndSession(sessionID string) error {
 		return err
 	}
 
-	m.transactionsToBrokerMu.Lock()
-	delete(m.transactionsToBroker, sessionID)
-	m.transactionsToBrokerMu.Unlock()
+	m.transactionsToBroker.delete(sessionID)
 	return nil
 }
 
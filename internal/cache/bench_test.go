@@ -0,0 +1,291 @@
+package cache_test
+
+import (
+	"flag"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+	"github.com/ubuntu/authd/internal/cache"
+	cachetests "github.com/ubuntu/authd/internal/cache/tests"
+	"github.com/ubuntu/authd/internal/users"
+)
+
+var (
+	benchUsers         = flag.String("bench-users", "10000,100000", "comma separated sizes, in users, of the synthetic caches to benchmark")
+	benchGroups        = flag.Int("bench-groups", 1000, "number of groups of the synthetic caches to benchmark")
+	benchGroupsPerUser = flag.Int("bench-groups-per-user", 20, "number of groups each user of the synthetic caches is member of")
+)
+
+// benchDBs are the synthetic databases generated for the benchmarks, indexed by number of users. They are generated
+// once per test binary execution, as the largest ones take a while to create.
+var benchDBs = struct {
+	sync.Mutex
+	dirs map[int]string
+}{dirs: make(map[int]string)}
+
+func BenchmarkUserByName(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		c := openBenchCache(b, nUsers)
+
+		var next atomic.Int64
+		b.ResetTimer()
+		b.RunParallel(func(pb *testing.PB) {
+			for pb.Next() {
+				name := cachetests.SyntheticUserName(int(next.Add(1)) % nUsers)
+				if _, err := c.UserByName(name); err != nil {
+					b.Errorf("UserByName(%q) should not return an error, but did: %v", name, err)
+					return
+				}
+			}
+		})
+	})
+}
+
+func BenchmarkUserByID(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		c := openBenchCache(b, nUsers)
+
+		var next atomic.Int64
+		b.ResetTimer()
+		b.RunParallel(func(pb *testing.PB) {
+			for pb.Next() {
+				uid := cachetests.SyntheticUID(int(next.Add(1)) % nUsers)
+				if _, err := c.UserByID(uid); err != nil {
+					b.Errorf("UserByID(%d) should not return an error, but did: %v", uid, err)
+					return
+				}
+			}
+		})
+	})
+}
+
+func BenchmarkGroupByID(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		c := openBenchCache(b, nUsers)
+
+		var next atomic.Int64
+		b.ResetTimer()
+		b.RunParallel(func(pb *testing.PB) {
+			for pb.Next() {
+				gid := cachetests.SyntheticGID(int(next.Add(1)) % *benchGroups)
+				if _, err := c.GroupByID(gid); err != nil {
+					b.Errorf("GroupByID(%d) should not return an error, but did: %v", gid, err)
+					return
+				}
+			}
+		})
+	})
+}
+
+func BenchmarkAllUsers(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		c := openBenchCache(b, nUsers)
+
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			all, err := c.AllUsers()
+			require.NoError(b, err, "AllUsers should not return an error, but did")
+			require.Len(b, all, nUsers, "AllUsers should return all the users")
+		}
+	})
+}
+
+func BenchmarkAllGroups(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		c := openBenchCache(b, nUsers)
+
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			all, err := c.AllGroups()
+			require.NoError(b, err, "AllGroups should not return an error, but did")
+			require.Len(b, all, *benchGroups, "AllGroups should return all the groups")
+		}
+	})
+}
+
+func BenchmarkForEachUserView(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		c := openBenchCache(b, nUsers)
+
+		b.ReportAllocs()
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			var n int
+			err := c.ForEachUserView(func(cache.UserPasswdShadow) error {
+				n++
+				return nil
+			})
+			require.NoError(b, err, "ForEachUserView should not return an error, but did")
+			require.Equal(b, nUsers, n, "ForEachUserView should call the callback for all the users")
+		}
+	})
+}
+
+func BenchmarkForEachGroupView(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		c := openBenchCache(b, nUsers)
+
+		b.ReportAllocs()
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			var n int
+			err := c.ForEachGroupView(func(cache.Group) error {
+				n++
+				return nil
+			})
+			require.NoError(b, err, "ForEachGroupView should not return an error, but did")
+			require.Equal(b, *benchGroups, n, "ForEachGroupView should call the callback for all the groups")
+		}
+	})
+}
+
+func BenchmarkUpdateFromUserInfo(b *testing.B) {
+	forEachBenchSize(b, func(b *testing.B, nUsers int) {
+		// Updates modify the database, so work on a copy of it.
+		cacheDir := b.TempDir()
+		copyBenchDB(b, nUsers, cacheDir)
+		c, err := cache.New(cacheDir)
+		require.NoError(b, err, "Setup: could not open synthetic cache")
+		b.Cleanup(func() { c.Close() })
+
+		// Each login changes the gecos of the user, so that the records are always rewritten, and keeps the user in
+		// the same groups, as a broker would on a typical login.
+		var next atomic.Int64
+		b.ResetTimer()
+		b.RunParallel(func(pb *testing.PB) {
+			for pb.Next() {
+				n := int(next.Add(1))
+				u := benchUserInfo(n % nUsers)
+				u.Gecos = fmt.Sprintf("Benchmark user %d, login %d", n%nUsers, n)
+				if err := c.UpdateFromUserInfo(u); err != nil {
+					b.Errorf("UpdateFromUserInfo should not return an error, but did: %v", err)
+					return
+				}
+			}
+		})
+	})
+}
+
+// forEachBenchSize runs fn as a sub-benchmark for each synthetic cache size requested with -bench-users.
+func forEachBenchSize(b *testing.B, fn func(b *testing.B, nUsers int)) {
+	b.Helper()
+
+	for _, s := range strings.Split(*benchUsers, ",") {
+		nUsers, err := strconv.Atoi(strings.TrimSpace(s))
+		require.NoError(b, err, "Setup: invalid number of users in -bench-users")
+
+		b.Run(fmt.Sprintf("users=%d", nUsers), func(b *testing.B) {
+			fn(b, nUsers)
+		})
+	}
+}
+
+// openBenchCache returns the read-only synthetic cache of nUsers users.
+func openBenchCache(b *testing.B, nUsers int) *cache.Cache {
+	b.Helper()
+
+	c, err := cache.New(benchDBDir(b, nUsers))
+	require.NoError(b, err, "Setup: could not open synthetic cache")
+	b.Cleanup(func() { c.Close() })
+
+	return c
+}
+
+// benchDBDir returns the directory of the synthetic database of nUsers users, generating it on first use.
+func benchDBDir(b *testing.B, nUsers int) string {
+	b.Helper()
+
+	benchDBs.Lock()
+	defer benchDBs.Unlock()
+
+	if dir, ok := benchDBs.dirs[nUsers]; ok {
+		return dir
+	}
+
+	// The databases are shared between benchmarks, so they can't be in a benchmark temporary directory.
+	dir, err := os.MkdirTemp("", "authd-cache-bench")
+	require.NoError(b, err, "Setup: could not create synthetic cache directory")
+	err = cachetests.GenerateDB(dir, nUsers, *benchGroups, *benchGroupsPerUser)
+	require.NoError(b, err, "Setup: could not generate synthetic cache")
+
+	benchDBs.dirs[nUsers] = dir
+	return dir
+}
+
+// copyBenchDB copies the synthetic database of nUsers users to destDir.
+func copyBenchDB(b *testing.B, nUsers int, destDir string) {
+	b.Helper()
+
+	src, err := os.Open(filepath.Join(benchDBDir(b, nUsers), cachetests.DbName))
+	require.NoError(b, err, "Setup: could not open synthetic cache")
+	defer src.Close()
+
+	dst, err := os.OpenFile(filepath.Join(destDir, cachetests.DbName), os.O_CREATE|os.O_WRONLY, 0600)
+	require.NoError(b, err, "Setup: could not create synthetic cache copy")
+	defer dst.Close()
+
+	_, err = io.Copy(dst, src)
+	require.NoError(b, err, "Setup: could not copy synthetic cache")
+}
+
+// benchUserInfo returns the user information a broker would return for the user i of a synthetic cache.
+func benchUserInfo(i int) users.UserInfo {
+	name := cachetests.SyntheticUserName(i)
+	u := users.UserInfo{
+		Name:  name,
+		UID:   cachetests.SyntheticUID(i),
+		Dir:   "/home/" + name,
+		Shell: "/bin/bash",
+	}
+	for _, j := range cachetests.SyntheticUserGroups(i, *benchGroups, *benchGroupsPerUser) {
+		gid := cachetests.SyntheticGID(j)
+		u.Groups = append(u.Groups, users.GroupInfo{Name: cachetests.SyntheticGroupName(j), GID: &gid})
+	}
+	return u
+}
+
+// removeBenchDBs removes the synthetic databases generated by the benchmarks.
+func removeBenchDBs() {
+	benchDBs.Lock()
+	defer benchDBs.Unlock()
+
+	for n, dir := range benchDBs.dirs {
+		os.RemoveAll(dir)
+		delete(benchDBs.dirs, n)
+	}
+}
+
+func TestGenerateDB(t *testing.T) {
+	t.Parallel()
+
+	// Benchmarks are not run in CI: ensure at least that the synthetic databases they rely on are valid caches.
+	dir := t.TempDir()
+	err := cachetests.GenerateDB(dir, 10, 3, 2)
+	require.NoError(t, err, "GenerateDB should not return an error, but did")
+
+	c, err := cache.New(dir)
+	require.NoError(t, err, "Synthetic database should be a valid cache")
+	defer c.Close()
+
+	user, err := c.UserByName(cachetests.SyntheticUserName(4))
+	require.NoError(t, err, "UserByName should find the synthetic user")
+	require.Equal(t, cachetests.SyntheticUID(4), user.UID, "Synthetic user should have the expected UID")
+	require.Equal(t, cachetests.SyntheticGID(cachetests.SyntheticUserGroups(4, 3, 2)[0]), user.GID,
+		"Synthetic user should have its first group as primary group")
+
+	all, err := c.AllUsers()
+	require.NoError(t, err, "AllUsers should not return an error, but did")
+	require.Len(t, all, 10, "Synthetic cache should have all the generated users")
+
+	groups, err := c.AllGroups()
+	require.NoError(t, err, "AllGroups should not return an error, but did")
+	require.Len(t, groups, 3, "Synthetic cache should have all the generated groups")
+}
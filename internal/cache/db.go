@@ -2,7 +2,7 @@
 package cache
 
 import (
-	"encoding/json"
+	"bytes"
 	"errors"
 	"fmt"
 	"io/fs"
@@ -13,6 +13,7 @@ import (
 	"slices"
 	"strconv"
 	"sync"
+	"sync/atomic"
 	"syscall"
 	"time"
 
@@ -34,12 +35,32 @@ const (
 	groupToUsersBucketName = "GroupToUsers"
 	userToBrokerBucketName = "UserToBroker"
 
+	// userToLastLoginBucketName has the last login time of the users, see expiry.go.
+	userToLastLoginBucketName = "UserToLastLogin"
+	// userByLastLoginBucketName is the expiry index, see expiry.go.
+	userByLastLoginBucketName = "UserByLastLogin"
+	// groupMembersBucketName is the index of the group members, see memberships.go.
+	groupMembersBucketName = "GroupMembers"
+
 	// defaultEntryExpiration is the amount of time the user is allowed on the cache without authenticating.
 	// It's equivalent to 6 months.
 	defaultEntryExpiration = time.Hour * 24 * 30 * 6
 
 	// defaultCleanupInterval is the interval upon which the cache will be cleaned of expired users.
 	defaultCleanupInterval = time.Hour * 24
+
+	// writeBatchMaxDelay is the maximum time a write waits for concurrent ones to be committed in the same
+	// transaction, see Cache.batch.
+	writeBatchMaxDelay = 5 * time.Millisecond
+
+	// enumerationPageSize is the maximum number of entries read in a single transaction when iterating over a bucket.
+	enumerationPageSize = 256
+
+	// maintenanceBatchSize is the maximum number of records changed in a single transaction by the background
+	// maintenance of the database, so that it never holds the database for long.
+	maintenanceBatchSize = 256
+	// maintenanceBatchInterval is the time between two transactions of the background maintenance, bounding its I/O.
+	maintenanceBatchInterval = 10 * time.Millisecond
 )
 
 var (
@@ -47,27 +68,40 @@ var (
 		[]byte(userByNameBucketName), []byte(userByIDBucketName),
 		[]byte(groupByNameBucketName), []byte(groupByIDBucketName),
 		[]byte(userToGroupsBucketName), []byte(groupToUsersBucketName),
-		[]byte(userToBrokerBucketName),
+		[]byte(userToBrokerBucketName), []byte(userToLastLoginBucketName),
+		[]byte(userByLastLoginBucketName), []byte(groupMembersBucketName),
 	}
 )
 
 // Cache is our database API.
 type Cache struct {
-	db *bbolt.DB
-	mu sync.RWMutex
+	// db is the current database. It's only replaced when the database is cleared, see withDB.
+	db atomic.Pointer[bbolt.DB]
+	// clearMu is held for reading by writers, and for writing while the database is cleared, so that no write is
+	// committed to the previous database once it has been removed.
+	clearMu sync.RWMutex
 
 	dirtyFlagPath  string
 	procDir        string
 	doClear        chan struct{}
 	quit           chan struct{}
 	cleanupQuitted chan struct{}
+
+	// maintained is closed once the maintenance run in the background after opening the database is done.
+	maintained chan struct{}
+
+	nssSnapshot   nssSnapshot
+	nssSnapshotMu sync.Mutex
+	// doPublishNSSSnapshot requests the goroutine to publish a new NSS snapshot, see requestNSSSnapshot.
+	doPublishNSSSnapshot chan struct{}
 }
 
-// userDB is the struct stored in json format in the bucket.
+// userDB is the struct stored, encoded as a record, in the bucket.
 type userDB struct {
 	UserPasswdShadow
 
-	// Additional entries
+	// LastLogin is not part of the binary record, but stored in the userToLastLogin bucket, so that logging in again
+	// does not rewrite the user records. It's only decoded from the JSON records of previous versions.
 	LastLogin time.Time
 }
 
@@ -75,29 +109,38 @@ func (u userDB) toUserPasswdShadow() UserPasswdShadow {
 	return u.UserPasswdShadow
 }
 
-// groupDB is the struct stored in json format in the bucket.
+// groupDB is the struct stored, encoded as a record, in the bucket.
 type groupDB struct {
 	Name string
 	GID  int
 }
 
-// userToGroupsDB is the struct stored in json format to match uid to gids in the bucket.
+// userToGroupsDB is the struct stored, encoded as a record, to match uid to gids in the bucket.
 type userToGroupsDB struct {
 	UID  int
 	GIDs []int
 }
 
-// groupToUsersDB is the struct stored in json format to match gid to uids in the bucket.
+// groupToUsersDB is the struct stored, encoded as a record, to match gid to uids in the bucket.
 type groupToUsersDB struct {
 	GID  int
 	UIDs []int
 }
 
+// groupMembersDB is the struct stored, encoded as a record, to match gid to the uids and names of its members in the
+// bucket. Names are in the same order as UIDs.
+type groupMembersDB struct {
+	GID   int
+	UIDs  []int
+	Names []string
+}
+
 type options struct {
 	expirationDate  time.Time
 	cleanOnNew      bool
 	cleanupInterval time.Duration
 	procDir         string // This is to force failure in tests.
+	nssSnapshotPath string
 }
 
 // Option represents an optional function to override Cache default values.
@@ -111,6 +154,8 @@ func WithExpirationDate(date time.Time) Option {
 }
 
 // New creates a new database cache by creating or opening the underlying db.
+// The cache serves lookups as soon as the database is opened: cleaning expired users, publishing the NSS snapshot and
+// converting records of previous versions are done in the background.
 func New(cacheDir string, args ...Option) (cache *Cache, err error) {
 	dbPath := filepath.Join(cacheDir, dbName)
 	defer decorate.OnError(&err, "could not create new database object at %q", dbPath)
@@ -147,54 +192,56 @@ func New(cacheDir string, args ...Option) (cache *Cache, err error) {
 	}
 
 	c := Cache{
-		db:             db,
 		dirtyFlagPath:  dirtyFlagPath,
 		procDir:        opts.procDir,
-		doClear:        make(chan struct{}),
+		doClear:        make(chan struct{}, 1),
 		quit:           make(chan struct{}),
 		cleanupQuitted: make(chan struct{}),
-	}
+		maintained:     make(chan struct{}),
+		nssSnapshot:    nssSnapshot{path: opts.nssSnapshotPath},
 
-	if opts.cleanOnNew {
-		// Triggers a cleanup call when the db is opened
-		if err := c.cleanExpiredUsers(opts.expirationDate); err != nil {
-			slog.Warn(fmt.Sprintf("Could not clean database %v", err))
-		}
+		doPublishNSSSnapshot: make(chan struct{}, 1),
 	}
+	c.db.Store(db)
 
 	cleanupRoutineStarted := make(chan struct{})
 	go func() {
 		defer close(c.cleanupQuitted)
 		close(cleanupRoutineStarted)
+
+		c.maintainOpenedDatabase(opts.cleanOnNew, opts.expirationDate)
+		close(c.maintained)
+
 		for {
 			select {
 			case <-c.doClear:
-				func() {
-					c.mu.Lock()
-					defer c.mu.Unlock()
-
-					if err := c.db.Close(); err != nil {
-						slog.Warn(fmt.Sprintf("Could not close database %v", err))
-					}
-
-					db, err := openAndInitDB(dbPath, c.dirtyFlagPath)
-					if err != nil {
-						panic(fmt.Sprintf("CRITICAL: unrecoverable state: could not recreate database: %v", err))
-					}
-					c.db = db
-				}()
+				// The database file is removed and replaced while the previous database is still open, so that
+				// lookups never wait for the clear up. Writers wait for the new database to be published instead.
+				c.clearMu.Lock()
+				clearDatabase(dbPath, c.dirtyFlagPath)
+				db, err := openAndInitDB(dbPath, c.dirtyFlagPath)
+				if err != nil {
+					panic(fmt.Sprintf("CRITICAL: unrecoverable state: could not recreate database: %v", err))
+				}
+				previous := c.db.Swap(db)
+				c.clearMu.Unlock()
+
+				// Close waits for the transactions still running on the previous database.
+				if err := previous.Close(); err != nil {
+					slog.Warn(fmt.Sprintf("Could not close database %v", err))
+				}
+				c.publishNSSSnapshot()
 
 			case <-time.After(opts.cleanupInterval):
-				func() {
-					c.mu.RLock()
-					defer c.mu.RUnlock()
+				slog.Debug("Starting scheduled cleaning of expired users")
 
-					slog.Debug("Starting scheduled cleaning of expired users")
+				if err := c.cleanExpiredUsers(opts.expirationDate); err != nil {
+					slog.Warn(fmt.Sprintf("Could not clean database %v", err))
+				}
+				c.publishNSSSnapshot()
 
-					if err := c.cleanExpiredUsers(opts.expirationDate); err != nil {
-						slog.Warn(fmt.Sprintf("Could not clean database %v", err))
-					}
-				}()
+			case <-c.doPublishNSSSnapshot:
+				c.publishNSSSnapshot()
 
 			case <-c.quit:
 				return
@@ -221,6 +268,7 @@ func openAndInitDB(path, dirtyFlagPath string) (*bbolt.DB, error) {
 		}
 		return nil, fmt.Errorf("can't open database file: %v", err)
 	}
+	db.MaxBatchDelay = writeBatchMaxDelay
 	// Fail if permissions are not 0600
 	fileInfo, err := os.Stat(path)
 	if err != nil {
@@ -231,6 +279,19 @@ func openAndInitDB(path, dirtyFlagPath string) (*bbolt.DB, error) {
 		return nil, fmt.Errorf("wrong file permission for %s: %o", path, perm)
 	}
 
+	// Opening a database which is up to date doesn't need any write transaction.
+	var needsInit bool
+	err = db.View(func(tx *bbolt.Tx) error {
+		needsInit = bucketsNeedInit(tx)
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+	if !needsInit {
+		return db, nil
+	}
+
 	// Create buckets
 	err = db.Update(func(tx *bbolt.Tx) error {
 		var allBucketsNames []string
@@ -257,7 +318,6 @@ func openAndInitDB(path, dirtyFlagPath string) (*bbolt.DB, error) {
 			// We are in a RW transaction.
 			_ = tx.DeleteBucket(bucketName)
 		}
-
 		return nil
 	})
 	if err != nil {
@@ -267,46 +327,161 @@ func openAndInitDB(path, dirtyFlagPath string) (*bbolt.DB, error) {
 	return db, nil
 }
 
-// cleanExpiredUsers removes from the cache any user that exceeded the maximum amount of days without authentication.
-func (c *Cache) cleanExpiredUsers(expirationDate time.Time) (err error) {
-	defer decorate.OnError(&err, "could not clean up database")
+// bucketsNeedInit returns true if the buckets of tx are not the expected ones. The derived indexes missing entries are
+// completed by the maintenance run in the background instead.
+func bucketsNeedInit(tx *bbolt.Tx) bool {
+	var n int
+	unknown := tx.ForEach(func(name []byte, _ *bbolt.Bucket) error {
+		if !slices.ContainsFunc(allBuckets, func(b []byte) bool { return bytes.Equal(b, name) }) {
+			return errors.New("unknown bucket")
+		}
+		n++
+		return nil
+	}) != nil
+	return unknown || n != len(allBuckets)
+}
 
-	return c.db.Update(func(tx *bbolt.Tx) (err error) {
-		// Cleans up the database
-		activeUsers, err := getActiveUsers(c.procDir)
-		if err != nil {
-			return err
+// maintainOpenedDatabase cleans the expired users if cleanExpired is true, publishes the NSS snapshot, adds the
+// missing entries of the derived indexes and converts the records stored by previous versions of the database.
+// It's run in the background once the database is opened.
+func (c *Cache) maintainOpenedDatabase(cleanExpired bool, expirationDate time.Time) {
+	// Expired users are found through the expiry index.
+	expiryIndexErr := c.rebuildExpiryIndex()
+	if expiryIndexErr != nil {
+		slog.Warn(fmt.Sprintf("Could not rebuild the expiry index: %v", expiryIndexErr))
+	}
+	if cleanExpired {
+		if err := c.cleanExpiredUsers(expirationDate); err != nil {
+			slog.Warn(fmt.Sprintf("Could not clean database %v", err))
 		}
+	}
+	c.publishNSSSnapshot()
+
+	// Groups which are not indexed yet are looked up from the source buckets meanwhile.
+	if err := c.rebuildGroupMembersIndex(); err != nil {
+		slog.Warn(fmt.Sprintf("Could not rebuild the group members index: %v", err))
+	}
+	// The user records of previous versions hold the last login times until they are moved by rebuildExpiryIndex.
+	if expiryIndexErr != nil {
+		return
+	}
+	if err := c.migrateJSONRecords(); err != nil {
+		slog.Warn(fmt.Sprintf("Could not convert records of previous versions of the database: %v", err))
+	}
+}
 
-		buckets, err := getAllBuckets(tx)
+// waitMaintenanceBatchInterval waits between two transactions of the background maintenance. It returns false if the
+// cache is closed meanwhile.
+func (c *Cache) waitMaintenanceBatchInterval() bool {
+	select {
+	case <-time.After(maintenanceBatchInterval):
+		return true
+	case <-c.quit:
+		return false
+	}
+}
+
+// maintainBucket looks for the entries of the bucket which need to be fixed by pages, in read transactions, and fixes
+// the ones found in a page in a single write transaction, so that the maintenance never holds the database for long.
+// fix is called with the keys of the entries for which needsFix returned true, which may have changed since.
+func (c *Cache) maintainBucket(name string, needsFix func(buckets map[string]bucketWithName, key, value []byte) bool,
+	fix func(buckets map[string]bucketWithName, keys [][]byte) error) error {
+	var after []byte
+	for {
+		var keys [][]byte
+		var next []byte
+		err := c.view(func(tx *bbolt.Tx) error {
+			buckets, err := getAllBuckets(tx)
+			if err != nil {
+				return err
+			}
+			next, err = forEachInBucketPage(buckets[name], after, maintenanceBatchSize, func(key, value []byte) error {
+				if needsFix(buckets, key, value) {
+					// The key is only valid for the lifetime of the transaction.
+					keys = append(keys, bytes.Clone(key))
+				}
+				return nil
+			})
+			return err
+		})
 		if err != nil {
 			return err
 		}
 
-		var expiredUsers []userDB
-		// The foreach closure can't error out, so we can ignore the error.
-		_ = buckets[userByIDBucketName].ForEach(func(k, v []byte) error {
-			var u userDB
-			if err := json.Unmarshal(v, &u); err != nil {
-				slog.Warn(fmt.Sprintf("Could not unmarshal user %q: %v", string(k), err))
+		if len(keys) > 0 {
+			err := c.update(func(tx *bbolt.Tx) error {
+				buckets, err := getAllBuckets(tx)
+				if err != nil {
+					return err
+				}
+				return fix(buckets, keys)
+			})
+			if err != nil {
+				return err
+			}
+			if !c.waitMaintenanceBatchInterval() {
 				return nil
 			}
+		}
 
-			if _, active := activeUsers[u.Name]; !active && u.LastLogin.Before(expirationDate) {
-				expiredUsers = append(expiredUsers, u)
-			}
+		if next == nil {
 			return nil
-		})
+		}
+		after = next
+	}
+}
+
+// cleanExpiredUsers removes from the cache any user that exceeded the maximum amount of days without authentication.
+// Users are removed by batches of maintenanceBatchSize, each in its own transaction.
+func (c *Cache) cleanExpiredUsers(expirationDate time.Time) (err error) {
+	defer decorate.OnError(&err, "could not clean up database")
 
-		for _, u := range expiredUsers {
-			slog.Debug(fmt.Sprintf("Deleting expired user %q", u.Name))
-			if err := deleteUser(buckets, u.UID); err != nil {
-				slog.Warn(fmt.Sprintf("Could not delete user %q: %v", u.Name, err))
+	// Only look for active users when some expired, as it needs to walk through all processes.
+	var activeUsers map[string]struct{}
+	// The users which are kept, as active or failing to be deleted, are not looked at again.
+	kept := make(map[int]struct{})
+
+	for {
+		var expired []userDB
+		err := c.update(func(tx *bbolt.Tx) (err error) {
+			buckets, err := getAllBuckets(tx)
+			if err != nil {
+				return err
+			}
+
+			expired = expiredUsers(buckets, expirationDate, kept, maintenanceBatchSize)
+			if len(expired) == 0 {
+				return nil
+			}
+
+			if activeUsers == nil {
+				if activeUsers, err = getActiveUsers(c.procDir); err != nil {
+					return err
+				}
 			}
+
+			for _, u := range expired {
+				if _, active := activeUsers[u.Name]; active {
+					kept[u.UID] = struct{}{}
+					continue
+				}
+				slog.Debug(fmt.Sprintf("Deleting expired user %q", u.Name))
+				if err := deleteUser(buckets, u.UID); err != nil {
+					slog.Warn(fmt.Sprintf("Could not delete user %q: %v", u.Name, err))
+					kept[u.UID] = struct{}{}
+				}
+			}
+
+			return nil
+		})
+		if err != nil {
+			return err
 		}
 
-		return nil
-	})
+		if len(expired) < maintenanceBatchSize || !c.waitMaintenanceBatchInterval() {
+			return nil
+		}
+	}
 }
 
 // getActiveUsers walks through procDir and returns a map with the usernames of the owners of all active processes.
@@ -357,22 +532,55 @@ func getActiveUsers(procDir string) (activeUsers map[string]struct{}, err error)
 func (c *Cache) Close() error {
 	close(c.quit)
 	<-c.cleanupQuitted
-	c.mu.Lock()
-	defer c.mu.Unlock()
-	return c.db.Close()
+	c.withdrawNSSSnapshot()
+	return c.db.Load().Close()
+}
+
+// view runs fn in a read-only transaction of the current database.
+func (c *Cache) view(fn func(tx *bbolt.Tx) error) error {
+	return c.withDB(func(db *bbolt.DB) error { return db.View(fn) })
+}
+
+// update runs fn in a read-write transaction of the current database.
+func (c *Cache) update(fn func(tx *bbolt.Tx) error) error {
+	c.clearMu.RLock()
+	defer c.clearMu.RUnlock()
+	return c.withDB(func(db *bbolt.DB) error { return db.Update(fn) })
+}
+
+// batch runs fn in a read-write transaction of the current database, which can be shared with concurrent calls to
+// batch so that they are committed and synced to disk together. fn can be called more than once if a function of the
+// same batch fails, so it must only act on the transaction.
+func (c *Cache) batch(fn func(tx *bbolt.Tx) error) error {
+	c.clearMu.RLock()
+	defer c.clearMu.RUnlock()
+	return c.withDB(func(db *bbolt.DB) error { return db.Batch(fn) })
+}
+
+// withDB calls fn with the current database. Lookups don't lock: when clearing the database, the new one is published
+// before the previous one is closed. If fn failed because it started using the previous database after it was closed,
+// it's called again with the current one.
+func (c *Cache) withDB(fn func(db *bbolt.DB) error) error {
+	for {
+		db := c.db.Load()
+		err := fn(db)
+		if errors.Is(err, bbolt.ErrDatabaseNotOpen) && c.db.Load() != db {
+			continue
+		}
+		return err
+	}
 }
 
 // requestClearDatabase ask for the clean goroutine to clear up the database.
-// If we already have a pending request, do not block on it.
-// TODO: improve behavior when cleanup is already running
-// (either remove the dangling dirty file or queue the cleanup request).
+// If we already have a pending request, do not block on it. The request is kept until the goroutine is done with the
+// maintenance it could be running.
 func (c *Cache) requestClearDatabase() {
 	if err := os.WriteFile(c.dirtyFlagPath, nil, 0600); err != nil {
 		slog.Warn(fmt.Sprintf("Could not write dirty file flag to signal clearing up the database: %v", err))
 	}
 	select {
 	case c.doClear <- struct{}{}:
-	case <-time.After(10 * time.Millisecond): // Let the time for the cleanup goroutine for the initial start.
+	default:
 	}
 }
 
@@ -415,7 +623,7 @@ func getBucket(tx *bbolt.Tx, name string) (bucketWithName, error) {
 }
 
 // getFromBucket is a generic function to get any value of given type from a bucket. It returns an error if
-// the returned value (json) could not be unmarshalled to the returned struct.
+// the returned record could not be decoded to the returned struct.
 func getFromBucket[T any, K int | string](bucket bucketWithName, key K) (T, error) {
 	// TODO: switch to https://github.com/golang/go/issues/45380 if accepted.
 	var k []byte
@@ -435,13 +643,74 @@ func getFromBucket[T any, K int | string](bucket bucketWithName, key K) (T, erro
 		return r, NoDataFoundError{key: string(k), bucketName: bucket.name}
 	}
 
-	if err := json.Unmarshal(data, &r); err != nil {
+	r, err := decodeRecord[T](data)
+	if err != nil {
 		return r, fmt.Errorf("can't unmarshal bucket %q for key %v: %v", bucket.name, key, err)
 	}
 
 	return r, nil
 }
 
+// forEachInPages calls fn for each entry returned by readPage until fn returns an error. Only pageSize entries are
+// read in each transaction, so that the memory use doesn't depend on the number of entries and the database is not
+// locked while fn is called.
+// Upon corruption, clearing the database is requested.
+func forEachInPages[T any](c *Cache, pageSize int, readPage func(tx *bbolt.Tx, after []byte, n int) ([]T, []byte, error), fn func(T) error) error {
+	var after []byte
+	for {
+		var page []T
+		var next []byte
+
+		err := c.view(func(tx *bbolt.Tx) (err error) {
+			page, next, err = readPage(tx, after, pageSize)
+			return err
+		})
+		if err != nil {
+			c.requestClearDatabase()
+			return err
+		}
+
+		for _, e := range page {
+			if err := fn(e); err != nil {
+				return err
+			}
+		}
+
+		if next == nil {
+			return nil
+		}
+		after = next
+	}
+}
+
+// forEachInBucketPage calls fn for at most n entries of the bucket, starting after the key after or from the first
+// entry if after is nil. It returns the key to resume from if more entries follow, nil otherwise.
+func forEachInBucketPage(bucket bucketWithName, after []byte, n int, fn func(key, value []byte) error) (next []byte, err error) {
+	cur := bucket.Cursor()
+	k, v := cur.First()
+	if after != nil {
+		k, v = cur.Seek(after)
+		if bytes.Equal(k, after) {
+			k, v = cur.Next()
+		}
+	}
+
+	var last []byte
+	for i := 0; k != nil; k, v = cur.Next() {
+		if i == n {
+			// The key is only valid for the lifetime of the transaction.
+			return bytes.Clone(last), nil
+		}
+		if err := fn(k, v); err != nil {
+			return nil, err
+		}
+		last = k
+		i++
+	}
+
+	return nil, nil
+}
+
 // NoDataFoundError is returned when we didn’t find a matching entry.
 type NoDataFoundError struct {
 	key        string
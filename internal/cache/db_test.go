@@ -2,9 +2,11 @@ package cache_test
 
 import (
 	"errors"
+	"fmt"
 	"io/fs"
 	"os"
 	"path/filepath"
+	"strings"
 	"testing"
 	"time"
 	_ "unsafe"
@@ -24,6 +26,7 @@ func TestNew(t *testing.T) {
 
 	tests := map[string]struct {
 		dbFile          string
+		jsonRecords     bool
 		dirtyFlag       bool
 		perm            *fs.FileMode
 		corruptedDbFile bool
@@ -36,8 +39,9 @@ func TestNew(t *testing.T) {
 
 		wantErr bool
 	}{
-		"New without any initialized database": {},
-		"New with already existing database":   {dbFile: "multiple_users_and_groups"},
+		"New without any initialized database":      {},
+		"New with already existing database":        {dbFile: "multiple_users_and_groups"},
+		"New converts records of previous versions": {dbFile: "multiple_users_and_groups_with_brokers", jsonRecords: true},
 
 		// Clean up tests
 		"Clean up all users":  {dbFile: "only_old_users", expirationDate: "2020-01-01"},
@@ -48,8 +52,8 @@ func TestNew(t *testing.T) {
 		"Clean up user even if it is not listed on the group":    {dbFile: "user_not_in_groupToUsers", expirationDate: "2020-01-01"},
 		"Do not clean any user":                                  {dbFile: "multiple_users_and_groups"},
 		"Do not clean active user":                               {dbFile: "active_user", expirationDate: "2020-01-01"},
-		"Do not prevent cache creation if cleanup fails":         {dbFile: "multiple_users_and_groups", procDir: "does-not-exist"},
-		"Do not stop cache if cleanup routine fails":             {dbFile: "multiple_users_and_groups", procDir: "does-not-exist", skipCleanOnNew: true, cleanupInterval: 1},
+		"Do not prevent cache creation if cleanup fails":         {dbFile: "multiple_users_and_groups", expirationDate: "2020-01-01", procDir: "does-not-exist"},
+		"Do not stop cache if cleanup routine fails":             {dbFile: "multiple_users_and_groups", expirationDate: "2020-01-01", procDir: "does-not-exist", skipCleanOnNew: true, cleanupInterval: 1},
 		"Do not clean user if can not get groups":                {dbFile: "invalid_entry_in_userToGroups", expirationDate: "2020-01-01"},
 		"Do not clean user if can not delete user from group":    {dbFile: "invalid_entry_in_groupByID", expirationDate: "2020-01-01"},
 
@@ -74,6 +78,12 @@ func TestNew(t *testing.T) {
 			if tc.dbFile == "-" {
 				err := os.RemoveAll(cacheDir)
 				require.NoError(t, err, "Setup: could not remove temporary cache directory")
+			} else if tc.jsonRecords {
+				f, err := os.Open(filepath.Join("testdata", tc.dbFile+".db.yaml"))
+				require.NoError(t, err, "Setup: should be able to read source file")
+				defer f.Close()
+				err = cache.DbfromYAMLWithJSONRecords(f, cacheDir)
+				require.NoError(t, err, "Setup: should be able to write database file")
 			} else if tc.dbFile != "" {
 				createDBFile(t, filepath.Join("testdata", tc.dbFile+".db.yaml"), cacheDir)
 			}
@@ -114,6 +124,7 @@ func TestNew(t *testing.T) {
 			}
 			require.NoError(t, err)
 			defer c.Close()
+			cache.WaitForMaintenanceOnNew(c)
 
 			if tc.cleanupInterval > 0 {
 				// Wait for the clean up routine to start
@@ -133,6 +144,15 @@ func TestNew(t *testing.T) {
 			want := testutils.LoadWithUpdateFromGolden(t, got)
 			require.Equal(t, want, got, "Did not get expected database content")
 
+			if tc.jsonRecords {
+				n, err := cache.JSONRecordsCount(c)
+				require.NoError(t, err, "Could not read database records")
+				require.Zero(t, n, "All records should have been converted to the binary format")
+				lastLogin, err := cache.LastLogin(c, 1111)
+				require.NoError(t, err, "The last login time should have been moved out of the user record")
+				require.False(t, lastLogin.IsZero(), "The last login time should have been kept")
+			}
+
 			// check database permission
 			fileInfo, err := os.Stat(dbDestPath)
 			require.NoError(t, err, "Failed to stat database")
@@ -248,6 +268,27 @@ func TestUpdateFromUserInfo(t *testing.T) {
 				{Name: "local-group"},
 			},
 		},
+		"user1-with-invalid-uid": {
+			Name:  "user1",
+			UID:   -1,
+			Gecos: "User1 gecos\nOn multiple lines",
+			Dir:   "/home/user1",
+			Shell: "/bin/bash",
+			Groups: []users.GroupInfo{
+				{Name: "group1", GID: ptrValue(11111)},
+			},
+		},
+		"user1-with-invalid-gid": {
+			Name:  "user1",
+			UID:   1111,
+			Gecos: "User1 gecos\nOn multiple lines",
+			Dir:   "/home/user1",
+			Shell: "/bin/bash",
+			Groups: []users.GroupInfo{
+				{Name: "group1", GID: ptrValue(11111)},
+				{Name: "group2", GID: ptrValue(-2)},
+			},
+		},
 		"user3-without-common-group": {
 			Name:  "user3",
 			UID:   3333,
@@ -300,6 +341,8 @@ func TestUpdateFromUserInfo(t *testing.T) {
 		// Error cases
 		"Error on user without any groups":                                                         {userCase: "user1-without-groups", wantErr: true},
 		"Error on user with only local group":                                                      {userCase: "user1-with-only-local-group", wantErr: true},
+		"Error on user with invalid uid":                                                           {userCase: "user1-with-invalid-uid", wantErr: true},
+		"Error on user with invalid gid":                                                           {userCase: "user1-with-invalid-gid", wantErr: true},
 		"Error on invalid value entry in userToGroups clear database":                              {userCase: "user1", dbFile: "invalid_entry_in_userToGroups", wantErr: true, wantClearDB: true},
 		"Error on invalid value entry in groupToUsers clear database":                              {userCase: "user1", dbFile: "invalid_entry_in_groupToUsers", wantErr: true, wantClearDB: true},
 		"Error on invalid value entry in groupToUsers for user dropping from group clear database": {userCase: "user1", dbFile: "invalid_entry_in_groupToUsers_secondary_group", wantErr: true, wantClearDB: true},
@@ -337,6 +380,280 @@ func TestUpdateFromUserInfo(t *testing.T) {
 	}
 }
 
+func TestUpdateFromUserInfoOnRepeatedLogin(t *testing.T) {
+	t.Parallel()
+
+	cacheDir := t.TempDir()
+	createDBFile(t, filepath.Join("testdata", "one_user_and_group.db.yaml"), cacheDir)
+	c, err := cache.New(cacheDir, cache.WithoutCleaningOnNew())
+	require.NoError(t, err, "Setup: could not create cache")
+	defer c.Close()
+
+	u := users.UserInfo{Name: "user1", UID: 1111, Gecos: "User1 gecos\nOn multiple lines", Dir: "/home/user1", Shell: "/bin/bash", Groups: []users.GroupInfo{{Name: "group1", GID: ptrValue(11111)}}}
+	err = c.UpdateFromUserInfo(u)
+	require.NoError(t, err, "Setup: could not update user")
+
+	wantByID, wantByName, err := cache.UserRecords(c, 1111, "user1")
+	require.NoError(t, err, "Setup: could not read user records")
+	previousLastLogin, err := cache.LastLogin(c, 1111)
+	require.NoError(t, err, "Setup: could not read last login time")
+
+	err = c.UpdateFromUserInfo(u)
+	require.NoError(t, err, "UpdateFromUserInfo should not return an error, but did")
+
+	gotByID, gotByName, err := cache.UserRecords(c, 1111, "user1")
+	require.NoError(t, err, "Could not read user records")
+	require.Equal(t, wantByID, gotByID, "UserByID record should not change when only the last login time does")
+	require.Equal(t, wantByName, gotByName, "UserByName record should not change when only the last login time does")
+
+	lastLogin, err := cache.LastLogin(c, 1111)
+	require.NoError(t, err, "Could not read last login time")
+	require.True(t, lastLogin.After(previousLastLogin), "Last login time should have been updated")
+}
+
+func TestConcurrentUpdates(t *testing.T) {
+	t.Parallel()
+
+	c, _ := initCache(t, "")
+
+	const writers = 20
+	errs := make(chan error, writers)
+	for i := 0; i < writers; i++ {
+		i := i
+		go func() {
+			name := fmt.Sprintf("user%d", i)
+			err := c.UpdateFromUserInfo(users.UserInfo{
+				Name: name,
+				UID:  1000 + i,
+				Groups: []users.GroupInfo{
+					{Name: fmt.Sprintf("group%d", i), GID: ptrValue(10000 + i)},
+					{Name: "commongroup", GID: ptrValue(99999)},
+				},
+			})
+			if err == nil {
+				err = c.UpdateBrokerForUser(name, fmt.Sprintf("broker%d", i))
+			}
+			errs <- err
+		}()
+	}
+	for i := 0; i < writers; i++ {
+		require.NoError(t, <-errs, "Concurrent updates should not fail")
+	}
+
+	allUsers, err := c.AllUsers()
+	require.NoError(t, err, "AllUsers should not return an error")
+	require.Len(t, allUsers, writers, "All users should have been stored")
+
+	commonGroup, err := c.GroupByID(99999)
+	require.NoError(t, err, "GroupByID should not return an error")
+	require.Len(t, commonGroup.Users, writers, "All users should be members of the common group")
+
+	for i := 0; i < writers; i++ {
+		brokerID, err := c.BrokerForUser(fmt.Sprintf("user%d", i))
+		require.NoError(t, err, "BrokerForUser should not return an error")
+		require.Equal(t, fmt.Sprintf("broker%d", i), brokerID, "Did not get expected broker for user")
+	}
+}
+
+func TestCleanExpiredUsers(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		expirationDate string
+		updateUser1    bool
+
+		wantUsers         []string
+		wantExpiryIndexes []int
+	}{
+		"Clean up users that logged in before expiration date": {
+			expirationDate:    "2008-01-01",
+			wantUsers:         []string{"user3"},
+			wantExpiryIndexes: []int{3333},
+		},
+		"Clean up users depending on their last login": {
+			expirationDate:    "2008-01-01",
+			updateUser1:       true,
+			wantUsers:         []string{"user1", "user3"},
+			wantExpiryIndexes: []int{1111, 3333},
+		},
+		"Do not clean any user if none logged in before expiration date": {
+			expirationDate:    "2004-01-01",
+			wantUsers:         []string{"user1", "user2", "user3"},
+			wantExpiryIndexes: []int{1111, 2222, 3333},
+		},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c, _ := initCache(t, "multiple_users_and_groups")
+
+			if tc.updateUser1 {
+				err := c.UpdateFromUserInfo(users.UserInfo{
+					Name:   "user1",
+					UID:    1111,
+					Groups: []users.GroupInfo{{Name: "group1", GID: ptrValue(11111)}},
+				})
+				require.NoError(t, err, "Setup: could not update user1")
+			}
+
+			expiration, err := time.Parse(time.DateOnly, tc.expirationDate)
+			require.NoError(t, err, "Setup: could not parse time for testing")
+
+			err = cache.CleanExpiredUsers(c, expiration)
+			require.NoError(t, err, "CleanExpiredUsers should not return an error")
+
+			allUsers, err := c.AllUsers()
+			require.NoError(t, err, "AllUsers should not return an error")
+			var gotUsers []string
+			for _, u := range allUsers {
+				gotUsers = append(gotUsers, u.Name)
+			}
+			require.ElementsMatch(t, tc.wantUsers, gotUsers, "Did not get expected remaining users")
+
+			gotExpiryIndexes, err := cache.ExpiryIndexUIDs(c)
+			require.NoError(t, err, "Could not read expiry index")
+			require.ElementsMatch(t, tc.wantExpiryIndexes, gotExpiryIndexes, "Expiry index should only have remaining users")
+		})
+	}
+}
+
+func TestGroupMembersIndex(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		userInfo       *users.UserInfo
+		expirationDate string
+
+		wantMembers map[int][]string
+	}{
+		"Index is rebuilt when opening a database without it": {
+			wantMembers: map[int][]string{11111: {"user1"}, 22222: {"user2"}, 33333: {"user3"}, 99999: {"user2", "user3"}},
+		},
+		"Index follows user renamed": {
+			userInfo: &users.UserInfo{
+				Name:   "newuser2",
+				UID:    2222,
+				Groups: []users.GroupInfo{{Name: "group2", GID: ptrValue(22222)}, {Name: "commongroup", GID: ptrValue(99999)}},
+			},
+			wantMembers: map[int][]string{11111: {"user1"}, 22222: {"newuser2"}, 33333: {"user3"}, 99999: {"newuser2", "user3"}},
+		},
+		"Index follows user added to and removed from groups": {
+			userInfo: &users.UserInfo{
+				Name:   "user1",
+				UID:    1111,
+				Groups: []users.GroupInfo{{Name: "commongroup", GID: ptrValue(99999)}, {Name: "newgroup", GID: ptrValue(44444)}},
+			},
+			wantMembers: map[int][]string{22222: {"user2"}, 33333: {"user3"}, 44444: {"user1"}, 99999: {"user2", "user3", "user1"}},
+		},
+		"Index follows expired users removal": {
+			expirationDate: "2008-01-01",
+			wantMembers:    map[int][]string{33333: {"user3"}, 99999: {"user3"}},
+		},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c, _ := initCache(t, "multiple_users_and_groups")
+
+			if tc.userInfo != nil {
+				err := c.UpdateFromUserInfo(*tc.userInfo)
+				require.NoError(t, err, "Setup: could not update user")
+			}
+			if tc.expirationDate != "" {
+				expiration, err := time.Parse(time.DateOnly, tc.expirationDate)
+				require.NoError(t, err, "Setup: could not parse time for testing")
+				err = cache.CleanExpiredUsers(c, expiration)
+				require.NoError(t, err, "Setup: could not clean expired users")
+			}
+
+			got, err := cache.GroupMembersIndex(c)
+			require.NoError(t, err, "Could not read group members index")
+			require.Equal(t, tc.wantMembers, got, "Group members index is not the expected one")
+
+			// Looking up through the index gives the members stored in the source buckets.
+			for gid, members := range got {
+				g, err := c.GroupByID(gid)
+				require.NoError(t, err, "GroupByID should not return an error")
+				require.ElementsMatch(t, members, g.Users, "GroupByID should return the indexed members")
+			}
+		})
+	}
+}
+
+func TestNewDoesNotWriteUpToDateDatabase(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		dbFile string
+	}{
+		"Database with valid entries":                   {dbFile: "multiple_users_and_groups"},
+		"Database with entries that can not be indexed": {dbFile: "invalid_entry_in_userByID"},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			cacheDir := t.TempDir()
+			createDBFile(t, filepath.Join("testdata", tc.dbFile+".db.yaml"), cacheDir)
+			dbPath := filepath.Join(cacheDir, cachetests.DbName)
+
+			// The first opening rebuilds the indexes, which are not part of the YAML fixtures.
+			c, err := cache.New(cacheDir, cache.WithoutCleaningOnNew())
+			require.NoError(t, err, "Setup: could not create cache")
+			cache.WaitForMaintenanceOnNew(c)
+			require.NoError(t, c.Close(), "Setup: could not close cache")
+
+			want, err := os.ReadFile(dbPath)
+			require.NoError(t, err, "Setup: could not read database file")
+
+			c, err = cache.New(cacheDir, cache.WithoutCleaningOnNew())
+			require.NoError(t, err, "New should not return an error, but did")
+			cache.WaitForMaintenanceOnNew(c)
+			require.NoError(t, c.Close(), "Teardown: could not close cache")
+
+			got, err := os.ReadFile(dbPath)
+			require.NoError(t, err, "Could not read database file")
+			require.Equal(t, want, got, "Opening an up to date database should not write to it")
+		})
+	}
+}
+
+func TestCleanExpiredUsersByBatches(t *testing.T) {
+	t.Parallel()
+
+	// More users than cleaned in a single transaction.
+	const nUsers = 600
+
+	cacheDir := t.TempDir()
+	err := cachetests.GenerateDB(cacheDir, nUsers, 10, 3)
+	require.NoError(t, err, "Setup: could not generate database")
+
+	c, err := cache.New(cacheDir, cache.WithoutCleaningOnNew())
+	require.NoError(t, err, "Setup: could not create cache")
+	t.Cleanup(func() { c.Close() })
+	cache.WaitForMaintenanceOnNew(c)
+
+	err = cache.CleanExpiredUsers(c, time.Now().Add(time.Hour))
+	require.NoError(t, err, "CleanExpiredUsers should not return an error")
+
+	allUsers, err := c.AllUsers()
+	require.NoError(t, err, "AllUsers should not return an error")
+	require.Empty(t, allUsers, "All users should have been cleaned")
+
+	allGroups, err := c.AllGroups()
+	require.NoError(t, err, "AllGroups should not return an error")
+	require.Empty(t, allGroups, "All groups should have been cleaned with their members")
+
+	gotExpiryIndexes, err := cache.ExpiryIndexUIDs(c)
+	require.NoError(t, err, "Could not read expiry index")
+	require.Empty(t, gotExpiryIndexes, "Expiry index should be empty")
+}
+
 func TestUserByID(t *testing.T) {
 	t.Parallel()
 
@@ -389,6 +706,46 @@ func TestUserByName(t *testing.T) {
 	}
 }
 
+func TestLookupsWhileClearingDatabase(t *testing.T) {
+	t.Parallel()
+
+	c, cacheDir := initCache(t, "multiple_users_and_groups")
+
+	const readers = 4
+	stop := make(chan struct{})
+	errs := make(chan error, readers)
+	for i := 0; i < readers; i++ {
+		go func() {
+			for {
+				select {
+				case <-stop:
+					errs <- nil
+					return
+				default:
+				}
+
+				// The user is only found until the database is cleared for the first time.
+				if _, err := c.UserByID(1111); err != nil && !errors.Is(err, cache.NoDataFoundError{}) {
+					errs <- err
+					return
+				}
+			}
+		}()
+	}
+
+	for i := 0; i < 5; i++ {
+		cache.RequestClearDatabase(c)
+		time.Sleep(10 * time.Millisecond)
+	}
+	close(stop)
+
+	for i := 0; i < readers; i++ {
+		require.NoError(t, <-errs, "Lookups should not fail while the database is cleared")
+	}
+	requireNoDirtyFileInDir(t, cacheDir)
+	requireClearedDatabase(t, c)
+}
+
 func TestAllUsers(t *testing.T) {
 	t.Parallel()
 
@@ -417,6 +774,110 @@ func TestAllUsers(t *testing.T) {
 	}
 }
 
+func TestForEachUser(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		dbFile   string
+		pageSize int
+		stopAt   int
+
+		wantErrType error
+	}{
+		"Get one user":       {dbFile: "one_user_and_group"},
+		"Get multiple users": {dbFile: "multiple_users_and_groups"},
+		"Get multiple users with one user per page":  {dbFile: "multiple_users_and_groups", pageSize: 1},
+		"Get multiple users with two users per page": {dbFile: "multiple_users_and_groups", pageSize: 2},
+		"Get no user": {},
+
+		"Get users only rely on valid userByID": {dbFile: "partially_valid_multiple_users_and_groups_only_userByID", pageSize: 1},
+
+		"Stop on error returned by callback": {dbFile: "multiple_users_and_groups", pageSize: 1, stopAt: 2, wantErrType: errStopIteration},
+
+		"Error on some invalid users entry": {dbFile: "invalid_entries_but_user_and_group1", pageSize: 1, wantErrType: shouldError{}},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c, cacheDir := initCache(t, tc.dbFile)
+			if tc.pageSize == 0 {
+				tc.pageSize = 256
+			}
+
+			var got []cache.UserPasswdShadow
+			err := cache.ForEachUserInPagesOf(c, tc.pageSize, func(u cache.UserPasswdShadow) error {
+				if tc.stopAt > 0 && len(got) == tc.stopAt {
+					return errStopIteration
+				}
+				got = append(got, u)
+				return nil
+			})
+			if errors.Is(tc.wantErrType, errStopIteration) {
+				require.ErrorIs(t, err, errStopIteration, "ForEachUser should return the error of the callback")
+				require.Len(t, got, tc.stopAt, "ForEachUser should stop at the first error of the callback")
+				return
+			}
+			if tc.wantErrType != nil {
+				requireGetAssertions(t, got, tc.wantErrType, err, c, cacheDir)
+				return
+			}
+			require.NoError(t, err, "ForEachUser should not return an error, but did")
+
+			want, err := c.AllUsers()
+			require.NoError(t, err, "Setup: could not get all users")
+			require.Equal(t, want, got, "ForEachUser should return the same users as AllUsers")
+		})
+	}
+}
+
+func TestForEachUserView(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		dbFile   string
+		pageSize int
+
+		wantErrType error
+	}{
+		"Get one user":       {dbFile: "one_user_and_group"},
+		"Get multiple users": {dbFile: "multiple_users_and_groups"},
+		"Get multiple users with one user per page": {dbFile: "multiple_users_and_groups", pageSize: 1},
+		"Get no user": {},
+
+		"Error on some invalid users entry": {dbFile: "invalid_entries_but_user_and_group1", pageSize: 1, wantErrType: shouldError{}},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c, cacheDir := initCache(t, tc.dbFile)
+			if tc.pageSize == 0 {
+				tc.pageSize = 256
+			}
+
+			var got []cache.UserPasswdShadow
+			err := cache.ForEachUserViewInPagesOf(c, tc.pageSize, func(u cache.UserPasswdShadow) error {
+				// The strings of the user are only valid during the call.
+				u.Name, u.Gecos, u.Dir, u.Shell = strings.Clone(u.Name), strings.Clone(u.Gecos), strings.Clone(u.Dir), strings.Clone(u.Shell)
+				got = append(got, u)
+				return nil
+			})
+			if tc.wantErrType != nil {
+				requireGetAssertions(t, got, tc.wantErrType, err, c, cacheDir)
+				return
+			}
+			require.NoError(t, err, "ForEachUserView should not return an error, but did")
+
+			want, err := c.AllUsers()
+			require.NoError(t, err, "Setup: could not get all users")
+			require.Equal(t, want, got, "ForEachUserView should return the same users as AllUsers")
+		})
+	}
+}
+
 func TestGroupByID(t *testing.T) {
 	t.Parallel()
 
@@ -471,6 +932,33 @@ func TestGroupByName(t *testing.T) {
 	}
 }
 
+func TestUserGroupIDs(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		dbFile string
+
+		wantErrType error
+	}{
+		"Get groups of existing user": {dbFile: "multiple_users_and_groups"},
+
+		"Error on missing user":               {wantErrType: cache.NoDataFoundError{}},
+		"Error on invalid database entry":     {dbFile: "invalid_entry_in_userByName", wantErrType: shouldError{}},
+		"Error on invalid userToGroups entry": {dbFile: "invalid_entry_in_userToGroups", wantErrType: shouldError{}},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c, cacheDir := initCache(t, tc.dbFile)
+
+			got, err := c.UserGroupIDs("user1")
+			requireGetAssertions(t, got, tc.wantErrType, err, c, cacheDir)
+		})
+	}
+}
+
 func TestAllGroups(t *testing.T) {
 	t.Parallel()
 
@@ -501,6 +989,106 @@ func TestAllGroups(t *testing.T) {
 	}
 }
 
+func TestForEachGroup(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		dbFile   string
+		pageSize int
+
+		wantErrType error
+	}{
+		"Get one group":                      {dbFile: "one_user_and_group"},
+		"Get multiple groups":                {dbFile: "multiple_users_and_groups"},
+		"Get groups with one group per page": {dbFile: "multiple_users_and_groups", pageSize: 1},
+		"Get no group":                       {},
+
+		"Get groups rely on groupByID, groupToUsers, UserByID": {dbFile: "partially_valid_multiple_users_and_groups_groupByID_groupToUsers_UserByID", pageSize: 1},
+
+		"Error on some invalid groups entry": {dbFile: "invalid_entries_but_user_and_group1", pageSize: 1, wantErrType: shouldError{}},
+		"Error as missing userByID":          {dbFile: "partially_valid_multiple_users_and_groups_groupByID_groupToUsers", pageSize: 1, wantErrType: shouldError{}},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c, cacheDir := initCache(t, tc.dbFile)
+			if tc.pageSize == 0 {
+				tc.pageSize = 256
+			}
+
+			var got []cache.Group
+			err := cache.ForEachGroupInPagesOf(c, tc.pageSize, func(g cache.Group) error {
+				got = append(got, g)
+				return nil
+			})
+			if tc.wantErrType != nil {
+				requireGetAssertions(t, got, tc.wantErrType, err, c, cacheDir)
+				return
+			}
+			require.NoError(t, err, "ForEachGroup should not return an error, but did")
+
+			want, err := c.AllGroups()
+			require.NoError(t, err, "Setup: could not get all groups")
+			require.Equal(t, want, got, "ForEachGroup should return the same groups as AllGroups")
+		})
+	}
+}
+
+func TestForEachGroupView(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		dbFile   string
+		pageSize int
+
+		wantErrType error
+	}{
+		"Get one group":                      {dbFile: "one_user_and_group"},
+		"Get multiple groups":                {dbFile: "multiple_users_and_groups"},
+		"Get groups with one group per page": {dbFile: "multiple_users_and_groups", pageSize: 1},
+		"Get no group":                       {},
+
+		"Get groups rely on groupByID, groupToUsers, UserByID": {dbFile: "partially_valid_multiple_users_and_groups_groupByID_groupToUsers_UserByID", pageSize: 1},
+
+		"Error on some invalid groups entry": {dbFile: "invalid_entries_but_user_and_group1", pageSize: 1, wantErrType: shouldError{}},
+		"Error as missing userByID":          {dbFile: "partially_valid_multiple_users_and_groups_groupByID_groupToUsers", pageSize: 1, wantErrType: shouldError{}},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c, cacheDir := initCache(t, tc.dbFile)
+			if tc.pageSize == 0 {
+				tc.pageSize = 256
+			}
+
+			var got []cache.Group
+			err := cache.ForEachGroupViewInPagesOf(c, tc.pageSize, func(g cache.Group) error {
+				// The name and the members of the group are only valid during the call.
+				users := g.Users
+				g.Name, g.Users = strings.Clone(g.Name), nil
+				for _, u := range users {
+					g.Users = append(g.Users, strings.Clone(u))
+				}
+				got = append(got, g)
+				return nil
+			})
+			if tc.wantErrType != nil {
+				requireGetAssertions(t, got, tc.wantErrType, err, c, cacheDir)
+				return
+			}
+			require.NoError(t, err, "ForEachGroupView should not return an error, but did")
+
+			want, err := c.AllGroups()
+			require.NoError(t, err, "Setup: could not get all groups")
+			require.Equal(t, want, got, "ForEachGroupView should return the same groups as AllGroups")
+		})
+	}
+}
+
 func TestUpdateBrokerForUser(t *testing.T) {
 	t.Parallel()
 
@@ -532,6 +1120,127 @@ func TestBrokerForUser(t *testing.T) {
 	require.Empty(t, gotID, "BrokerForUser should return empty string when entry does not exist")
 }
 
+func TestNSSSnapshot(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		dbFile     string
+		updateUser *users.UserInfo
+
+		wantNoSnapshot   bool
+		wantSameSnapshot bool
+	}{
+		"Publish snapshot of empty database":                           {},
+		"Publish snapshot of multiple users and groups":                {dbFile: "multiple_users_and_groups"},
+		"Publish new snapshot when a user is updated":                  {dbFile: "one_user_and_group", updateUser: &users.UserInfo{Name: "user1", UID: 1111, Dir: "/home/user1", Shell: "/bin/bash", Groups: []users.GroupInfo{{Name: "group1", GID: ptrValue(11111)}, {Name: "group2", GID: ptrValue(22222)}}}},
+		"Publish new snapshot when a user is added":                    {dbFile: "multiple_users_and_groups", updateUser: &users.UserInfo{Name: "user5", UID: 5555, Dir: "/home/user5", Shell: "/bin/sh", Groups: []users.GroupInfo{{Name: "group5", GID: ptrValue(55555)}, {Name: "group1", GID: ptrValue(11111)}}}},
+		"Do not publish new snapshot when only the last login changes": {dbFile: "one_user_and_group", updateUser: &users.UserInfo{Name: "user1", UID: 1111, Gecos: "User1 gecos\nOn multiple lines", Dir: "/home/user1", Shell: "/bin/bash", Groups: []users.GroupInfo{{Name: "group1", GID: ptrValue(11111)}}}, wantSameSnapshot: true},
+		"Do not publish snapshot of invalid database":                  {dbFile: "invalid_entries_but_user_and_group1", wantNoSnapshot: true},
+		"Do not publish snapshot of inconsistent entries":              {dbFile: "invalid_entry_in_groupToUsers", wantNoSnapshot: true},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			cacheDir := t.TempDir()
+			if tc.dbFile != "" {
+				createDBFile(t, filepath.Join("testdata", tc.dbFile+".db.yaml"), cacheDir)
+			}
+			snapshotPath := filepath.Join(t.TempDir(), "nss.snapshot")
+
+			c, err := cache.New(cacheDir, cache.WithoutCleaningOnNew(), cache.WithNSSSnapshot(snapshotPath))
+			require.NoError(t, err, "Setup: could not create cache")
+			cache.WaitForMaintenanceOnNew(c)
+
+			if tc.wantNoSnapshot {
+				require.NoFileExists(t, snapshotPath, "Snapshot should not have been published")
+				require.NoError(t, c.Close(), "Teardown: could not close cache")
+				return
+			}
+
+			initial, err := cache.ReadNSSSnapshot(snapshotPath)
+			require.NoError(t, err, "Published snapshot should be valid")
+			require.False(t, initial.Stale, "Published snapshot should not be stale")
+
+			fileInfo, err := os.Stat(snapshotPath)
+			require.NoError(t, err, "Failed to stat snapshot")
+			require.Equal(t, fs.FileMode(0644), fileInfo.Mode().Perm(), "Snapshot should be world readable")
+
+			// Keep the initial snapshot open, as a reader would.
+			initialFile, err := os.Open(snapshotPath)
+			require.NoError(t, err, "Setup: could not open snapshot")
+			defer initialFile.Close()
+
+			initialGeneration, err := cache.ReadNSSGeneration(snapshotPath)
+			require.NoError(t, err, "Generation counter should have been created")
+			require.NotZero(t, initialGeneration, "Generation counter should have been incremented")
+
+			if tc.updateUser != nil {
+				err := c.UpdateFromUserInfo(*tc.updateUser)
+				require.NoError(t, err, "Setup: could not update user")
+			}
+
+			wantNewSnapshot := tc.updateUser != nil && !tc.wantSameSnapshot
+			if wantNewSnapshot {
+				// The previous snapshot is withdrawn right away, and the new one is published in the background.
+				require.True(t, readNSSSnapshotFromFile(t, initialFile).Stale, "Previous snapshot should be marked as stale")
+				newSnapshotPublished := func() bool {
+					s, err := cache.ReadNSSSnapshot(snapshotPath)
+					return err == nil && s.Serial > initial.Serial
+				}
+				require.Eventually(t, newSnapshotPublished, 5*time.Second, 10*time.Millisecond, "A new snapshot should have been published")
+			}
+
+			got, err := cache.ReadNSSSnapshot(snapshotPath)
+			require.NoError(t, err, "Published snapshot should be valid")
+			requireNSSSnapshotMatchesCache(t, got, c)
+			if !wantNewSnapshot {
+				require.Equal(t, initial.Serial, got.Serial, "No new snapshot should have been published")
+			}
+			generation, err := cache.ReadNSSGeneration(snapshotPath)
+			require.NoError(t, err, "Generation counter should be readable")
+			if wantNewSnapshot {
+				require.Greater(t, generation, initialGeneration, "Generation counter should be incremented on updates")
+			} else {
+				require.Equal(t, initialGeneration, generation, "Generation counter should not change without updates")
+			}
+
+			require.NoError(t, c.Close(), "Teardown: could not close cache")
+			require.NoFileExists(t, snapshotPath, "Snapshot should be removed when the cache is closed")
+			closedGeneration, err := cache.ReadNSSGeneration(snapshotPath)
+			require.NoError(t, err, "Generation counter should be kept when the cache is closed")
+			require.Greater(t, closedGeneration, generation, "Generation counter should be incremented when the cache is closed")
+		})
+	}
+}
+
+// requireNSSSnapshotMatchesCache checks that the snapshot has the same passwd and group entries as the cache.
+func requireNSSSnapshotMatchesCache(t *testing.T, s cache.NSSSnapshot, c *cache.Cache) {
+	t.Helper()
+
+	allUsers, err := c.AllUsers()
+	require.NoError(t, err, "Setup: could not get all users")
+	var wantUsers []cache.UserPasswdShadow
+	for _, u := range allUsers {
+		wantUsers = append(wantUsers, cache.UserPasswdShadow{Name: u.Name, UID: u.UID, GID: u.GID, Gecos: u.Gecos, Dir: u.Dir, Shell: u.Shell})
+	}
+	require.Equal(t, wantUsers, s.Users, "Snapshot users should match the cache ones")
+
+	wantGroups, err := c.AllGroups()
+	require.NoError(t, err, "Setup: could not get all groups")
+	require.Equal(t, wantGroups, s.Groups, "Snapshot groups should match the cache ones")
+}
+
+// readNSSSnapshotFromFile reads the snapshot opened as f, even if it has been replaced or removed since.
+func readNSSSnapshotFromFile(t *testing.T, f *os.File) cache.NSSSnapshot {
+	t.Helper()
+
+	s, err := cache.ReadNSSSnapshot(fmt.Sprintf("/proc/self/fd/%d", f.Fd()))
+	require.NoError(t, err, "Snapshot should be valid")
+	return s
+}
+
 func createDBFile(t *testing.T, src, destDir string) {
 	t.Helper()
 
@@ -569,13 +1278,18 @@ UserToGroups: {}
 func TestMain(m *testing.M) {
 	testutils.InstallUpdateFlag()
 
-	os.Exit(m.Run())
+	code := m.Run()
+	removeBenchDBs()
+	os.Exit(code)
 }
 
 type shouldError struct{}
 
 func (shouldError) Error() string { return "" }
 
+// errStopIteration is returned by iteration callbacks in tests to stop the iteration.
+var errStopIteration = errors.New("stop iteration")
+
 // initCache returns a new cache ready to be used alongside its cache directory.
 func initCache(t *testing.T, dbFile string) (c *cache.Cache, cacheDir string) {
 	t.Helper()
@@ -591,6 +1305,7 @@ func initCache(t *testing.T, dbFile string) (c *cache.Cache, cacheDir string) {
 	c, err = cache.New(cacheDir, cache.WithExpirationDate(expiration))
 	require.NoError(t, err)
 	t.Cleanup(func() { c.Close() })
+	cache.WaitForMaintenanceOnNew(c)
 
 	return c, cacheDir
 }
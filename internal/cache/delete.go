@@ -17,6 +17,10 @@ func deleteUserFromGroup(buckets map[string]bucketWithName, uid, gid int) error
 		return err
 	}
 
+	if err := deleteGroupMember(buckets, gid, uid); err != nil {
+		return err
+	}
+
 	groupToUsers.UIDs = slices.DeleteFunc(groupToUsers.UIDs, func(id int) bool { return id == uid })
 	if len(groupToUsers.UIDs) > 0 {
 		// Update the group entry with the new list of UIDs
@@ -78,5 +82,6 @@ func deleteUser(buckets map[string]bucketWithName, uid int) (err error) {
 	if err = buckets[userToBrokerBucketName].Delete([]byte(strconv.Itoa(u.UID))); err != nil {
 		panic(fmt.Sprintf("programming error: delete is not allowed in a RO transaction: %v", err))
 	}
+	deleteLastLogin(buckets, u.UID)
 	return nil
 }
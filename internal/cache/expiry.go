@@ -0,0 +1,167 @@
+package cache
+
+import (
+	"bytes"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"log/slog"
+	"strconv"
+	"time"
+)
+
+// The userToLastLogin bucket has the last login time of the users, by UID. It's kept apart from the user records, so
+// that logging in again only rewrites this small record.
+//
+// The userByLastLogin bucket indexes users by last login time, so that expired users can be found without reading
+// every user. Its keys are the last login time, in seconds, followed by the UID, both big-endian so that keys are
+// sorted by time. Its values are empty.
+//
+// The index is derived from the userToLastLogin bucket: the users missing from it are added by the maintenance run in
+// the background after opening the database. This is also when the last login times of the user records of previous
+// versions, which held them, are moved to the userToLastLogin bucket.
+
+// expiryIndexKeyLen is the length of the keys of the userByLastLogin bucket.
+const expiryIndexKeyLen = 12
+
+// expiryIndexKey returns the key of the userByLastLogin bucket for the user.
+func expiryIndexKey(uid int, lastLogin time.Time) []byte {
+	k := make([]byte, expiryIndexKeyLen)
+	// Flipping the sign bit keeps times before the epoch sorted first.
+	binary.BigEndian.PutUint64(k, uint64(lastLogin.Unix())^(1<<63))
+	binary.BigEndian.PutUint32(k[8:], uint32(uid))
+	return k
+}
+
+// expiryIndexKeyTime returns the time, in seconds, of a key of the userByLastLogin bucket.
+func expiryIndexKeyTime(k []byte) int64 {
+	return int64(binary.BigEndian.Uint64(k) ^ (1 << 63))
+}
+
+// updateLastLogin records the last login time of the user, and replaces its entry of the expiry index.
+// It panics if we call it in RO transaction.
+func updateLastLogin(buckets map[string]bucketWithName, uid int, lastLogin time.Time) {
+	previous, err := getFromBucket[time.Time](buckets[userToLastLoginBucketName], uid)
+	if err != nil && !errors.Is(err, NoDataFoundError{}) {
+		slog.Warn(fmt.Sprintf("Could not fetch previous last login time of user %v: %v", uid, err))
+	}
+	if !updateBucket(buckets[userToLastLoginBucketName], uid, lastLogin) {
+		return
+	}
+
+	key := expiryIndexKey(uid, lastLogin)
+	if err == nil {
+		previousKey := expiryIndexKey(uid, previous)
+		if bytes.Equal(previousKey, key) {
+			return
+		}
+		_ = buckets[userByLastLoginBucketName].Delete(previousKey) // No error as we are not in a RO transaction.
+	}
+	if err := buckets[userByLastLoginBucketName].Put(key, nil); err != nil {
+		panic(fmt.Sprintf("programming error: Put is not executed in a RW transaction: %v", err))
+	}
+}
+
+// deleteLastLogin removes the last login time of the user and its entry of the expiry index.
+// It panics if we call it in RO transaction.
+func deleteLastLogin(buckets map[string]bucketWithName, uid int) {
+	lastLogin, err := getFromBucket[time.Time](buckets[userToLastLoginBucketName], uid)
+	if err == nil {
+		_ = buckets[userByLastLoginBucketName].Delete(expiryIndexKey(uid, lastLogin)) // No error as we are not in a RO transaction.
+	}
+	if err := buckets[userToLastLoginBucketName].Delete([]byte(strconv.Itoa(uid))); err != nil {
+		panic(fmt.Sprintf("programming error: delete is not allowed in a RO transaction: %v", err))
+	}
+}
+
+// rebuildExpiryIndex adds the users of the userByID bucket missing from the userByLastLogin one, by batches. The last
+// login time of the records of previous versions is moved to the userToLastLogin bucket first.
+// Invalid users, and users without a last login time, are not indexed.
+func (c *Cache) rebuildExpiryIndex() error {
+	lastLoginOf := func(buckets map[string]bucketWithName, u userDB) (time.Time, bool) {
+		lastLogin, err := getFromBucket[time.Time](buckets[userToLastLoginBucketName], u.UID)
+		if errors.Is(err, NoDataFoundError{}) && !u.LastLogin.IsZero() {
+			return u.LastLogin, true
+		}
+		return lastLogin, err == nil
+	}
+
+	isMissing := func(buckets map[string]bucketWithName, _, value []byte) bool {
+		u, err := decodeRecord[userDB](value)
+		if err != nil {
+			return false
+		}
+		lastLogin, ok := lastLoginOf(buckets, u)
+		return ok && buckets[userByLastLoginBucketName].Get(expiryIndexKey(u.UID, lastLogin)) == nil
+	}
+	index := func(buckets map[string]bucketWithName, keys [][]byte) error {
+		for _, key := range keys {
+			// The user may have been deleted or updated since it was looked for.
+			value := buckets[userByIDBucketName].Get(key)
+			if value == nil {
+				continue
+			}
+			u, err := decodeRecord[userDB](value)
+			if err != nil {
+				continue
+			}
+			lastLogin, ok := lastLoginOf(buckets, u)
+			if !ok {
+				continue
+			}
+			updateBucket(buckets[userToLastLoginBucketName], u.UID, lastLogin)
+			if err := buckets[userByLastLoginBucketName].Put(expiryIndexKey(u.UID, lastLogin), nil); err != nil {
+				return err
+			}
+		}
+		return nil
+	}
+	return c.maintainBucket(userByIDBucketName, isMissing, index)
+}
+
+// expiredUsers returns at most n users which last logged in before expirationDate, ignoring the ones in skip, using the
+// userByLastLogin bucket to only read them. Index entries of missing users, or which don't match their last login time,
+// are removed.
+func expiredUsers(buckets map[string]bucketWithName, expirationDate time.Time, skip map[int]struct{}, n int) (expired []userDB) {
+	var staleKeys [][]byte
+
+	cur := buckets[userByLastLoginBucketName].Cursor()
+	for k, _ := cur.First(); k != nil && len(expired) < n; k, _ = cur.Next() {
+		if len(k) != expiryIndexKeyLen {
+			staleKeys = append(staleKeys, k)
+			continue
+		}
+		// Users who logged in during the second of expirationDate are checked against their last login time.
+		if expiryIndexKeyTime(k) > expirationDate.Unix() {
+			break
+		}
+
+		uid := int(binary.BigEndian.Uint32(k[8:]))
+		if _, ok := skip[uid]; ok {
+			continue
+		}
+		lastLogin, err := getFromBucket[time.Time](buckets[userToLastLoginBucketName], uid)
+		if err != nil || !bytes.Equal(k, expiryIndexKey(uid, lastLogin)) {
+			staleKeys = append(staleKeys, k)
+			continue
+		}
+		if !lastLogin.Before(expirationDate) {
+			continue
+		}
+		u, err := getFromBucket[userDB](buckets[userByIDBucketName], uid)
+		if err != nil {
+			slog.Warn(fmt.Sprintf("Could not get user %q: %v", strconv.Itoa(uid), err))
+			staleKeys = append(staleKeys, k)
+			continue
+		}
+
+		expired = append(expired, u)
+	}
+
+	// Keys can't be modified while iterating over the bucket.
+	for _, k := range staleKeys {
+		_ = buckets[userByLastLoginBucketName].Delete(k) // No error as we are not in a RO transaction.
+	}
+
+	return expired
+}
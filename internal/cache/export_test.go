@@ -1,6 +1,18 @@
 package cache
 
-import "time"
+import (
+	"bytes"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"io"
+	"os"
+	"sort"
+	"strconv"
+	"time"
+
+	"go.etcd.io/bbolt"
+)
 
 // RequestClearDatabase is used in tests for checking the behaviour of the database dynamic clear up.
 func RequestClearDatabase(c *Cache) {
@@ -27,3 +39,219 @@ func WithProcDir(path string) Option {
 		o.procDir = path
 	}
 }
+
+// WaitForMaintenanceOnNew waits for the maintenance of the database run in the background when creating the cache.
+func WaitForMaintenanceOnNew(c *Cache) {
+	<-c.maintained
+}
+
+// DbfromYAMLWithJSONRecords loads a yaml formatted of the buckets into destDir, keeping the records in JSON as stored
+// by previous versions of the database.
+func DbfromYAMLWithJSONRecords(r io.Reader, destDir string) error {
+	return dbfromYAMLWithFormat(r, destDir, true)
+}
+
+// JSONRecordsCount returns the number of records of the database which are not in the binary format.
+func JSONRecordsCount(c *Cache) (n int, err error) {
+	err = c.view(func(tx *bbolt.Tx) error {
+		return tx.ForEach(func(name []byte, bucket *bbolt.Bucket) error {
+			if _, isRecordBucket := recordTypeForBucket[string(name)]; !isRecordBucket {
+				return nil
+			}
+			return bucket.ForEach(func(_, value []byte) error {
+				if len(value) == 0 || value[0] != recordFormatVersion {
+					n++
+				}
+				return nil
+			})
+		})
+	})
+	return n, err
+}
+
+// CleanExpiredUsers removes from the cache the users which last logged in before expirationDate.
+func CleanExpiredUsers(c *Cache, expirationDate time.Time) error {
+	return c.cleanExpiredUsers(expirationDate)
+}
+
+// ExpiryIndexUIDs returns the UIDs of the users in the expiry index, sorted by last login time.
+func ExpiryIndexUIDs(c *Cache) (uids []int, err error) {
+	err = c.view(func(tx *bbolt.Tx) error {
+		return tx.Bucket([]byte(userByLastLoginBucketName)).ForEach(func(key, _ []byte) error {
+			uids = append(uids, int(binary.BigEndian.Uint32(key[8:])))
+			return nil
+		})
+	})
+	return uids, err
+}
+
+// UserRecords returns the records of the user as stored in the UserByID and UserByName buckets.
+func UserRecords(c *Cache, uid int, name string) (byID, byName []byte, err error) {
+	err = c.view(func(tx *bbolt.Tx) error {
+		byID = bytes.Clone(tx.Bucket([]byte(userByIDBucketName)).Get([]byte(strconv.Itoa(uid))))
+		byName = bytes.Clone(tx.Bucket([]byte(userByNameBucketName)).Get([]byte(name)))
+		return nil
+	})
+	return byID, byName, err
+}
+
+// LastLogin returns the last login time of the user, as stored in the UserToLastLogin bucket.
+func LastLogin(c *Cache, uid int) (lastLogin time.Time, err error) {
+	err = c.view(func(tx *bbolt.Tx) error {
+		bucket, err := getBucket(tx, userToLastLoginBucketName)
+		if err != nil {
+			return err
+		}
+		lastLogin, err = getFromBucket[time.Time](bucket, uid)
+		return err
+	})
+	return lastLogin, err
+}
+
+// GroupMembersIndex returns the member names of each group in the group members index.
+func GroupMembersIndex(c *Cache) (members map[int][]string, err error) {
+	members = make(map[int][]string)
+	err = c.view(func(tx *bbolt.Tx) error {
+		return tx.Bucket([]byte(groupMembersBucketName)).ForEach(func(_, value []byte) error {
+			g, err := decodeRecord[groupMembersDB](value)
+			if err != nil {
+				return err
+			}
+			members[g.GID] = g.Names
+			return nil
+		})
+	})
+	return members, err
+}
+
+// ForEachUserInPagesOf is ForEachUser, reading pageSize users in each transaction.
+func ForEachUserInPagesOf(c *Cache, pageSize int, fn func(UserPasswdShadow) error) error {
+	return forEachInPages(c, pageSize, usersPageInTx, fn)
+}
+
+// ForEachGroupInPagesOf is ForEachGroup, reading pageSize groups in each transaction.
+func ForEachGroupInPagesOf(c *Cache, pageSize int, fn func(Group) error) error {
+	return forEachInPages(c, pageSize, groupsPageInTx, fn)
+}
+
+// ForEachUserViewInPagesOf is ForEachUserView, reading pageSize users in each transaction.
+func ForEachUserViewInPagesOf(c *Cache, pageSize int, fn func(UserPasswdShadow) error) error {
+	var p userViewsPage
+	return forEachInPages(c, pageSize, p.read, fn)
+}
+
+// ForEachGroupViewInPagesOf is ForEachGroupView, reading pageSize groups in each transaction.
+func ForEachGroupViewInPagesOf(c *Cache, pageSize int, fn func(Group) error) error {
+	var p groupViewsPage
+	return forEachInPages(c, pageSize, p.read, fn)
+}
+
+// NSSSnapshot is the content of a NSS snapshot, as read in tests.
+type NSSSnapshot struct {
+	Serial uint64
+	Stale  bool
+	Users  []UserPasswdShadow
+	Groups []Group
+}
+
+// ReadNSSSnapshot decodes the NSS snapshot at path, checking that all its entries can be looked up through its indexes.
+func ReadNSSSnapshot(path string) (s NSSSnapshot, err error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return s, err
+	}
+	if len(data) < nssSnapshotHeaderSize || !bytes.Equal(data[:len(nssSnapshotMagic)], []byte(nssSnapshotMagic)) {
+		return s, errors.New("invalid snapshot header")
+	}
+
+	u32 := func(off int) int { return int(binary.LittleEndian.Uint32(data[off:])) }
+	if u32(8) != nssSnapshotVersion || u32(24) != len(data) {
+		return s, errors.New("invalid snapshot version or size")
+	}
+	s.Stale = u32(nssSnapshotStaleFlag) != 0
+	s.Serial = uint64(u32(16)) | uint64(u32(20))<<32
+
+	nUsers, nGroups := u32(28), u32(32)
+	usersOff, groupsOff, membersOff := u32(40), u32(44), u32(48)
+	usersByNameOff, usersByIDOff, groupsByNameOff, groupsByIDOff := u32(52), u32(56), u32(60), u32(64)
+	pool := data[u32(68) : u32(68)+u32(72)]
+	str := func(off int) string { return string(pool[u32(off) : u32(off)+u32(off+4)]) }
+
+	// lookup returns the record indexes of key in the index at off, which must be sorted.
+	lookup := func(off, n int, key uint32) (indexes []int, err error) {
+		keys := make([]uint32, n)
+		for i := range keys {
+			keys[i] = uint32(u32(off + i*nssSnapshotIndexEntrySize))
+		}
+		if !sort.SliceIsSorted(keys, func(i, j int) bool { return keys[i] < keys[j] }) {
+			return nil, fmt.Errorf("index at %d is not sorted", off)
+		}
+		for i := sort.Search(n, func(i int) bool { return keys[i] >= key }); i < n && keys[i] == key; i++ {
+			indexes = append(indexes, u32(off+i*nssSnapshotIndexEntrySize+4))
+		}
+		return indexes, nil
+	}
+	requireIndexed := func(off, n int, key uint32, index int) error {
+		indexes, err := lookup(off, n, key)
+		if err != nil {
+			return err
+		}
+		for _, i := range indexes {
+			if i == index {
+				return nil
+			}
+		}
+		return fmt.Errorf("entry %d is not found with key %d in index at %d", index, key, off)
+	}
+
+	for i := 0; i < nUsers; i++ {
+		off := usersOff + i*nssSnapshotUserRecordSize
+		u := UserPasswdShadow{
+			UID:   u32(off),
+			GID:   u32(off + 4),
+			Name:  str(off + 8),
+			Gecos: str(off + 16),
+			Dir:   str(off + 24),
+			Shell: str(off + 32),
+		}
+		if err := requireIndexed(usersByNameOff, nUsers, nssSnapshotNameHash(u.Name), i); err != nil {
+			return s, err
+		}
+		if err := requireIndexed(usersByIDOff, nUsers, uint32(u.UID), i); err != nil {
+			return s, err
+		}
+		s.Users = append(s.Users, u)
+	}
+
+	for i := 0; i < nGroups; i++ {
+		off := groupsOff + i*nssSnapshotGroupRecordSize
+		g := Group{
+			GID:  u32(off),
+			Name: str(off + 4),
+		}
+		for m := 0; m < u32(off+16); m++ {
+			g.Users = append(g.Users, str(membersOff+(u32(off+12)+m)*nssSnapshotStringRefSize))
+		}
+		if err := requireIndexed(groupsByNameOff, nGroups, nssSnapshotNameHash(g.Name), i); err != nil {
+			return s, err
+		}
+		if err := requireIndexed(groupsByIDOff, nGroups, uint32(g.GID), i); err != nil {
+			return s, err
+		}
+		s.Groups = append(s.Groups, g)
+	}
+
+	return s, nil
+}
+
+// ReadNSSGeneration returns the value of the NSS generation counter of the snapshot at path.
+func ReadNSSGeneration(snapshotPath string) (uint32, error) {
+	data, err := os.ReadFile(snapshotPath + nssGenerationFileSuffix)
+	if err != nil {
+		return 0, err
+	}
+	if len(data) != nssGenerationFileSize {
+		return 0, fmt.Errorf("invalid generation counter size: %d", len(data))
+	}
+	return binary.NativeEndian.Uint32(data), nil
+}
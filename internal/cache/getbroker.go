@@ -6,15 +6,12 @@ import (
 
 // BrokerForUser returns the broker ID assigned to the given username or an error if no entry was found.
 func (c *Cache) BrokerForUser(username string) (brokerID string, err error) {
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-
 	u, err := c.UserByName(username)
 	if err != nil {
 		return "", err
 	}
 
-	err = c.db.View(func(tx *bbolt.Tx) error {
+	err = c.view(func(tx *bbolt.Tx) error {
 		bucket, err := getBucket(tx, userToBrokerBucketName)
 		if err != nil {
 			c.requestClearDatabase()
@@ -1,7 +1,6 @@
 package cache
 
 import (
-	"encoding/json"
 	"errors"
 	"fmt"
 
@@ -27,37 +26,49 @@ func (c *Cache) GroupByName(name string) (Group, error) {
 	return getGroup(c, groupByNameBucketName, name)
 }
 
-// AllGroups returns all groups or an error if the database is corrupted.
-// Upon corruption, clearing the database is requested.
-func (c *Cache) AllGroups() (all []Group, err error) {
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-	err = c.db.View(func(tx *bbolt.Tx) error {
+// UserGroupIDs returns the GIDs of the groups of the user matching this name or an error if the database is corrupted
+// or no entry was found. Upon corruption, clearing the database is requested.
+func (c *Cache) UserGroupIDs(name string) (gids []int, err error) {
+	err = c.view(func(tx *bbolt.Tx) error {
 		buckets, err := getAllBuckets(tx)
 		if err != nil {
 			c.requestClearDatabase()
 			return err
 		}
 
-		return buckets[groupByIDBucketName].ForEach(func(key, value []byte) error {
-			var g groupDB
-			if err := json.Unmarshal(value, &g); err != nil {
-				return fmt.Errorf("can't unmarshal user in bucket %q for key %v: %v", userByIDBucketName, key, err)
+		u, err := getFromBucket[userDB](buckets[userByNameBucketName], name)
+		if err != nil {
+			// no entry is valid, no need to clean the database but return the error.
+			if !errors.Is(err, NoDataFoundError{}) {
+				c.requestClearDatabase()
 			}
+			return err
+		}
 
-			// Get user names in the group.
-			users, err := getUsersInGroup(buckets, g.GID)
-			if err != nil {
-				return err
-			}
+		// we should always get an entry
+		userToGroups, err := getFromBucket[userToGroupsDB](buckets[userToGroupsBucketName], u.UID)
+		if err != nil {
+			c.requestClearDatabase()
+			return err
+		}
+		gids = userToGroups.GIDs
 
-			all = append(all, Group{
-				Name:  g.Name,
-				GID:   g.GID,
-				Users: users,
-			})
-			return nil
-		})
+		return nil
+	})
+
+	if err != nil {
+		return nil, err
+	}
+
+	return gids, nil
+}
+
+// AllGroups returns all groups or an error if the database is corrupted.
+// Upon corruption, clearing the database is requested.
+func (c *Cache) AllGroups() (all []Group, err error) {
+	err = c.view(func(tx *bbolt.Tx) error {
+		all, err = allGroupsInTx(tx)
+		return err
 	})
 
 	if err != nil {
@@ -68,6 +79,78 @@ func (c *Cache) AllGroups() (all []Group, err error) {
 	return all, nil
 }
 
+// ForEachGroup calls fn for each group, in the same order as AllGroups, until fn returns an error.
+// Contrary to AllGroups, groups are read by pages, so that the memory use doesn't depend on the number of groups.
+// Upon corruption, clearing the database is requested.
+func (c *Cache) ForEachGroup(fn func(Group) error) error {
+	return forEachInPages(c, enumerationPageSize, groupsPageInTx, fn)
+}
+
+// allGroupsInTx returns all groups of the groupByID bucket with their members, or an error if any entry is invalid.
+func allGroupsInTx(tx *bbolt.Tx) (all []Group, err error) {
+	buckets, err := getAllBuckets(tx)
+	if err != nil {
+		return nil, err
+	}
+
+	err = buckets[groupByIDBucketName].ForEach(func(key, value []byte) error {
+		g, err := groupFromBucketEntry(buckets, key, value)
+		if err != nil {
+			return err
+		}
+		all = append(all, g)
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	return all, nil
+}
+
+// groupsPageInTx returns at most n groups of the groupByID bucket following the key after, with their members and
+// the key to resume from, or an error if any entry is invalid.
+func groupsPageInTx(tx *bbolt.Tx, after []byte, n int) (page []Group, next []byte, err error) {
+	buckets, err := getAllBuckets(tx)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	next, err = forEachInBucketPage(buckets[groupByIDBucketName], after, n, func(key, value []byte) error {
+		g, err := groupFromBucketEntry(buckets, key, value)
+		if err != nil {
+			return err
+		}
+		page = append(page, g)
+		return nil
+	})
+	if err != nil {
+		return nil, nil, err
+	}
+
+	return page, next, nil
+}
+
+// groupFromBucketEntry decodes an entry of the groupByID bucket and looks up its members.
+func groupFromBucketEntry(buckets map[string]bucketWithName, key, value []byte) (Group, error) {
+	g, err := decodeRecord[groupDB](value)
+	if err != nil {
+		return Group{}, fmt.Errorf("can't unmarshal user in bucket %q for key %v: %v", userByIDBucketName, key, err)
+	}
+
+	// Get user names in the group.
+	users, err := getUsersInGroup(buckets, g.GID)
+	if err != nil {
+		return Group{}, err
+	}
+
+	return Group{
+		Name:  g.Name,
+		GID:   g.GID,
+		Users: users,
+	}, nil
+}
+
 // getGroup returns a group matching the key or an error if the database is corrupted or no entry was found.
 // Upon corruption, clearing the database is requested.
 func getGroup[K int | string](c *Cache, bucketName string, key K) (Group, error) {
@@ -75,9 +158,7 @@ func getGroup[K int | string](c *Cache, bucketName string, key K) (Group, error)
 	var gid int
 	var users []string
 
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-	err := c.db.View(func(tx *bbolt.Tx) error {
+	err := c.view(func(tx *bbolt.Tx) error {
 		buckets, err := getAllBuckets(tx)
 		if err != nil {
 			c.requestClearDatabase()
@@ -119,19 +200,23 @@ func getGroup[K int | string](c *Cache, bucketName string, key K) (Group, error)
 }
 
 // usersInGroup returns all user names in a given group. It returns an error if the database is corrupted.
+// The names are read from the group members index, or from each member record if the group is not indexed.
 func getUsersInGroup(buckets map[string]bucketWithName, gid int) (users []string, err error) {
+	members, err := getFromBucket[groupMembersDB](buckets[groupMembersBucketName], gid)
+	if err == nil {
+		return members.Names, nil
+	}
+	if !errors.Is(err, NoDataFoundError{}) {
+		return nil, err
+	}
+
 	usersInGroup, err := getFromBucket[groupToUsersDB](buckets[groupToUsersBucketName], gid)
 	if err != nil {
 		return nil, err
 	}
-
-	for _, uid := range usersInGroup.UIDs {
-		// we should always get an entry
-		u, err := getFromBucket[userDB](buckets[userByIDBucketName], uid)
-		if err != nil {
-			return nil, err
-		}
-		users = append(users, u.Name)
+	members, err = groupMembersFromUIDs(buckets, usersInGroup)
+	if err != nil {
+		return nil, err
 	}
-	return users, nil
+	return members.Names, nil
 }
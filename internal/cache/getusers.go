@@ -1,7 +1,6 @@
 package cache
 
 import (
-	"encoding/json"
 	"errors"
 	"fmt"
 
@@ -43,38 +42,84 @@ func (c *Cache) UserByName(name string) (UserPasswdShadow, error) {
 // AllUsers returns all users or an error if the database is corrupted.
 // Upon corruption, clearing the database is requested.
 func (c *Cache) AllUsers() (all []UserPasswdShadow, err error) {
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-	err = c.db.View(func(tx *bbolt.Tx) error {
-		bucket, err := getBucket(tx, userByIDBucketName)
+	err = c.view(func(tx *bbolt.Tx) error {
+		all, err = allUsersInTx(tx)
+		return err
+	})
+
+	if err != nil {
+		c.requestClearDatabase()
+		return nil, err
+	}
+
+	return all, nil
+}
+
+// ForEachUser calls fn for each user, in the same order as AllUsers, until fn returns an error.
+// Contrary to AllUsers, users are read by pages, so that the memory use doesn't depend on the number of users.
+// Upon corruption, clearing the database is requested.
+func (c *Cache) ForEachUser(fn func(UserPasswdShadow) error) error {
+	return forEachInPages(c, enumerationPageSize, usersPageInTx, fn)
+}
+
+// allUsersInTx returns all users of the userByID bucket or an error if any entry is invalid.
+func allUsersInTx(tx *bbolt.Tx) (all []UserPasswdShadow, err error) {
+	bucket, err := getBucket(tx, userByIDBucketName)
+	if err != nil {
+		return nil, err
+	}
+
+	err = bucket.ForEach(func(key, value []byte) error {
+		u, err := userFromBucketEntry(key, value)
 		if err != nil {
 			return err
 		}
-
-		return bucket.ForEach(func(key, value []byte) error {
-			var e userDB
-			if err := json.Unmarshal(value, &e); err != nil {
-				return fmt.Errorf("can't unmarshal user in bucket %q for key %v: %v", userByIDBucketName, key, err)
-			}
-			all = append(all, e.toUserPasswdShadow())
-			return nil
-		})
+		all = append(all, u)
+		return nil
 	})
-
 	if err != nil {
-		c.requestClearDatabase()
 		return nil, err
 	}
 
 	return all, nil
 }
 
+// usersPageInTx returns at most n users of the userByID bucket following the key after, with the key to resume from,
+// or an error if any entry is invalid.
+func usersPageInTx(tx *bbolt.Tx, after []byte, n int) (page []UserPasswdShadow, next []byte, err error) {
+	bucket, err := getBucket(tx, userByIDBucketName)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	next, err = forEachInBucketPage(bucket, after, n, func(key, value []byte) error {
+		u, err := userFromBucketEntry(key, value)
+		if err != nil {
+			return err
+		}
+		page = append(page, u)
+		return nil
+	})
+	if err != nil {
+		return nil, nil, err
+	}
+
+	return page, next, nil
+}
+
+// userFromBucketEntry decodes an entry of the userByID bucket.
+func userFromBucketEntry(key, value []byte) (UserPasswdShadow, error) {
+	e, err := decodeRecord[userDB](value)
+	if err != nil {
+		return UserPasswdShadow{}, fmt.Errorf("can't unmarshal user in bucket %q for key %v: %v", userByIDBucketName, key, err)
+	}
+	return e.toUserPasswdShadow(), nil
+}
+
 // getUser returns an user matching the key or an error if the database is corrupted or no entry was found.
 // Upon corruption, clearing the database is requested.
 func getUser[K int | string](c *Cache, bucketName string, key K) (u userDB, err error) {
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-	err = c.db.View(func(tx *bbolt.Tx) error {
+	err = c.view(func(tx *bbolt.Tx) error {
 		bucket, err := getBucket(tx, bucketName)
 		if err != nil {
 			c.requestClearDatabase()
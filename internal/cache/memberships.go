@@ -0,0 +1,136 @@
+package cache
+
+import (
+	"errors"
+	"fmt"
+	"slices"
+	"strconv"
+)
+
+// The groupMembers bucket stores, for each group, the UIDs and names of its members, so that a group lookup is a single
+// read instead of a read of each of its members. The names are packed in a string table, see recordEncoder.strings.
+//
+// It's derived from the groupToUsers and userByID buckets: the groups missing from it, as when opening a database of a
+// previous version, are added by the maintenance run in the background after opening the database. Groups that are
+// not indexed yet, or can't be because some of their member records are invalid, are looked up from the source
+// buckets, so that the error is reported as before.
+
+// setGroupMember adds the user to the members of the group, or updates its name if it's already a member.
+// groupToUsers is the updated entry of the group in the groupToUsers bucket, from which the members are derived if
+// the group was not indexed yet. It panics if we call it in RO transaction.
+func setGroupMember(buckets map[string]bucketWithName, groupToUsers groupToUsersDB, uid int, name string) error {
+	members, err := getFromBucket[groupMembersDB](buckets[groupMembersBucketName], groupToUsers.GID)
+	if errors.Is(err, NoDataFoundError{}) {
+		members, err = groupMembersFromUIDs(buckets, groupToUsers)
+		if err != nil {
+			//nolint:nilerr // The group is not indexed, and the invalid member is reported when reading it.
+			return nil
+		}
+		updateBucket(buckets[groupMembersBucketName], members.GID, members)
+		return nil
+	}
+	if err != nil {
+		return err
+	}
+
+	if i := slices.Index(members.UIDs, uid); i >= 0 {
+		if members.Names[i] == name {
+			return nil
+		}
+		members.Names[i] = name
+	} else {
+		members.UIDs = append(members.UIDs, uid)
+		members.Names = append(members.Names, name)
+	}
+	updateBucket(buckets[groupMembersBucketName], members.GID, members)
+	return nil
+}
+
+// deleteGroupMember removes the user from the members of the group, removing the entry of the group once it has no
+// members. It panics if we call it in RO transaction.
+func deleteGroupMember(buckets map[string]bucketWithName, gid, uid int) error {
+	members, err := getFromBucket[groupMembersDB](buckets[groupMembersBucketName], gid)
+	if errors.Is(err, NoDataFoundError{}) {
+		return nil
+	}
+	if err != nil {
+		return err
+	}
+
+	i := slices.Index(members.UIDs, uid)
+	if i < 0 {
+		return nil
+	}
+	members.UIDs = slices.Delete(members.UIDs, i, i+1)
+	members.Names = slices.Delete(members.Names, i, i+1)
+
+	if len(members.UIDs) > 0 {
+		updateBucket(buckets[groupMembersBucketName], gid, members)
+		return nil
+	}
+	if err := buckets[groupMembersBucketName].Delete([]byte(strconv.Itoa(gid))); err != nil {
+		panic(fmt.Sprintf("programming error: delete is not allowed in a RO transaction: %v", err))
+	}
+	return nil
+}
+
+// rebuildGroupMembersIndex adds the groups of the groupToUsers bucket missing from the groupMembers one, by batches.
+// Groups without members or with invalid records are not indexed, and are not looked at again until the next opening.
+func (c *Cache) rebuildGroupMembersIndex() error {
+	isMissing := func(buckets map[string]bucketWithName, key, value []byte) bool {
+		if buckets[groupMembersBucketName].Get(key) != nil {
+			return false
+		}
+		_, ok := indexableGroupMembers(buckets, value)
+		return ok
+	}
+	index := func(buckets map[string]bucketWithName, keys [][]byte) error {
+		for _, key := range keys {
+			// The group may have been indexed, updated or deleted since it was looked for.
+			if buckets[groupMembersBucketName].Get(key) != nil {
+				continue
+			}
+			value := buckets[groupToUsersBucketName].Get(key)
+			if value == nil {
+				continue
+			}
+			if members, ok := indexableGroupMembers(buckets, value); ok {
+				updateBucket(buckets[groupMembersBucketName], members.GID, members)
+			}
+		}
+		return nil
+	}
+	return c.maintainBucket(groupToUsersBucketName, isMissing, index)
+}
+
+// indexableGroupMembers returns the members of the group of the groupToUsers record, and false if the group can't be
+// indexed because it has no members or some of its records are invalid.
+func indexableGroupMembers(buckets map[string]bucketWithName, groupToUsersRecord []byte) (groupMembersDB, bool) {
+	groupToUsers, err := decodeRecord[groupToUsersDB](groupToUsersRecord)
+	if err != nil || len(groupToUsers.UIDs) == 0 {
+		return groupMembersDB{}, false
+	}
+	members, err := groupMembersFromUIDs(buckets, groupToUsers)
+	if err != nil {
+		return groupMembersDB{}, false
+	}
+	return members, true
+}
+
+// groupMembersFromUIDs returns the members of a group by reading the record of each of its users.
+func groupMembersFromUIDs(buckets map[string]bucketWithName, groupToUsers groupToUsersDB) (members groupMembersDB, err error) {
+	members = groupMembersDB{
+		GID:   groupToUsers.GID,
+		UIDs:  groupToUsers.UIDs,
+		Names: make([]string, 0, len(groupToUsers.UIDs)),
+	}
+	for _, uid := range groupToUsers.UIDs {
+		// we should always get an entry
+		u, err := getFromBucket[userDB](buckets[userByIDBucketName], uid)
+		if err != nil {
+			return groupMembersDB{}, err
+		}
+		members.Names = append(members.Names, u.Name)
+	}
+	return members, nil
+}
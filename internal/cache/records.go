@@ -0,0 +1,425 @@
+package cache
+
+import (
+	"encoding/binary"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"math"
+	"time"
+	"unsafe"
+)
+
+// Records are stored in the buckets in a compact binary format, starting with recordFormatVersion and followed by
+// the fields of the record in declaration order:
+//   - UIDs and GIDs are encoded as little-endian uint32, as in the NSS protocol;
+//   - other integers are encoded as little-endian int64;
+//   - strings and byte slices are prefixed by their length, as an uint32;
+//   - UID and GID lists are prefixed by their number of elements, as an uint32, and packed;
+//   - string lists are string tables: their number of elements and the length of each, as uint32, followed by the
+//     concatenation of all the strings, so that they can be decoded with a single allocation;
+//   - times are encoded as their binary marshaled form, to keep their location.
+//
+// Previous versions of the database stored records in JSON, which always start with '{' or '"'. They are still
+// decoded, and are converted in the background after opening the database.
+const recordFormatVersion byte = 1
+
+// recordTypeForBucket returns a zero value of the record types stored in each bucket.
+var recordTypeForBucket = map[string]any{
+	userByNameBucketName:      userDB{},
+	userByIDBucketName:        userDB{},
+	groupByNameBucketName:     groupDB{},
+	groupByIDBucketName:       groupDB{},
+	userToGroupsBucketName:    userToGroupsDB{},
+	groupToUsersBucketName:    groupToUsersDB{},
+	userToBrokerBucketName:    "",
+	userToLastLoginBucketName: time.Time{},
+}
+
+// encodeRecord returns the binary encoding of the record value.
+func encodeRecord(value any) (data []byte, err error) {
+	e := recordEncoder{buf: []byte{recordFormatVersion}}
+
+	switch v := value.(type) {
+	case userDB:
+		e.id(v.UID)
+		e.id(v.GID)
+		e.string(v.Name)
+		e.string(v.Gecos)
+		e.string(v.Dir)
+		e.string(v.Shell)
+		e.int(v.LastPwdChange)
+		e.int(v.MaxPwdAge)
+		e.int(v.PwdWarnPeriod)
+		e.int(v.PwdInactivity)
+		e.int(v.MinPwdAge)
+		e.int(v.ExpirationDate)
+	case groupDB:
+		e.id(v.GID)
+		e.string(v.Name)
+	case userToGroupsDB:
+		e.id(v.UID)
+		e.ids(v.GIDs)
+	case groupToUsersDB:
+		e.id(v.GID)
+		e.ids(v.UIDs)
+	case groupMembersDB:
+		e.id(v.GID)
+		e.ids(v.UIDs)
+		e.strings(v.Names)
+	case string:
+		e.string(v)
+	case time.Time:
+		t, err := v.MarshalBinary()
+		if err != nil {
+			return nil, err
+		}
+		e.bytes(t)
+	default:
+		return nil, fmt.Errorf("unsupported record type %T", value)
+	}
+
+	if e.err != nil {
+		return nil, fmt.Errorf("can't encode record %+v: %v", value, e.err)
+	}
+	return e.buf, nil
+}
+
+// decodeRecord decodes a record from its binary encoding, or from JSON if it was stored by a previous version.
+func decodeRecord[T any](data []byte) (T, error) {
+	var r T
+
+	if len(data) == 0 || data[0] != recordFormatVersion {
+		err := json.Unmarshal(data, &r)
+		return r, err
+	}
+
+	d := recordDecoder{data: data[1:]}
+	switch v := any(&r).(type) {
+	case *userDB:
+		v.UID = d.id()
+		v.GID = d.id()
+		v.Name = d.string()
+		v.Gecos = d.string()
+		v.Dir = d.string()
+		v.Shell = d.string()
+		v.LastPwdChange = d.int()
+		v.MaxPwdAge = d.int()
+		v.PwdWarnPeriod = d.int()
+		v.PwdInactivity = d.int()
+		v.MinPwdAge = d.int()
+		v.ExpirationDate = d.int()
+	case *groupDB:
+		v.GID = d.id()
+		v.Name = d.string()
+	case *userToGroupsDB:
+		v.UID = d.id()
+		v.GIDs = d.ids()
+	case *groupToUsersDB:
+		v.GID = d.id()
+		v.UIDs = d.ids()
+	case *groupMembersDB:
+		v.GID = d.id()
+		v.UIDs = d.ids()
+		v.Names = d.strings()
+	case *string:
+		*v = d.string()
+	case *time.Time:
+		if t := d.bytes(); d.err == nil {
+			d.err = v.UnmarshalBinary(t)
+		}
+	default:
+		return r, fmt.Errorf("unsupported record type %T", r)
+	}
+
+	if err := d.finish(); err != nil {
+		var zero T
+		return zero, err
+	}
+	return r, nil
+}
+
+// recordFromJSON converts a record of the type stored in bucketName from JSON to its binary encoding.
+func recordFromJSON(bucketName string, data []byte) ([]byte, error) {
+	r, err := decodeRecordOfBucket(bucketName, data)
+	if err != nil {
+		return nil, err
+	}
+	return encodeRecord(r)
+}
+
+// recordToJSON converts a record of the type stored in bucketName from its binary encoding to JSON.
+//
+//nolint:unused // This is used for tests, with methods that are using go linking. Not part of exported API.
+func recordToJSON(bucketName string, data []byte) ([]byte, error) {
+	r, err := decodeRecordOfBucket(bucketName, data)
+	if err != nil {
+		return nil, err
+	}
+	return json.Marshal(r)
+}
+
+// decodeRecordOfBucket decodes a record of the type stored in bucketName.
+func decodeRecordOfBucket(bucketName string, data []byte) (any, error) {
+	switch recordTypeForBucket[bucketName].(type) {
+	case userDB:
+		return decodeRecord[userDB](data)
+	case groupDB:
+		return decodeRecord[groupDB](data)
+	case userToGroupsDB:
+		return decodeRecord[userToGroupsDB](data)
+	case groupToUsersDB:
+		return decodeRecord[groupToUsersDB](data)
+	case string:
+		return decodeRecord[string](data)
+	case time.Time:
+		return decodeRecord[time.Time](data)
+	default:
+		return nil, fmt.Errorf("unknown bucket %q", bucketName)
+	}
+}
+
+// migrateJSONRecords converts the records stored in JSON by previous versions of the database to their binary
+// encoding, by batches. Records that can't be decoded are left untouched, so that reading them still fails.
+func (c *Cache) migrateJSONRecords() error {
+	for _, name := range allBuckets {
+		if _, isRecordBucket := recordTypeForBucket[string(name)]; !isRecordBucket {
+			continue
+		}
+
+		// Records that can't be converted are not looked at again until the next opening.
+		isJSON := func(_ map[string]bucketWithName, _, value []byte) bool {
+			if len(value) > 0 && value[0] == recordFormatVersion {
+				return false
+			}
+			_, err := recordFromJSON(string(name), value)
+			return err == nil
+		}
+		convert := func(buckets map[string]bucketWithName, keys [][]byte) error {
+			return convertJSONRecords(buckets[string(name)], keys)
+		}
+		if err := c.maintainBucket(string(name), isJSON, convert); err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
+// convertJSONRecords converts the records of keys in the bucket which are still stored in JSON.
+func convertJSONRecords(bucket bucketWithName, keys [][]byte) error {
+	for _, key := range keys {
+		value := bucket.Get(key)
+		if value == nil || (len(value) > 0 && value[0] == recordFormatVersion) {
+			// The record was deleted or updated since it was looked for.
+			continue
+		}
+		data, err := recordFromJSON(bucket.name, value)
+		if err != nil {
+			continue
+		}
+		if err := bucket.Put(key, data); err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
+// recordEncoder appends the binary encoding of record fields to its buffer.
+type recordEncoder struct {
+	buf []byte
+	err error
+}
+
+func (e *recordEncoder) id(v int) {
+	if v < 0 || uint64(v) > math.MaxUint32 {
+		e.err = errors.Join(e.err, fmt.Errorf("id %d out of range", v))
+		return
+	}
+	e.buf = binary.LittleEndian.AppendUint32(e.buf, uint32(v))
+}
+
+func (e *recordEncoder) ids(v []int) {
+	e.length(len(v))
+	for _, id := range v {
+		e.id(id)
+	}
+}
+
+func (e *recordEncoder) int(v int) {
+	e.buf = binary.LittleEndian.AppendUint64(e.buf, uint64(int64(v)))
+}
+
+func (e *recordEncoder) string(v string) {
+	e.length(len(v))
+	e.buf = append(e.buf, v...)
+}
+
+func (e *recordEncoder) strings(v []string) {
+	e.length(len(v))
+	for _, s := range v {
+		e.length(len(s))
+	}
+	for _, s := range v {
+		e.buf = append(e.buf, s...)
+	}
+}
+
+func (e *recordEncoder) bytes(v []byte) {
+	e.length(len(v))
+	e.buf = append(e.buf, v...)
+}
+
+func (e *recordEncoder) length(n int) {
+	if uint64(n) > math.MaxUint32 {
+		e.err = errors.Join(e.err, fmt.Errorf("length %d out of range", n))
+		return
+	}
+	e.buf = binary.LittleEndian.AppendUint32(e.buf, uint32(n))
+}
+
+// recordDecoder reads record fields from data. Once an error occurred, every following read returns a zero value.
+type recordDecoder struct {
+	data []byte
+	err  error
+}
+
+func (d *recordDecoder) next(n int) []byte {
+	if d.err != nil {
+		return nil
+	}
+	if len(d.data) < n {
+		d.err = errors.New("truncated record")
+		return nil
+	}
+	b := d.data[:n]
+	d.data = d.data[n:]
+	return b
+}
+
+func (d *recordDecoder) id() int {
+	b := d.next(4)
+	if b == nil {
+		return 0
+	}
+	return int(binary.LittleEndian.Uint32(b))
+}
+
+func (d *recordDecoder) ids() []int {
+	n := d.length()
+	if n == 0 {
+		return nil
+	}
+	if n > len(d.data)/4 {
+		d.err = errors.New("truncated record")
+		return nil
+	}
+	ids := make([]int, 0, n)
+	for i := 0; i < n; i++ {
+		ids = append(ids, d.id())
+	}
+	return ids
+}
+
+func (d *recordDecoder) int() int {
+	b := d.next(8)
+	if b == nil {
+		return 0
+	}
+	return int(int64(binary.LittleEndian.Uint64(b)))
+}
+
+func (d *recordDecoder) string() string {
+	return string(d.bytes())
+}
+
+// view decodes a string referencing the data, which must not be modified while the string is used.
+func (d *recordDecoder) view() string {
+	b := d.bytes()
+	return unsafe.String(unsafe.SliceData(b), len(b))
+}
+
+// strings decodes a string table. The strings are slices of a single copy of the table.
+func (d *recordDecoder) strings() []string {
+	n := d.length()
+	if n == 0 {
+		return nil
+	}
+	if n > len(d.data)/4 {
+		d.err = errors.New("truncated record")
+		return nil
+	}
+	lengths := make([]int, n)
+	total := 0
+	for i := range lengths {
+		lengths[i] = d.length()
+		total += lengths[i]
+	}
+	table := string(d.next(total))
+	if d.err != nil {
+		return nil
+	}
+
+	strs := make([]string, n)
+	for i, l := range lengths {
+		strs[i], table = table[:l], table[l:]
+	}
+	return strs
+}
+
+// stringViews decodes a string table, appending to strs strings referencing the data, which must not be modified
+// while the strings are used.
+func (d *recordDecoder) stringViews(strs []string) []string {
+	n := d.length()
+	if n > len(d.data)/4 {
+		d.err = errors.New("truncated record")
+		return strs
+	}
+	lengths := d.next(4 * n)
+	total := 0
+	for i := 0; i < n; i++ {
+		total += int(binary.LittleEndian.Uint32(lengths[4*i:]))
+	}
+	table := d.next(total)
+	if d.err != nil {
+		return strs
+	}
+
+	for i := 0; i < n; i++ {
+		l := int(binary.LittleEndian.Uint32(lengths[4*i:]))
+		strs = append(strs, unsafe.String(unsafe.SliceData(table), l))
+		table = table[l:]
+	}
+	return strs
+}
+
+// skipIDs skips an UID or GID list.
+func (d *recordDecoder) skipIDs() {
+	n := d.length()
+	if n > len(d.data)/4 {
+		d.err = errors.New("truncated record")
+		return
+	}
+	d.next(4 * n)
+}
+
+func (d *recordDecoder) bytes() []byte {
+	return d.next(d.length())
+}
+
+func (d *recordDecoder) length() int {
+	b := d.next(4)
+	if b == nil {
+		return 0
+	}
+	return int(binary.LittleEndian.Uint32(b))
+}
+
+// finish returns the error which occurred while decoding, or an error if the record has trailing bytes.
+func (d *recordDecoder) finish() error {
+	if d.err == nil && len(d.data) > 0 {
+		d.err = fmt.Errorf("%d trailing bytes", len(d.data))
+	}
+	return d.err
+}
@@ -1,10 +1,14 @@
 package cache
 
 import (
+	"encoding/json"
+	"errors"
+	"fmt"
 	"io"
 	"os/user"
 	"path/filepath"
 	"regexp"
+	"strconv"
 	"strings"
 	"time"
 
@@ -60,9 +64,6 @@ func redactTime(line string) string {
 func (c *Cache) dumpToYaml() (string, error) {
 	d := make(map[string]map[string]string)
 
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-
 	username := "root"
 	currentUser, err := user.Current()
 	if err != nil {
@@ -72,10 +73,24 @@ func (c *Cache) dumpToYaml() (string, error) {
 		username = currentUser.Name
 	}
 
-	if err := c.db.View(func(tx *bbolt.Tx) error {
+	if err := c.view(func(tx *bbolt.Tx) error {
+		lastLogins := tx.Bucket([]byte(userToLastLoginBucketName))
 		return tx.ForEach(func(name []byte, bucket *bbolt.Bucket) error {
+			// The indexes are derived from the other buckets and are rebuilt when loading the database.
+			if string(name) == userByLastLoginBucketName || string(name) == groupMembersBucketName {
+				return nil
+			}
+			// The last login times are dumped in the user records, where previous versions of the database stored them.
+			if string(name) == userToLastLoginBucketName {
+				return nil
+			}
 			d[string(name)] = make(map[string]string)
 			return bucket.ForEach(func(key, value []byte) error {
+				// Records are dumped in JSON to be readable. Invalid ones are dumped as is.
+				if data, err := dumpRecord(string(name), value, lastLogins); err == nil {
+					value = data
+				}
+
 				key = []byte(strings.Replace(string(key), username, "ACTIVE_USER", 1))
 				value = []byte(strings.ReplaceAll(string(value), username, "ACTIVE_USER"))
 
@@ -93,10 +108,68 @@ func (c *Cache) dumpToYaml() (string, error) {
 	return string(content), nil
 }
 
+// dumpRecord returns the JSON of the record value of bucketName. The user records are dumped with their last login time
+// from lastLogins.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func dumpRecord(bucketName string, value []byte, lastLogins *bbolt.Bucket) ([]byte, error) {
+	if bucketName != userByIDBucketName && bucketName != userByNameBucketName {
+		return recordToJSON(bucketName, value)
+	}
+
+	u, err := decodeRecord[userDB](value)
+	if err != nil {
+		return nil, err
+	}
+	if data := lastLogins.Get([]byte(strconv.Itoa(u.UID))); data != nil {
+		if lastLogin, err := decodeRecord[time.Time](data); err == nil {
+			u.LastLogin = lastLogin
+		}
+	}
+	return json.Marshal(u)
+}
+
+// putLastLoginFromJSON stores the last login time of the JSON user record value of bucketName, as stored by previous
+// versions of the database, in the userToLastLogin bucket. The one of the userByID bucket takes precedence.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func putLastLoginFromJSON(tx *bbolt.Tx, bucketName string, value []byte) error {
+	if bucketName != userByIDBucketName && bucketName != userByNameBucketName {
+		return nil
+	}
+
+	u, err := decodeRecord[userDB](value)
+	if err != nil || u.LastLogin.IsZero() {
+		return nil
+	}
+	bucket, err := tx.CreateBucketIfNotExists([]byte(userToLastLoginBucketName))
+	if err != nil {
+		return err
+	}
+	key := []byte(strconv.Itoa(u.UID))
+	if bucketName == userByNameBucketName && bucket.Get(key) != nil {
+		return nil
+	}
+	data, err := encodeRecord(u.LastLogin)
+	if err != nil {
+		return err
+	}
+	return bucket.Put(key, data)
+}
+
 // dbfromYAML loads a yaml formatted of the buckets and dump it into destDir, with its dbname.
 //
 //nolint:unused // This is used for tests, with go linking. Not part of exported API.
 func dbfromYAML(r io.Reader, destDir string) error {
+	return dbfromYAMLWithFormat(r, destDir, false)
+}
+
+// dbfromYAMLWithFormat loads a yaml formatted of the buckets and dump it into destDir, with its dbname.
+// The JSON records of the yaml file are converted to their binary encoding, unless keepJSON is set to create a
+// database of a previous version.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func dbfromYAMLWithFormat(r io.Reader, destDir string, keepJSON bool) error {
 	dbPath := filepath.Join(destDir, dbName)
 	db, err := bbolt.Open(dbPath, 0600, nil)
 	if err != nil {
@@ -145,6 +218,13 @@ func dbfromYAML(r io.Reader, destDir string) error {
 						val = strings.Replace(val, redacted, t, 1)
 					}
 				}
+				// Invalid records are stored as is.
+				if data, err := recordFromJSON(bucketName, []byte(val)); err == nil && !keepJSON {
+					if err := putLastLoginFromJSON(tx, bucketName, []byte(val)); err != nil {
+						return err
+					}
+					val = string(data)
+				}
 				if err := bucket.Put([]byte(key), []byte(val)); err != nil {
 					panic("programming error: put called in a RO transaction")
 				}
@@ -153,3 +233,144 @@ func dbfromYAML(r io.Reader, destDir string) error {
 		return nil
 	})
 }
+
+// The synthetic databases generated for benchmarks have users named benchuser<i>, with UID syntheticUIDBase+i, and
+// groups named benchgroup<j>, with GID syntheticGIDBase+j.
+const (
+	syntheticUIDBase = 1_000_000_000
+	syntheticGIDBase = 1_500_000_000
+
+	// syntheticUsersPerTx is the number of users written per transaction when generating a synthetic database.
+	syntheticUsersPerTx = 10_000
+)
+
+// syntheticUserName returns the name of the user i of a synthetic database.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func syntheticUserName(i int) string {
+	return fmt.Sprintf("benchuser%d", i)
+}
+
+// syntheticUID returns the UID of the user i of a synthetic database.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func syntheticUID(i int) int {
+	return syntheticUIDBase + i
+}
+
+// syntheticGID returns the GID of the group j of a synthetic database.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func syntheticGID(j int) int {
+	return syntheticGIDBase + j
+}
+
+// syntheticGroupName returns the name of the group j of a synthetic database.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func syntheticGroupName(j int) string {
+	return fmt.Sprintf("benchgroup%d", j)
+}
+
+// syntheticUserGroups returns the indexes of the groups of the user i of a synthetic database, the first one being
+// its primary group. Users are spread evenly over the groups.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func syntheticUserGroups(i, nGroups, groupsPerUser int) []int {
+	groupsPerUser = min(groupsPerUser, nGroups)
+	stride := nGroups / groupsPerUser
+
+	groups := make([]int, groupsPerUser)
+	for k := range groups {
+		groups[k] = (i + k*stride) % nGroups
+	}
+	return groups
+}
+
+// generateDB creates in destDir a database of nUsers users, members of groupsPerUser of nGroups groups, for
+// benchmarks. All the users have just logged in.
+//
+//nolint:unused // This is used for tests, with go linking. Not part of exported API.
+func generateDB(destDir string, nUsers, nGroups, groupsPerUser int) (err error) {
+	if nGroups < 1 || groupsPerUser < 1 {
+		return errors.New("synthetic users need at least one group")
+	}
+
+	db, err := openAndInitDB(filepath.Join(destDir, dbName), filepath.Join(destDir, dirtyFlagDbName))
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if closeErr := db.Close(); err == nil {
+			err = closeErr
+		}
+	}()
+
+	lastLogin := time.Now()
+	groupMembers := make([][]int, nGroups)
+	for first := 0; first < nUsers; first += syntheticUsersPerTx {
+		err := db.Update(func(tx *bbolt.Tx) error {
+			buckets, err := getAllBuckets(tx)
+			if err != nil {
+				return err
+			}
+
+			for i := first; i < min(first+syntheticUsersPerTx, nUsers); i++ {
+				uid := syntheticUID(i)
+				var gids []int
+				for _, j := range syntheticUserGroups(i, nGroups, groupsPerUser) {
+					gids = append(gids, syntheticGID(j))
+					groupMembers[j] = append(groupMembers[j], uid)
+				}
+
+				name := syntheticUserName(i)
+				u := userDB{
+					UserPasswdShadow: UserPasswdShadow{
+						Name:           name,
+						UID:            uid,
+						GID:            gids[0],
+						Gecos:          fmt.Sprintf("Benchmark user %d", i),
+						Dir:            "/home/" + name,
+						Shell:          "/bin/bash",
+						LastPwdChange:  -1,
+						MaxPwdAge:      -1,
+						PwdWarnPeriod:  -1,
+						PwdInactivity:  -1,
+						MinPwdAge:      -1,
+						ExpirationDate: -1,
+					},
+					LastLogin: lastLogin,
+				}
+				updateBucket(buckets[userByIDBucketName], uid, u)
+				updateBucket(buckets[userByNameBucketName], name, u)
+				updateLastLogin(buckets, uid, u.LastLogin)
+				updateBucket(buckets[userToGroupsBucketName], uid, userToGroupsDB{UID: uid, GIDs: gids})
+			}
+			return nil
+		})
+		if err != nil {
+			return err
+		}
+	}
+
+	return db.Update(func(tx *bbolt.Tx) error {
+		buckets, err := getAllBuckets(tx)
+		if err != nil {
+			return err
+		}
+
+		for j, uids := range groupMembers {
+			gid := syntheticGID(j)
+			g := groupDB{Name: syntheticGroupName(j), GID: gid}
+			names := make([]string, 0, len(uids))
+			for _, uid := range uids {
+				names = append(names, syntheticUserName(uid-syntheticUIDBase))
+			}
+			updateBucket(buckets[groupByIDBucketName], gid, g)
+			updateBucket(buckets[groupByNameBucketName], g.Name, g)
+			updateBucket(buckets[groupToUsersBucketName], gid, groupToUsersDB{GID: gid, UIDs: uids})
+			updateBucket(buckets[groupMembersBucketName], gid, groupMembersDB{GID: gid, UIDs: uids, Names: names})
+		}
+		return nil
+	})
+}
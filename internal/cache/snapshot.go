@@ -0,0 +1,387 @@
+package cache
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"hash/fnv"
+	"io/fs"
+	"log/slog"
+	"math"
+	"os"
+	"path/filepath"
+	"sort"
+	"sync/atomic"
+	"syscall"
+	"unsafe"
+
+	"github.com/ubuntu/decorate"
+	"go.etcd.io/bbolt"
+)
+
+// The NSS snapshot is a read-only copy of the passwd and group entries of the cache, published in a world-readable
+// file that the NSS module maps in memory, so that lookups don't need any round-trip to the daemon.
+//
+// All integers are little-endian uint32. The file is made of:
+//   - a header of nssSnapshotHeaderSize bytes: the magic, the format version, the stale flag, the 64 bits serial of
+//     the snapshot, the file size, the number of users, groups and members, the offsets of the records, members and
+//     of the four indexes, the offset and size of the string pool;
+//   - the user records, in the same order as AllUsers;
+//   - the group records, in the same order as AllGroups, and the string references of their members;
+//   - the indexes, which are arrays of (key, record index) pairs sorted by key. The key of the name indexes is the
+//     FNV-1a hash of the name, thus entries with the same hash have to be compared by name;
+//   - the string pool. Strings are referenced by (offset in the pool, length) pairs and are not NUL-terminated.
+//
+// A snapshot is never modified once published, apart from its stale flag: it's set after a newer snapshot has been
+// renamed over it, or once it has been withdrawn, so that the readers mapping it know they need to reload it.
+const (
+	nssSnapshotMagic   = "AUTHDNSS"
+	nssSnapshotVersion = 1
+
+	nssSnapshotHeaderSize = 80
+	nssSnapshotStaleFlag  = 12
+
+	nssSnapshotUserRecordSize   = 40
+	nssSnapshotGroupRecordSize  = 24
+	nssSnapshotStringRefSize    = 8
+	nssSnapshotIndexEntrySize   = 8
+	nssSnapshotFilePermissions  = 0644
+	nssSnapshotTempFilesPattern = ".nss-snapshot-*"
+)
+
+// The NSS generation counter is a native-endian uint32 in a file next to the snapshot, mapped in memory by both the
+// daemon and the NSS module. It's incremented after each change of the database content, so that the NSS module can
+// tell whether the results it caches are still valid. Contrary to the snapshot, the file is never replaced.
+const (
+	nssGenerationFileSuffix = ".generation"
+	nssGenerationFileSize   = 4
+)
+
+// WithNSSSnapshot publishes the NSS snapshot of the cache at path after each change of its content.
+func WithNSSSnapshot(path string) Option {
+	return func(o *options) {
+		o.nssSnapshotPath = path
+	}
+}
+
+// nssSnapshot is the publisher of the NSS snapshot of a cache.
+type nssSnapshot struct {
+	path string
+
+	// current is the published snapshot file, kept open to flag it as stale once replaced.
+	current *os.File
+	serial  uint64
+
+	// generation is the memory mapping of the generation counter.
+	generation []byte
+}
+
+// publishNSSSnapshot regenerates the NSS snapshot from the current database content, and increments the generation
+// counter. If it fails, any previous snapshot is withdrawn so that the NSS module falls back to query the daemon.
+func (c *Cache) publishNSSSnapshot() {
+	if c.nssSnapshot.path == "" {
+		return
+	}
+
+	c.nssSnapshotMu.Lock()
+	defer c.nssSnapshotMu.Unlock()
+
+	var data []byte
+	err := c.view(func(tx *bbolt.Tx) (err error) {
+		data, err = c.nssSnapshot.build(tx)
+		return err
+	})
+	if err == nil {
+		err = c.nssSnapshot.replace(data)
+	}
+	if err != nil {
+		slog.Warn(fmt.Sprintf("Could not publish NSS snapshot: %v", err))
+		c.nssSnapshot.withdraw()
+	}
+	c.nssSnapshot.bumpGeneration()
+}
+
+// requestNSSSnapshot withdraws the published NSS snapshot, so that the NSS module queries the daemon until a new one
+// is published, and asks the goroutine to publish it. Requests made while one is pending are coalesced.
+func (c *Cache) requestNSSSnapshot() {
+	if c.nssSnapshot.path == "" {
+		return
+	}
+
+	c.nssSnapshotMu.Lock()
+	c.nssSnapshot.withdraw()
+	c.nssSnapshot.bumpGeneration()
+	c.nssSnapshotMu.Unlock()
+
+	select {
+	case c.doPublishNSSSnapshot <- struct{}{}:
+	default:
+	}
+}
+
+// withdrawNSSSnapshot removes the published NSS snapshot, if any, and releases the generation counter.
+func (c *Cache) withdrawNSSSnapshot() {
+	if c.nssSnapshot.path == "" {
+		return
+	}
+
+	c.nssSnapshotMu.Lock()
+	defer c.nssSnapshotMu.Unlock()
+
+	c.nssSnapshot.withdraw()
+	c.nssSnapshot.bumpGeneration()
+	c.nssSnapshot.unmapGeneration()
+}
+
+// build returns the content of a new snapshot made from the users and groups in tx.
+func (s *nssSnapshot) build(tx *bbolt.Tx) (data []byte, err error) {
+	defer decorate.OnError(&err, "can't build NSS snapshot")
+
+	users, err := allUsersInTx(tx)
+	if err != nil {
+		return nil, err
+	}
+	groups, err := allGroupsInTx(tx)
+	if err != nil {
+		return nil, err
+	}
+
+	var nMembers int
+	for _, g := range groups {
+		nMembers += len(g.Users)
+	}
+
+	usersOff := nssSnapshotHeaderSize
+	groupsOff := usersOff + len(users)*nssSnapshotUserRecordSize
+	membersOff := groupsOff + len(groups)*nssSnapshotGroupRecordSize
+	usersByNameOff := membersOff + nMembers*nssSnapshotStringRefSize
+	usersByIDOff := usersByNameOff + len(users)*nssSnapshotIndexEntrySize
+	groupsByNameOff := usersByIDOff + len(users)*nssSnapshotIndexEntrySize
+	groupsByIDOff := groupsByNameOff + len(groups)*nssSnapshotIndexEntrySize
+	stringsOff := groupsByIDOff + len(groups)*nssSnapshotIndexEntrySize
+
+	var pool []byte
+	appendString := func(b []byte, str string) []byte {
+		b = binary.LittleEndian.AppendUint32(b, uint32(len(pool)))
+		b = binary.LittleEndian.AppendUint32(b, uint32(len(str)))
+		pool = append(pool, str...)
+		return b
+	}
+
+	records := make([]byte, 0, usersByNameOff-usersOff)
+	usersByName := make([]nssSnapshotIndexEntry, 0, len(users))
+	usersByID := make([]nssSnapshotIndexEntry, 0, len(users))
+	for i, u := range users {
+		records = binary.LittleEndian.AppendUint32(records, uint32(u.UID))
+		records = binary.LittleEndian.AppendUint32(records, uint32(u.GID))
+		records = appendString(records, u.Name)
+		records = appendString(records, u.Gecos)
+		records = appendString(records, u.Dir)
+		records = appendString(records, u.Shell)
+
+		usersByName = append(usersByName, nssSnapshotIndexEntry{key: nssSnapshotNameHash(u.Name), index: uint32(i)})
+		usersByID = append(usersByID, nssSnapshotIndexEntry{key: uint32(u.UID), index: uint32(i)})
+	}
+
+	groupsByName := make([]nssSnapshotIndexEntry, 0, len(groups))
+	groupsByID := make([]nssSnapshotIndexEntry, 0, len(groups))
+	var membersIndex int
+	for i, g := range groups {
+		records = binary.LittleEndian.AppendUint32(records, uint32(g.GID))
+		records = appendString(records, g.Name)
+		records = binary.LittleEndian.AppendUint32(records, uint32(membersIndex))
+		records = binary.LittleEndian.AppendUint32(records, uint32(len(g.Users)))
+		records = binary.LittleEndian.AppendUint32(records, 0)
+		membersIndex += len(g.Users)
+
+		groupsByName = append(groupsByName, nssSnapshotIndexEntry{key: nssSnapshotNameHash(g.Name), index: uint32(i)})
+		groupsByID = append(groupsByID, nssSnapshotIndexEntry{key: uint32(g.GID), index: uint32(i)})
+	}
+	for _, g := range groups {
+		for _, name := range g.Users {
+			records = appendString(records, name)
+		}
+	}
+
+	if uint64(stringsOff+len(pool)) > math.MaxUint32 {
+		return nil, fmt.Errorf("snapshot size exceeds %d bytes", uint64(math.MaxUint32))
+	}
+
+	s.serial++
+
+	data = make([]byte, 0, stringsOff+len(pool))
+	data = append(data, nssSnapshotMagic...)
+	for _, v := range []uint32{
+		nssSnapshotVersion,
+		0, // Stale flag.
+		uint32(s.serial), uint32(s.serial >> 32),
+		uint32(stringsOff + len(pool)),
+		uint32(len(users)), uint32(len(groups)), uint32(nMembers),
+		uint32(usersOff), uint32(groupsOff), uint32(membersOff),
+		uint32(usersByNameOff), uint32(usersByIDOff), uint32(groupsByNameOff), uint32(groupsByIDOff),
+		uint32(stringsOff), uint32(len(pool)),
+		0, // Reserved.
+	} {
+		data = binary.LittleEndian.AppendUint32(data, v)
+	}
+	data = append(data, records...)
+	for _, index := range [][]nssSnapshotIndexEntry{usersByName, usersByID, groupsByName, groupsByID} {
+		data = appendNSSSnapshotIndex(data, index)
+	}
+	data = append(data, pool...)
+
+	return data, nil
+}
+
+// replace atomically publishes data as the new snapshot, and flags the previous one as stale.
+func (s *nssSnapshot) replace(data []byte) (err error) {
+	defer decorate.OnError(&err, "can't write NSS snapshot to %q", s.path)
+
+	s.adoptPrevious()
+
+	f, err := os.CreateTemp(filepath.Dir(s.path), nssSnapshotTempFilesPattern)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if err == nil {
+			return
+		}
+		_ = f.Close()
+		_ = os.Remove(f.Name())
+	}()
+
+	if _, err := f.Write(data); err != nil {
+		return err
+	}
+	if err := f.Chmod(nssSnapshotFilePermissions); err != nil {
+		return err
+	}
+	if err := os.Rename(f.Name(), s.path); err != nil {
+		return err
+	}
+
+	s.markCurrentStale()
+	s.current = f
+
+	return nil
+}
+
+// withdraw removes the published snapshot and flags it as stale.
+func (s *nssSnapshot) withdraw() {
+	s.adoptPrevious()
+
+	if err := os.Remove(s.path); err != nil && !errors.Is(err, fs.ErrNotExist) {
+		slog.Warn(fmt.Sprintf("Could not remove NSS snapshot %q: %v", s.path, err))
+	}
+	s.markCurrentStale()
+}
+
+// adoptPrevious opens the snapshot left by a previous instance of the daemon, if any, so that it's flagged as stale
+// once replaced too.
+func (s *nssSnapshot) adoptPrevious() {
+	if s.current != nil {
+		return
+	}
+
+	f, err := os.OpenFile(s.path, os.O_WRONLY, 0)
+	if err != nil {
+		return
+	}
+	s.current = f
+}
+
+// markCurrentStale flags the current snapshot as stale, and closes it.
+func (s *nssSnapshot) markCurrentStale() {
+	if s.current == nil {
+		return
+	}
+
+	if _, err := s.current.WriteAt(binary.LittleEndian.AppendUint32(nil, 1), nssSnapshotStaleFlag); err != nil {
+		slog.Warn(fmt.Sprintf("Could not mark NSS snapshot as stale: %v", err))
+	}
+	_ = s.current.Close()
+	s.current = nil
+}
+
+// bumpGeneration increments the generation counter, mapping it first if needed.
+func (s *nssSnapshot) bumpGeneration() {
+	if s.generation == nil {
+		generation, err := mapNSSGeneration(s.path + nssGenerationFileSuffix)
+		if err != nil {
+			slog.Warn(fmt.Sprintf("Could not map NSS generation counter: %v", err))
+			return
+		}
+		s.generation = generation
+	}
+
+	atomic.AddUint32((*uint32)(unsafe.Pointer(&s.generation[0])), 1)
+}
+
+// unmapGeneration releases the mapping of the generation counter.
+func (s *nssSnapshot) unmapGeneration() {
+	if s.generation == nil {
+		return
+	}
+
+	if err := syscall.Munmap(s.generation); err != nil {
+		slog.Warn(fmt.Sprintf("Could not unmap NSS generation counter: %v", err))
+	}
+	s.generation = nil
+}
+
+// mapNSSGeneration maps the generation counter file at path in memory, creating it if needed.
+// An existing file is kept, as the NSS module of running processes may have mapped it already.
+func mapNSSGeneration(path string) (generation []byte, err error) {
+	defer decorate.OnError(&err, "can't map %q", path)
+
+	f, err := os.OpenFile(path, os.O_RDWR|os.O_CREATE, nssSnapshotFilePermissions)
+	if err != nil {
+		return nil, err
+	}
+	defer f.Close()
+
+	if err := f.Chmod(nssSnapshotFilePermissions); err != nil {
+		return nil, err
+	}
+	fileInfo, err := f.Stat()
+	if err != nil {
+		return nil, err
+	}
+	if fileInfo.Size() != nssGenerationFileSize {
+		if err := f.Truncate(nssGenerationFileSize); err != nil {
+			return nil, err
+		}
+	}
+
+	return syscall.Mmap(int(f.Fd()), 0, nssGenerationFileSize, syscall.PROT_READ|syscall.PROT_WRITE, syscall.MAP_SHARED)
+}
+
+// nssSnapshotIndexEntry is an entry of the snapshot indexes.
+type nssSnapshotIndexEntry struct {
+	key   uint32
+	index uint32
+}
+
+// appendNSSSnapshotIndex appends to data the entries sorted by key, then record index.
+func appendNSSSnapshotIndex(data []byte, entries []nssSnapshotIndexEntry) []byte {
+	sort.Slice(entries, func(i, j int) bool {
+		if entries[i].key != entries[j].key {
+			return entries[i].key < entries[j].key
+		}
+		return entries[i].index < entries[j].index
+	})
+
+	for _, e := range entries {
+		data = binary.LittleEndian.AppendUint32(data, e.key)
+		data = binary.LittleEndian.AppendUint32(data, e.index)
+	}
+	return data
+}
+
+// nssSnapshotNameHash returns the key of name in the snapshot name indexes.
+func nssSnapshotNameHash(name string) uint32 {
+	h := fnv.New32a()
+	_, _ = h.Write([]byte(name))
+	return h.Sum32()
+}
@@ -27,3 +27,35 @@ func DumpToYaml(c *cache.Cache) (string, error)
 //
 //go:linkname DbfromYAML github.com/ubuntu/authd/internal/cache.dbfromYAML
 func DbfromYAML(r io.Reader, destDir string) error
+
+// GenerateDB creates in destDir a database of nUsers users, members of groupsPerUser of nGroups groups, for
+// benchmarks. Use SyntheticUserName, SyntheticUID, SyntheticGroupName and SyntheticGID to find its entries.
+//
+//go:linkname GenerateDB github.com/ubuntu/authd/internal/cache.generateDB
+func GenerateDB(destDir string, nUsers, nGroups, groupsPerUser int) error
+
+// SyntheticUserName returns the name of the user i of a database created by GenerateDB.
+//
+//go:linkname SyntheticUserName github.com/ubuntu/authd/internal/cache.syntheticUserName
+func SyntheticUserName(i int) string
+
+// SyntheticGroupName returns the name of the group j of a database created by GenerateDB.
+//
+//go:linkname SyntheticGroupName github.com/ubuntu/authd/internal/cache.syntheticGroupName
+func SyntheticGroupName(j int) string
+
+// SyntheticUserGroups returns the indexes of the groups of the user i of a database created by GenerateDB, the first
+// one being its primary group.
+//
+//go:linkname SyntheticUserGroups github.com/ubuntu/authd/internal/cache.syntheticUserGroups
+func SyntheticUserGroups(i, nGroups, groupsPerUser int) []int
+
+// SyntheticUID returns the UID of the user i of a database created by GenerateDB.
+//
+//go:linkname SyntheticUID github.com/ubuntu/authd/internal/cache.syntheticUID
+func SyntheticUID(i int) int
+
+// SyntheticGID returns the GID of the group j of a database created by GenerateDB.
+//
+//go:linkname SyntheticGID github.com/ubuntu/authd/internal/cache.syntheticGID
+func SyntheticGID(j int) int
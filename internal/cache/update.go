@@ -1,14 +1,16 @@
 package cache
 
 import (
-	"encoding/json"
+	"bytes"
 	"errors"
 	"fmt"
 	"log/slog"
+	"math"
 	"slices"
 	"strconv"
 	"time"
 
+	"github.com/ubuntu/authd/internal/metrics"
 	"github.com/ubuntu/authd/internal/users"
 	"go.etcd.io/bbolt"
 )
@@ -22,6 +24,15 @@ func (c *Cache) UpdateFromUserInfo(u users.UserInfo) error {
 	if u.Groups[0].GID == nil {
 		return fmt.Errorf("no gid provided for default group %q", u.Groups[0].Name)
 	}
+	// IDs are stored as uint32, as in the NSS protocol.
+	if u.UID < 0 || uint64(u.UID) > math.MaxUint32 {
+		return fmt.Errorf("invalid uid %d for user %s", u.UID, u.Name)
+	}
+	for _, g := range u.Groups {
+		if g.GID != nil && (*g.GID < 0 || uint64(*g.GID) > math.MaxUint32) {
+			return fmt.Errorf("invalid gid %d for group %q", *g.GID, g.Name)
+		}
+	}
 	userDB := userDB{
 		UserPasswdShadow: UserPasswdShadow{
 			Name:           u.Name,
@@ -52,42 +63,60 @@ func (c *Cache) UpdateFromUserInfo(u users.UserInfo) error {
 		})
 	}
 
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-	err := c.db.Update(func(tx *bbolt.Tx) error {
+	// The transaction is batched with concurrent updates, so it can be run more than once: we only request clearing
+	// the database or publish the changes once we know the outcome of the last run.
+	var corrupted, changed bool
+	start := time.Now()
+	err := c.batch(func(tx *bbolt.Tx) error {
+		corrupted, changed = false, false
+
 		buckets, err := getAllBuckets(tx)
 		if err != nil {
-			c.requestClearDatabase()
+			corrupted = true
 			return err
 		}
 
 		previousGroupsForCurrentUser, err := getFromBucket[userToGroupsDB](buckets[userToGroupsBucketName], userDB.UID)
 		// No data is valid and means this is the first insertion.
 		if err != nil && !errors.Is(err, NoDataFoundError{}) {
-			c.requestClearDatabase()
+			corrupted = true
 			return err
 		}
 
 		/* 1. Handle user update */
-		updateUser(buckets, userDB)
+		userChanged := updateUser(buckets, userDB)
 
 		/* 2. Handle groups update */
-		updateGroups(buckets, groupContents)
+		groupsChanged := updateGroups(buckets, groupContents)
 
 		/* 3. Users and groups mapping buckets */
-		if err := updateUsersAndGroups(buckets, userDB.UID, groupContents, previousGroupsForCurrentUser.GIDs); err != nil {
-			c.requestClearDatabase()
+		membershipsChanged, err := updateUsersAndGroups(buckets, userDB.UID, userDB.Name, groupContents, previousGroupsForCurrentUser.GIDs)
+		if err != nil {
+			corrupted = true
 			return err
 		}
 
+		changed = userChanged || groupsChanged || membershipsChanged
 		return nil
 	})
+	metrics.Observe("cache/UpdateFromUserInfo", start)
+	if corrupted {
+		c.requestClearDatabase()
+	}
+	if err != nil {
+		return err
+	}
 
-	return err
+	// Repeated logins only update the last login time, which is not part of the NSS entries.
+	if changed {
+		c.requestNSSSnapshot()
+	}
+	return nil
 }
 
-// updateUser updates both user buckets with userContent. It handles any potential login rename.
-func updateUser(buckets map[string]bucketWithName, userContent userDB) {
+// updateUser updates both user buckets and the last login time with userContent. It handles any potential login
+// rename. It returns whether the user entry changed, not considering its last login time.
+func updateUser(buckets map[string]bucketWithName, userContent userDB) (changed bool) {
 	existingUser, err := getFromBucket[userDB](buckets[userByIDBucketName], userContent.UID)
 	if err != nil && !errors.Is(err, NoDataFoundError{}) {
 		slog.Warn(fmt.Sprintf("Could not fetch previous record for user %v: %v", userContent.UID, err))
@@ -98,13 +127,22 @@ func updateUser(buckets map[string]bucketWithName, userContent userDB) {
 		_ = buckets[userByNameBucketName].Delete([]byte(existingUser.Name)) // No error as we are not in a RO transaction.
 	}
 
-	// Update user buckets
-	updateBucket(buckets[userByIDBucketName], userContent.UID, userContent)
-	updateBucket(buckets[userByNameBucketName], userContent.Name, userContent)
+	// Update user buckets. Their records don't hold the last login time, so they are only written when the user
+	// entry changed.
+	if updateBucket(buckets[userByIDBucketName], userContent.UID, userContent) {
+		changed = true
+	}
+	if updateBucket(buckets[userByNameBucketName], userContent.Name, userContent) {
+		changed = true
+	}
+	updateLastLogin(buckets, userContent.UID, userContent.LastLogin)
+
+	return changed
 }
 
 // updateUser updates both group buckets with groupContent. It handles any potential group rename.
-func updateGroups(buckets map[string]bucketWithName, groupContents []groupDB) {
+// It returns whether any group changed.
+func updateGroups(buckets map[string]bucketWithName, groupContents []groupDB) (changed bool) {
 	for _, groupContent := range groupContents {
 		existingGroup, err := getFromBucket[groupDB](buckets[groupByIDBucketName], groupContent.GID)
 		if err != nil && !errors.Is(err, NoDataFoundError{}) {
@@ -117,30 +155,44 @@ func updateGroups(buckets map[string]bucketWithName, groupContents []groupDB) {
 		}
 
 		// Update group buckets
-		updateBucket(buckets[groupByIDBucketName], groupContent.GID, groupContent)
-		updateBucket(buckets[groupByNameBucketName], groupContent.Name, groupContent)
+		if updateBucket(buckets[groupByIDBucketName], groupContent.GID, groupContent) {
+			changed = true
+		}
+		if updateBucket(buckets[groupByNameBucketName], groupContent.Name, groupContent) {
+			changed = true
+		}
 	}
+
+	return changed
 }
 
-// updateUserAndGroups updates the pivot table for user to groups and group to users. It handles any update
-// to groups uid is not part of anymore.
-func updateUsersAndGroups(buckets map[string]bucketWithName, uid int, groupContents []groupDB, previousGIDs []int) error {
+// updateUserAndGroups updates the pivot table for user to groups and group to users, and the members of the groups
+// with the user name. It handles any update to groups uid is not part of anymore. It returns whether any membership
+// changed.
+func updateUsersAndGroups(buckets map[string]bucketWithName, uid int, name string, groupContents []groupDB, previousGIDs []int) (changed bool, err error) {
 	var currentGIDs []int
 	for _, groupContent := range groupContents {
 		currentGIDs = append(currentGIDs, groupContent.GID)
 		grpToUsers, err := getFromBucket[groupToUsersDB](buckets[groupToUsersBucketName], groupContent.GID)
 		// No data is valid and means that this is the first time we record it.
 		if err != nil && !errors.Is(err, NoDataFoundError{}) {
-			return err
+			return false, err
 		}
 
 		grpToUsers.GID = groupContent.GID
 		if !slices.Contains(grpToUsers.UIDs, uid) {
 			grpToUsers.UIDs = append(grpToUsers.UIDs, uid)
 		}
-		updateBucket(buckets[groupToUsersBucketName], groupContent.GID, grpToUsers)
+		if updateBucket(buckets[groupToUsersBucketName], groupContent.GID, grpToUsers) {
+			changed = true
+		}
+		if err := setGroupMember(buckets, grpToUsers, uid, name); err != nil {
+			return false, err
+		}
+	}
+	if updateBucket(buckets[userToGroupsBucketName], uid, userToGroupsDB{UID: uid, GIDs: currentGIDs}) {
+		changed = true
 	}
-	updateBucket(buckets[userToGroupsBucketName], uid, userToGroupsDB{UID: uid, GIDs: currentGIDs})
 
 	// Remove UID from any groups this user is not part of anymore.
 	for _, previousGID := range previousGIDs {
@@ -148,18 +200,21 @@ func updateUsersAndGroups(buckets map[string]bucketWithName, uid int, groupConte
 			continue
 		}
 		if err := deleteUserFromGroup(buckets, uid, previousGID); err != nil {
-			return err
+			return false, err
 		}
+		changed = true
 	}
 
-	return nil
+	return changed, nil
 }
 
 // updateBucket is a generic function to update any bucket. It panics if we call it in RO transaction.
-func updateBucket[K int | string](bucket bucketWithName, key K, value any) {
-	data, err := json.Marshal(value)
+// Records which are already stored with the same value are not written again, so that repeated updates only touch
+// the pages of records which changed. It returns whether the record was written.
+func updateBucket[K int | string](bucket bucketWithName, key K, value any) (written bool) {
+	data, err := encodeRecord(value)
 	if err != nil {
-		panic(fmt.Sprintf("programming error: %v is not a valid json", err))
+		panic(fmt.Sprintf("programming error: %v", err))
 	}
 
 	// TODO: switch to https://github.com/golang/go/issues/45380 if accepted.
@@ -173,30 +228,41 @@ func updateBucket[K int | string](bucket bucketWithName, key K, value any) {
 		panic(fmt.Sprintf("unhandled type: %T", key))
 	}
 
+	if bytes.Equal(bucket.Get(k), data) {
+		return false
+	}
+
 	if err = bucket.Put(k, data); err != nil {
 		panic(fmt.Sprintf("programming error: Put is not executed in a RW transaction: %v", err))
 	}
+	return true
 }
 
 // UpdateBrokerForUser updates the last broker the user successfully authenticated with.
 func (c *Cache) UpdateBrokerForUser(username, brokerID string) error {
-	c.mu.RLock()
-	defer c.mu.RUnlock()
-
 	u, err := c.UserByName(username)
 	if err != nil {
 		return err
 	}
 
-	err = c.db.Update(func(tx *bbolt.Tx) error {
+	// See UpdateFromUserInfo for why clearing the database is only requested after the batch.
+	var corrupted bool
+	start := time.Now()
+	err = c.batch(func(tx *bbolt.Tx) error {
+		corrupted = false
+
 		bucket, err := getBucket(tx, userToBrokerBucketName)
 		if err != nil {
-			c.requestClearDatabase()
+			corrupted = true
 			return err
 		}
 		updateBucket(bucket, u.UID, brokerID)
 		return nil
 	})
+	metrics.Observe("cache/UpdateBrokerForUser", start)
+	if corrupted {
+		c.requestClearDatabase()
+	}
 
 	return err
 }
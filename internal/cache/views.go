@@ -0,0 +1,189 @@
+package cache
+
+import (
+	"errors"
+	"fmt"
+
+	"go.etcd.io/bbolt"
+)
+
+// Views are entries whose strings reference a copy of their records instead of being allocated for each entry. The
+// records of a page are copied in a buffer which is reused for the next page, as are the entries themselves, so that
+// enumerating all entries only allocates while the buffers grow to the size of the largest page.
+
+// ForEachUserView is ForEachUser, except that the strings of the user passed to fn reference a buffer which is reused
+// for the next users: they are only valid until fn returns, and must be copied to be kept.
+// Upon corruption, clearing the database is requested.
+func (c *Cache) ForEachUserView(fn func(UserPasswdShadow) error) error {
+	var p userViewsPage
+	return forEachInPages(c, enumerationPageSize, p.read, fn)
+}
+
+// ForEachGroupView is ForEachGroup, except that the strings and the member list of the group passed to fn reference
+// buffers which are reused for the next groups: they are only valid until fn returns, and must be copied to be kept.
+// Upon corruption, clearing the database is requested.
+func (c *Cache) ForEachGroupView(fn func(Group) error) error {
+	var p groupViewsPage
+	return forEachInPages(c, enumerationPageSize, p.read, fn)
+}
+
+// recordsBuffer holds the copies of the records read in a transaction, so that views of them can be used after it.
+type recordsBuffer struct {
+	data []byte
+}
+
+// copy appends the record, which is only valid for the lifetime of the transaction, to the buffer and returns its
+// copy. Growing the buffer doesn't invalidate the previous copies, which keep referencing the previous one.
+func (b *recordsBuffer) copy(value []byte) []byte {
+	start := len(b.data)
+	b.data = append(b.data, value...)
+	return b.data[start:]
+}
+
+// reset empties the buffer, invalidating the previous copies.
+func (b *recordsBuffer) reset() {
+	b.data = b.data[:0]
+}
+
+// userViewsPage holds a page of users decoded as views of the copy of their records.
+type userViewsPage struct {
+	records recordsBuffer
+	users   []UserPasswdShadow
+}
+
+// read returns at most n users of the userByID bucket following the key after, with the key to resume from, or an
+// error if any entry is invalid. The returned users are only valid until the next read.
+func (p *userViewsPage) read(tx *bbolt.Tx, after []byte, n int) (page []UserPasswdShadow, next []byte, err error) {
+	bucket, err := getBucket(tx, userByIDBucketName)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	p.records.reset()
+	p.users = p.users[:0]
+	next, err = forEachInBucketPage(bucket, after, n, func(key, value []byte) error {
+		var u UserPasswdShadow
+		if err := decodeUserView(p.records.copy(value), &u); err != nil {
+			return fmt.Errorf("can't unmarshal user in bucket %q for key %v: %v", userByIDBucketName, key, err)
+		}
+		p.users = append(p.users, u)
+		return nil
+	})
+	if err != nil {
+		return nil, nil, err
+	}
+
+	return p.users, next, nil
+}
+
+// groupViewsPage holds a page of groups decoded as views of the copy of their records.
+type groupViewsPage struct {
+	records recordsBuffer
+	groups  []Group
+}
+
+// read returns at most n groups of the groupByID bucket following the key after, with their members and the key to
+// resume from, or an error if any entry is invalid. The returned groups are only valid until the next read.
+func (p *groupViewsPage) read(tx *bbolt.Tx, after []byte, n int) (page []Group, next []byte, err error) {
+	buckets, err := getAllBuckets(tx)
+	if err != nil {
+		return nil, nil, err
+	}
+
+	p.records.reset()
+	p.groups = p.groups[:0]
+	next, err = forEachInBucketPage(buckets[groupByIDBucketName], after, n, func(key, value []byte) error {
+		// Reuse the member list of the group previously decoded at this position.
+		if len(p.groups) < cap(p.groups) {
+			p.groups = p.groups[:len(p.groups)+1]
+		} else {
+			p.groups = append(p.groups, Group{})
+		}
+		g := &p.groups[len(p.groups)-1]
+
+		if err := decodeGroupView(p.records.copy(value), g); err != nil {
+			return fmt.Errorf("can't unmarshal group in bucket %q for key %v: %v", groupByIDBucketName, key, err)
+		}
+		return p.readMembers(buckets, key, g)
+	})
+	if err != nil {
+		return nil, nil, err
+	}
+
+	return p.groups, next, nil
+}
+
+// readMembers sets the members of the group of key from the group members index, or from each member record if the
+// group is not indexed. Both buckets are keyed by GID.
+func (p *groupViewsPage) readMembers(buckets map[string]bucketWithName, key []byte, g *Group) (err error) {
+	bucket := buckets[groupMembersBucketName]
+	members := bucket.Get(key)
+	if members == nil {
+		users, err := getUsersInGroup(buckets, g.GID)
+		if err != nil {
+			return err
+		}
+		g.Users = append(g.Users[:0], users...)
+		return nil
+	}
+
+	g.Users, err = decodeMembersView(p.records.copy(members), g.Users[:0])
+	if err != nil {
+		return fmt.Errorf("can't unmarshal bucket %q for key %v: %v", bucket.name, key, err)
+	}
+	return nil
+}
+
+// decodeUserView decodes a user record into u like decodeRecord, except that its strings reference data instead of
+// being copied.
+func decodeUserView(data []byte, u *UserPasswdShadow) error {
+	if len(data) == 0 || data[0] != recordFormatVersion {
+		r, err := decodeRecord[userDB](data)
+		*u = r.toUserPasswdShadow()
+		return err
+	}
+
+	d := recordDecoder{data: data[1:]}
+	u.UID = d.id()
+	u.GID = d.id()
+	u.Name = d.view()
+	u.Gecos = d.view()
+	u.Dir = d.view()
+	u.Shell = d.view()
+	u.LastPwdChange = d.int()
+	u.MaxPwdAge = d.int()
+	u.PwdWarnPeriod = d.int()
+	u.PwdInactivity = d.int()
+	u.MinPwdAge = d.int()
+	u.ExpirationDate = d.int()
+	return d.finish()
+}
+
+// decodeGroupView decodes a group record into g like decodeRecord, except that its name references data instead of
+// being copied. The members of the group are left untouched.
+func decodeGroupView(data []byte, g *Group) error {
+	if len(data) == 0 || data[0] != recordFormatVersion {
+		r, err := decodeRecord[groupDB](data)
+		g.GID, g.Name = r.GID, r.Name
+		return err
+	}
+
+	d := recordDecoder{data: data[1:]}
+	g.GID = d.id()
+	g.Name = d.view()
+	return d.finish()
+}
+
+// decodeMembersView appends to names the member names of a group members record, referencing data instead of being
+// copied. The index is built by this version, so its records are never stored in JSON.
+func decodeMembersView(data []byte, names []string) ([]string, error) {
+	if len(data) == 0 || data[0] != recordFormatVersion {
+		return nil, errors.New("unsupported record format")
+	}
+
+	d := recordDecoder{data: data[1:]}
+	d.id()
+	d.skipIDs()
+	names = d.stringViews(names)
+	return names, d.finish()
+}
@@ -23,4 +23,7 @@ const (
 
 	// DefaultCacheDir is the default directory for the cache.
 	DefaultCacheDir = "/var/cache/authd/"
+
+	// DefaultNSSSnapshotPath is the default path of the cache snapshot read by the NSS module.
+	DefaultNSSSnapshotPath = "/run/authd-nss.snapshot"
 )
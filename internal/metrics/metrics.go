@@ -0,0 +1,139 @@
+// Package metrics aggregates the latencies of the stages of the authentication path into histograms.
+package metrics
+
+import (
+	"math"
+	"math/bits"
+	"sort"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// nBuckets is the number of buckets of the histograms. Bucket i counts the durations below 2^i microseconds, the last
+// one counting all the longer durations (above about a minute).
+const nBuckets = 27
+
+// Histogram is a latency histogram with power of 2 buckets, safe to update concurrently without locking.
+type Histogram struct {
+	buckets [nBuckets]atomic.Uint64
+	count   atomic.Uint64
+	sum     atomic.Int64
+	max     atomic.Int64
+}
+
+// Summary is a snapshot of a histogram. Quantiles are the upper bounds of the buckets they fall into.
+type Summary struct {
+	Name  string
+	Count uint64
+	Sum   time.Duration
+	P50   time.Duration
+	P99   time.Duration
+	Max   time.Duration
+}
+
+// Observe records a duration.
+func (h *Histogram) Observe(d time.Duration) {
+	if d < 0 {
+		d = 0
+	}
+
+	i := bits.Len64(uint64(d / time.Microsecond))
+	if i >= nBuckets {
+		i = nBuckets - 1
+	}
+	h.buckets[i].Add(1)
+	h.count.Add(1)
+	h.sum.Add(int64(d))
+	for {
+		m := h.max.Load()
+		if int64(d) <= m || h.max.CompareAndSwap(m, int64(d)) {
+			break
+		}
+	}
+}
+
+// Summary returns a snapshot of the histogram, named name.
+func (h *Histogram) Summary(name string) Summary {
+	var counts [nBuckets]uint64
+	var count uint64
+	for i := range h.buckets {
+		counts[i] = h.buckets[i].Load()
+		count += counts[i]
+	}
+	max := time.Duration(h.max.Load())
+
+	return Summary{
+		Name:  name,
+		Count: count,
+		Sum:   time.Duration(h.sum.Load()),
+		P50:   quantile(counts, count, 0.50, max),
+		P99:   quantile(counts, count, 0.99, max),
+		Max:   max,
+	}
+}
+
+// quantile returns the upper bound of the bucket where the q quantile falls, capped to max.
+func quantile(counts [nBuckets]uint64, count uint64, q float64, max time.Duration) time.Duration {
+	if count == 0 {
+		return 0
+	}
+
+	rank := uint64(math.Ceil(q * float64(count)))
+	var cumulated uint64
+	for i, c := range counts {
+		cumulated += c
+		if cumulated < rank {
+			continue
+		}
+		if i == nBuckets-1 {
+			break
+		}
+		return min(time.Duration(1<<i)*time.Microsecond, max)
+	}
+	return max
+}
+
+// Registry is a set of histograms, indexed by name.
+type Registry struct {
+	histograms sync.Map
+}
+
+// DefaultRegistry is the registry filled by the package level functions.
+var DefaultRegistry = &Registry{}
+
+// Histogram returns the histogram named name, creating it if needed.
+func (r *Registry) Histogram(name string) *Histogram {
+	if h, ok := r.histograms.Load(name); ok {
+		return h.(*Histogram)
+	}
+	h, _ := r.histograms.LoadOrStore(name, &Histogram{})
+	return h.(*Histogram)
+}
+
+// Summaries returns a snapshot of all the histograms, sorted by name.
+func (r *Registry) Summaries() (summaries []Summary) {
+	r.histograms.Range(func(name, h any) bool {
+		summaries = append(summaries, h.(*Histogram).Summary(name.(string)))
+		return true
+	})
+	sort.Slice(summaries, func(i, j int) bool { return summaries[i].Name < summaries[j].Name })
+	return summaries
+}
+
+// Observe records in the histogram named name of the default registry the time elapsed since start.
+func Observe(name string, start time.Time) {
+	DefaultRegistry.Histogram(name).Observe(time.Since(start))
+}
+
+// Time starts timing a stage. The returned function records its duration in the histogram named name of the default
+// registry, and is meant to be deferred.
+func Time(name string) (done func()) {
+	start := time.Now()
+	return func() { Observe(name, start) }
+}
+
+// Summaries returns a snapshot of all the histograms of the default registry.
+func Summaries() []Summary {
+	return DefaultRegistry.Summaries()
+}
@@ -0,0 +1,89 @@
+package metrics_test
+
+import (
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+	"github.com/ubuntu/authd/internal/metrics"
+)
+
+func TestHistogramSummary(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		durations []time.Duration
+
+		want metrics.Summary
+	}{
+		"Empty histogram": {},
+
+		"Single duration": {
+			durations: []time.Duration{3 * time.Millisecond},
+			want:      metrics.Summary{Count: 1, Sum: 3 * time.Millisecond, P50: 3 * time.Millisecond, P99: 3 * time.Millisecond, Max: 3 * time.Millisecond},
+		},
+		"Quantiles are the upper bounds of their bucket": {
+			durations: append(repeat(99, 3*time.Microsecond), time.Second),
+			want:      metrics.Summary{Count: 100, Sum: 99*3*time.Microsecond + time.Second, P50: 4 * time.Microsecond, P99: 4 * time.Microsecond, Max: time.Second},
+		},
+		"High quantile follows the slow calls": {
+			durations: append(repeat(90, time.Millisecond), repeat(10, 100*time.Millisecond)...),
+			want:      metrics.Summary{Count: 100, Sum: 90*time.Millisecond + time.Second, P50: 1024 * time.Microsecond, P99: 100 * time.Millisecond, Max: 100 * time.Millisecond},
+		},
+		"Durations longer than the last bucket are reported as the maximum": {
+			durations: []time.Duration{time.Hour},
+			want:      metrics.Summary{Count: 1, Sum: time.Hour, P50: time.Hour, P99: time.Hour, Max: time.Hour},
+		},
+		"Negative durations are counted as 0": {
+			durations: []time.Duration{-time.Second},
+			want:      metrics.Summary{Count: 1},
+		},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			var h metrics.Histogram
+			for _, d := range tc.durations {
+				h.Observe(d)
+			}
+
+			tc.want.Name = "stage"
+			require.Equal(t, tc.want, h.Summary("stage"), "Summary should return the expected values")
+		})
+	}
+}
+
+func TestRegistrySummaries(t *testing.T) {
+	t.Parallel()
+
+	var r metrics.Registry
+	require.Empty(t, r.Summaries(), "Summaries should be empty before any observation")
+
+	var wg sync.WaitGroup
+	for i := 0; i < 10; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			r.Histogram("b").Observe(time.Millisecond)
+			r.Histogram("a").Observe(time.Millisecond)
+		}()
+	}
+	wg.Wait()
+
+	got := r.Summaries()
+	require.Len(t, got, 2, "Summaries should return one entry per histogram")
+	require.Equal(t, "a", got[0].Name, "Summaries should be sorted by name")
+	require.Equal(t, "b", got[1].Name, "Summaries should be sorted by name")
+	require.Equal(t, uint64(10), got[0].Count, "All concurrent observations should be counted")
+	require.Equal(t, uint64(10), got[1].Count, "All concurrent observations should be counted")
+}
+
+func repeat(n int, d time.Duration) (durations []time.Duration) {
+	for i := 0; i < n; i++ {
+		durations = append(durations, d)
+	}
+	return durations
+}
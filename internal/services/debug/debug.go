@@ -0,0 +1,48 @@
+// Package debug implements the debug grpc service protocol to the daemon.
+package debug
+
+import (
+	"context"
+	"time"
+
+	"github.com/ubuntu/authd"
+	"github.com/ubuntu/authd/internal/log"
+	"github.com/ubuntu/authd/internal/metrics"
+)
+
+// Service is the implementation of the debug service.
+type Service struct {
+	registry *metrics.Registry
+	authd.UnimplementedDebugServer
+}
+
+// NewService returns a new debug GRPC service, reporting the latencies aggregated in registry.
+func NewService(ctx context.Context, registry *metrics.Registry) Service {
+	log.Debug(ctx, "Building new GRPC debug service")
+
+	return Service{
+		registry: registry,
+	}
+}
+
+// GetLatencies returns the summaries of the latencies measured since the daemon started.
+func (s Service) GetLatencies(ctx context.Context, _ *authd.Empty) (*authd.Latencies, error) {
+	var r authd.Latencies
+	for _, l := range s.registry.Summaries() {
+		r.Latencies = append(r.Latencies, &authd.Latencies_Latency{
+			Name:  l.Name,
+			Count: l.Count,
+			SumUs: microseconds(l.Sum),
+			P50Us: microseconds(l.P50),
+			P99Us: microseconds(l.P99),
+			MaxUs: microseconds(l.Max),
+		})
+	}
+
+	return &r, nil
+}
+
+// microseconds returns d in microseconds.
+func microseconds(d time.Duration) uint64 {
+	return uint64(d / time.Microsecond)
+}
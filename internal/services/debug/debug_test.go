@@ -0,0 +1,53 @@
+package debug_test
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+	"github.com/ubuntu/authd"
+	"github.com/ubuntu/authd/internal/metrics"
+	"github.com/ubuntu/authd/internal/services/debug"
+)
+
+func TestGetLatencies(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		observations map[string][]time.Duration
+
+		want []*authd.Latencies_Latency
+	}{
+		"Return no latencies when nothing was measured": {},
+
+		"Return latencies in microseconds, sorted by name": {
+			observations: map[string][]time.Duration{
+				"rpc/authd.PAM/SelectBroker":    {3 * time.Millisecond},
+				"broker/Broker/IsAuthenticated": {time.Second, 2 * time.Second},
+			},
+			want: []*authd.Latencies_Latency{
+				{Name: "broker/Broker/IsAuthenticated", Count: 2, SumUs: 3_000_000, P50Us: 1_048_576, P99Us: 2_000_000, MaxUs: 2_000_000},
+				{Name: "rpc/authd.PAM/SelectBroker", Count: 1, SumUs: 3_000, P50Us: 3_000, P99Us: 3_000, MaxUs: 3_000},
+			},
+		},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			registry := &metrics.Registry{}
+			for name, durations := range tc.observations {
+				for _, d := range durations {
+					registry.Histogram(name).Observe(d)
+				}
+			}
+
+			s := debug.NewService(context.Background(), registry)
+			got, err := s.GetLatencies(context.Background(), &authd.Empty{})
+			require.NoError(t, err, "GetLatencies should not return an error, but did")
+			require.Equal(t, tc.want, got.GetLatencies(), "GetLatencies should return the expected latencies")
+		})
+	}
+}
@@ -8,6 +8,8 @@ import (
 	"github.com/ubuntu/authd/internal/brokers"
 	"github.com/ubuntu/authd/internal/cache"
 	"github.com/ubuntu/authd/internal/log"
+	"github.com/ubuntu/authd/internal/metrics"
+	"github.com/ubuntu/authd/internal/services/debug"
 	"github.com/ubuntu/authd/internal/services/nss"
 	"github.com/ubuntu/authd/internal/services/pam"
 	"github.com/ubuntu/decorate"
@@ -21,10 +23,12 @@ type Manager struct {
 	brokerManager *brokers.Manager
 	pamService    pam.Service
 	nssService    nss.Service
+	debugService  debug.Service
 }
 
 // NewManager returns a new manager after creating all necessary items for our business logic.
-func NewManager(ctx context.Context, cacheDir, brokersConfPath string, configuredBrokers []string) (m Manager, err error) {
+// The cache snapshot for the NSS module is published at nssSnapshotPath, if not empty.
+func NewManager(ctx context.Context, cacheDir, nssSnapshotPath, brokersConfPath string, configuredBrokers []string) (m Manager, err error) {
 	defer decorate.OnError(&err /*i18n.G(*/, "can't create authd object") //)
 
 	log.Debug(ctx, "Building authd object")
@@ -34,34 +38,53 @@ func NewManager(ctx context.Context, cacheDir, brokersConfPath string, configure
 		return m, err
 	}
 
-	c, err := cache.New(cacheDir)
+	c, err := cache.New(cacheDir, cache.WithNSSSnapshot(nssSnapshotPath))
 	if err != nil {
 		return m, err
 	}
 
 	nssService := nss.NewService(ctx, c)
 	pamService := pam.NewService(ctx, c, brokerManager)
+	debugService := debug.NewService(ctx, metrics.DefaultRegistry)
 
 	return Manager{
 		cache:         c,
 		brokerManager: brokerManager,
 		nssService:    nssService,
 		pamService:    pamService,
+		debugService:  debugService,
 	}, nil
 }
 
-// RegisterGRPCServices returns a new grpc Server after registering both NSS and PAM services.
+// RegisterGRPCServices returns a new grpc Server after registering the NSS, PAM and debug services.
+// The latency of each call is recorded for the debug service.
 func (m Manager) RegisterGRPCServices(ctx context.Context) *grpc.Server {
 	log.Debug(ctx, "Registering GRPC services")
 
-	grpcServer := grpc.NewServer()
+	grpcServer := grpc.NewServer(
+		grpc.UnaryInterceptor(observeUnaryCall),
+		grpc.StreamInterceptor(observeStreamCall),
+	)
 
 	authd.RegisterNSSServer(grpcServer, m.nssService)
 	authd.RegisterPAMServer(grpcServer, m.pamService)
+	authd.RegisterDebugServer(grpcServer, m.debugService)
 
 	return grpcServer
 }
 
+// observeUnaryCall records the duration of the unary RPCs.
+func observeUnaryCall(ctx context.Context, req any, info *grpc.UnaryServerInfo, handler grpc.UnaryHandler) (any, error) {
+	defer metrics.Time("rpc" + info.FullMethod)()
+	return handler(ctx, req)
+}
+
+// observeStreamCall records the duration of the streaming RPCs.
+func observeStreamCall(srv any, ss grpc.ServerStream, info *grpc.StreamServerInfo, handler grpc.StreamHandler) error {
+	defer metrics.Time("rpc" + info.FullMethod)()
+	return handler(srv, ss)
+}
+
 // stop stops the underlying cache.
 func (m *Manager) stop() error {
 	slog.Debug("Closing grpc manager and cache")
@@ -57,14 +57,25 @@ func (s Service) GetPasswdEntries(ctx context.Context, req *authd.Empty) (*authd
 		return nil, err
 	}
 
-	var r authd.PasswdEntries
-	for _, u := range allUsers {
-		r.Entries = append(r.Entries, newPasswdEntryFromUserPasswdShadow(u))
+	// The entries are allocated at once, instead of one at a time.
+	entries := make([]authd.PasswdEntry, len(allUsers))
+	r := authd.PasswdEntries{Entries: make([]*authd.PasswdEntry, len(allUsers))}
+	for i, u := range allUsers {
+		setPasswdEntry(&entries[i], u)
+		r.Entries[i] = &entries[i]
 	}
 
 	return &r, nil
 }
 
+// StreamPasswdEntries sends all passwd entries, one at a time.
+// The users are read as views, without allocating their strings, and each of them is sent in its own message.
+func (s Service) StreamPasswdEntries(req *authd.Empty, stream authd.NSS_StreamPasswdEntriesServer) error {
+	return s.cache.ForEachUserView(func(u cache.UserPasswdShadow) error {
+		return stream.Send(newPasswdEntryFromUserPasswdShadow(u))
+	})
+}
+
 // GetGroupByName returns the group entry for the given group name.
 func (s Service) GetGroupByName(ctx context.Context, req *authd.GetByNameRequest) (*authd.GroupEntry, error) {
 	if req.GetName() == "" {
@@ -95,9 +106,38 @@ func (s Service) GetGroupEntries(ctx context.Context, req *authd.Empty) (*authd.
 		return nil, err
 	}
 
-	var r authd.GroupEntries
-	for _, g := range allGroups {
-		r.Entries = append(r.Entries, newGroupEntryFromGroup(g))
+	// The entries are allocated at once, instead of one at a time.
+	entries := make([]authd.GroupEntry, len(allGroups))
+	r := authd.GroupEntries{Entries: make([]*authd.GroupEntry, len(allGroups))}
+	for i, g := range allGroups {
+		setGroupEntry(&entries[i], g)
+		r.Entries[i] = &entries[i]
+	}
+
+	return &r, nil
+}
+
+// StreamGroupEntries sends all group entries, one at a time.
+// The groups are read as views, and each of them is sent in its own message.
+func (s Service) StreamGroupEntries(req *authd.Empty, stream authd.NSS_StreamGroupEntriesServer) error {
+	return s.cache.ForEachGroupView(func(g cache.Group) error {
+		return stream.Send(newGroupEntryFromGroup(g))
+	})
+}
+
+// GetUserGroups returns the GIDs of the groups of the given username.
+func (s Service) GetUserGroups(ctx context.Context, req *authd.GetByNameRequest) (*authd.UserGroups, error) {
+	if req.GetName() == "" {
+		return nil, status.Error(codes.InvalidArgument, "no user name provided")
+	}
+	gids, err := s.cache.UserGroupIDs(req.GetName())
+	if err != nil {
+		return nil, noDataFoundErrorToGRPCError(err)
+	}
+
+	r := authd.UserGroups{Gids: make([]uint32, 0, len(gids))}
+	for _, gid := range gids {
+		r.Gids = append(r.Gids, uint32(gid))
 	}
 
 	return &r, nil
@@ -123,49 +163,75 @@ func (s Service) GetShadowEntries(ctx context.Context, req *authd.Empty) (*authd
 		return nil, err
 	}
 
-	var r authd.ShadowEntries
-	for _, u := range allUsers {
-		r.Entries = append(r.Entries, newShadowEntryFromUserPasswdShadow(u))
+	// The entries are allocated at once, instead of one at a time.
+	entries := make([]authd.ShadowEntry, len(allUsers))
+	r := authd.ShadowEntries{Entries: make([]*authd.ShadowEntry, len(allUsers))}
+	for i, u := range allUsers {
+		setShadowEntry(&entries[i], u)
+		r.Entries[i] = &entries[i]
 	}
 
 	return &r, nil
 }
 
+// StreamShadowEntries sends all shadow entries, one at a time.
+// The users are read as views, and each of them is sent in its own message.
+func (s Service) StreamShadowEntries(req *authd.Empty, stream authd.NSS_StreamShadowEntriesServer) error {
+	return s.cache.ForEachUserView(func(u cache.UserPasswdShadow) error {
+		return stream.Send(newShadowEntryFromUserPasswdShadow(u))
+	})
+}
+
 // newPasswdEntryFromUserPasswdShadow returns a PasswdEntry from UserPasswdShadow.
 func newPasswdEntryFromUserPasswdShadow(u cache.UserPasswdShadow) *authd.PasswdEntry {
-	return &authd.PasswdEntry{
-		Name:    u.Name,
-		Passwd:  "x",
-		Uid:     uint32(u.UID),
-		Gid:     uint32(u.GID),
-		Gecos:   u.Gecos,
-		Homedir: u.Dir,
-		Shell:   u.Shell,
-	}
+	var e authd.PasswdEntry
+	setPasswdEntry(&e, u)
+	return &e
+}
+
+// setPasswdEntry sets all the fields of the PasswdEntry from UserPasswdShadow.
+func setPasswdEntry(e *authd.PasswdEntry, u cache.UserPasswdShadow) {
+	e.Name = u.Name
+	e.Passwd = "x"
+	e.Uid = uint32(u.UID)
+	e.Gid = uint32(u.GID)
+	e.Gecos = u.Gecos
+	e.Homedir = u.Dir
+	e.Shell = u.Shell
 }
 
 // newGroupEntryFromGroup returns a GroupEntry from a Group.
 func newGroupEntryFromGroup(g cache.Group) *authd.GroupEntry {
-	return &authd.GroupEntry{
-		Name:    g.Name,
-		Passwd:  "x",
-		Gid:     uint32(g.GID),
-		Members: g.Users,
-	}
+	var e authd.GroupEntry
+	setGroupEntry(&e, g)
+	return &e
+}
+
+// setGroupEntry sets all the fields of the GroupEntry from a Group.
+func setGroupEntry(e *authd.GroupEntry, g cache.Group) {
+	e.Name = g.Name
+	e.Passwd = "x"
+	e.Gid = uint32(g.GID)
+	e.Members = g.Users
 }
 
 // newShadowEntryFromUserPasswdShadow returns a ShadowEntry from UserPasswdShadow.
 func newShadowEntryFromUserPasswdShadow(u cache.UserPasswdShadow) *authd.ShadowEntry {
-	return &authd.ShadowEntry{
-		Name:               u.Name,
-		Passwd:             "x",
-		LastChange:         int32(u.LastPwdChange),
-		ChangeMinDays:      int32(u.MinPwdAge),
-		ChangeMaxDays:      int32(u.MaxPwdAge),
-		ChangeWarnDays:     int32(u.PwdWarnPeriod),
-		ChangeInactiveDays: int32(u.PwdInactivity),
-		ExpireDate:         int32(u.ExpirationDate),
-	}
+	var e authd.ShadowEntry
+	setShadowEntry(&e, u)
+	return &e
+}
+
+// setShadowEntry sets all the fields of the ShadowEntry from UserPasswdShadow.
+func setShadowEntry(e *authd.ShadowEntry, u cache.UserPasswdShadow) {
+	e.Name = u.Name
+	e.Passwd = "x"
+	e.LastChange = int32(u.LastPwdChange)
+	e.ChangeMinDays = int32(u.MinPwdAge)
+	e.ChangeMaxDays = int32(u.MaxPwdAge)
+	e.ChangeWarnDays = int32(u.PwdWarnPeriod)
+	e.ChangeInactiveDays = int32(u.PwdInactivity)
+	e.ExpireDate = int32(u.ExpirationDate)
 }
 
 // noDataFoundErrorToGRPCError converts a data not found to proper GRPC status code.
@@ -2,8 +2,10 @@ package nss_test
 
 import (
 	"context"
+	"errors"
 	"flag"
 	"fmt"
+	"io"
 	"net"
 	"os"
 	"path/filepath"
@@ -123,6 +125,36 @@ func TestGetPasswdEntries(t *testing.T) {
 	}
 }
 
+func TestStreamPasswdEntries(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		sourceDB string
+
+		wantErr bool
+	}{
+		"Return all users": {},
+		"Return no users":  {sourceDB: "empty.db.yaml"},
+
+		"Error in database fetched content": {sourceDB: "invalid.db.yaml", wantErr: true},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c := newCacheForTests(t, tc.sourceDB)
+			client := newNSSClient(t, c)
+
+			stream, err := client.StreamPasswdEntries(context.Background(), &authd.Empty{})
+			require.NoError(t, err, "Setup: could not start the stream")
+
+			got, err := receiveAll[authd.PasswdEntry](stream)
+			requireExpectedEntriesResult(t, "StreamPasswdEntries", got, err, tc.wantErr)
+		})
+	}
+}
+
 func TestGetGroupByName(t *testing.T) {
 	t.Parallel()
 
@@ -213,6 +245,67 @@ func TestGetGroupEntries(t *testing.T) {
 	}
 }
 
+func TestStreamGroupEntries(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		sourceDB string
+
+		wantErr bool
+	}{
+		"Return all groups": {},
+		"Return no groups":  {sourceDB: "empty.db.yaml"},
+
+		"Error in database fetched content": {sourceDB: "invalid.db.yaml", wantErr: true},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c := newCacheForTests(t, tc.sourceDB)
+			client := newNSSClient(t, c)
+
+			stream, err := client.StreamGroupEntries(context.Background(), &authd.Empty{})
+			require.NoError(t, err, "Setup: could not start the stream")
+
+			got, err := receiveAll[authd.GroupEntry](stream)
+			requireExpectedEntriesResult(t, "StreamGroupEntries", got, err, tc.wantErr)
+		})
+	}
+}
+
+func TestGetUserGroups(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		username string
+
+		sourceDB string
+
+		wantErr          bool
+		wantErrNotExists bool
+	}{
+		"Return groups of existing user": {username: "user2"},
+
+		"Error in database fetched content":                      {username: "user2", sourceDB: "invalid.db.yaml", wantErr: true},
+		"Error with typed GRPC notfound code on unexisting user": {username: "does-not-exists", wantErr: true, wantErrNotExists: true},
+		"Error on missing name":                                  {wantErr: true},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c := newCacheForTests(t, tc.sourceDB)
+			client := newNSSClient(t, c)
+
+			got, err := client.GetUserGroups(context.Background(), &authd.GetByNameRequest{Name: tc.username})
+			requireExpectedResult(t, "GetUserGroups", got, err, tc.wantErr, tc.wantErrNotExists)
+		})
+	}
+}
+
 func TestGetShadowByName(t *testing.T) {
 	t.Parallel()
 
@@ -271,6 +364,36 @@ func TestGetShadowEntries(t *testing.T) {
 	}
 }
 
+func TestStreamShadowEntries(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		sourceDB string
+
+		wantErr bool
+	}{
+		"Return all users": {},
+		"Return no users":  {sourceDB: "empty.db.yaml"},
+
+		"Error in database fetched content": {sourceDB: "invalid.db.yaml", wantErr: true},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			c := newCacheForTests(t, tc.sourceDB)
+			client := newNSSClient(t, c)
+
+			stream, err := client.StreamShadowEntries(context.Background(), &authd.Empty{})
+			require.NoError(t, err, "Setup: could not start the stream")
+
+			got, err := receiveAll[authd.ShadowEntry](stream)
+			requireExpectedEntriesResult(t, "StreamShadowEntries", got, err, tc.wantErr)
+		})
+	}
+}
+
 // newNSSClient returns a new GRPC PAM client for tests connected to the global brokerManager with the given cache.
 func newNSSClient(t *testing.T, c *cache.Cache) (client authd.NSSClient) {
 	t.Helper()
@@ -330,8 +453,22 @@ func newCacheForTests(t *testing.T, sourceDB string) *cache.Cache {
 	return c
 }
 
+// receiveAll returns all the entries received from stream until it ends.
+func receiveAll[T any](stream interface{ Recv() (*T, error) }) (entries []*T, err error) {
+	for {
+		e, err := stream.Recv()
+		if errors.Is(err, io.EOF) {
+			return entries, nil
+		}
+		if err != nil {
+			return nil, err
+		}
+		entries = append(entries, e)
+	}
+}
+
 // requireExpectedResult asserts expected behaviour from any get* NSS requests and can update them from golden content.
-func requireExpectedResult[T authd.PasswdEntry | authd.GroupEntry | authd.ShadowEntry](t *testing.T, funcName string, got *T, err error, wantErr, wantErrNotExists bool) {
+func requireExpectedResult[T authd.PasswdEntry | authd.GroupEntry | authd.ShadowEntry | authd.UserGroups](t *testing.T, funcName string, got *T, err error, wantErr, wantErrNotExists bool) {
 	t.Helper()
 
 	if wantErr {
@@ -374,7 +511,7 @@ func requireExpectedEntriesResult[T authd.PasswdEntry | authd.GroupEntry | authd
 // requireExportedEquals compare *want to *got, only using the exported fields.
 // It helps ensuring that we don’t end up in a lockcopy vetting warning when we directly
 // compare the exported fields with require.EqualExportedValues.
-func requireExportedEquals[T authd.PasswdEntry | authd.GroupEntry | authd.ShadowEntry](t *testing.T, want *T, got *T, msg string) {
+func requireExportedEquals[T authd.PasswdEntry | authd.GroupEntry | authd.ShadowEntry | authd.UserGroups](t *testing.T, want *T, got *T, msg string) {
 	t.Helper()
 
 	data, err := yaml.Marshal(got)
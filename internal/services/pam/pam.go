@@ -174,6 +174,79 @@ func (s Service) SelectAuthenticationMode(ctx context.Context, req *authd.SAMReq
 	}, nil
 }
 
+// BeginAuthentication starts a new session for the user with the requested broker, or with its previous broker if
+// none is requested, and selects the first authentication mode the broker supports for the given UI layouts.
+// It replaces the SelectBroker, GetAuthenticationModes and SelectAuthenticationMode round trips of non interactive
+// flows. The session is ended if any of those steps fail.
+func (s Service) BeginAuthentication(ctx context.Context, req *authd.BARequest) (resp *authd.BAResponse, err error) {
+	defer decorate.OnError(&err, "can't begin authentication")
+
+	username := req.GetUsername()
+	if username == "" {
+		return nil, status.Error(codes.InvalidArgument, "no user name provided")
+	}
+
+	brokerID := req.GetBrokerId()
+	if brokerID == "" {
+		gpbResp, err := s.GetPreviousBroker(ctx, &authd.GPBRequest{Username: username})
+		if err != nil {
+			return nil, err
+		}
+		brokerID = gpbResp.GetPreviousBroker()
+	}
+	if brokerID == "" {
+		return nil, status.Error(codes.FailedPrecondition, "no broker requested and no previous broker for user")
+	}
+
+	sbResp, err := s.SelectBroker(ctx, &authd.SBRequest{
+		BrokerId: brokerID,
+		Username: username,
+		Lang:     req.GetLang(),
+	})
+	if err != nil {
+		return nil, err
+	}
+	sessionID := sbResp.GetSessionId()
+	defer func() {
+		if err == nil {
+			return
+		}
+		if err := s.brokerManager.EndSession(sessionID); err != nil {
+			log.Infof(ctx, "Could not end session %q: %v", sessionID, err)
+		}
+	}()
+
+	gamResp, err := s.GetAuthenticationModes(ctx, &authd.GAMRequest{
+		SessionId:          sessionID,
+		SupportedUiLayouts: req.GetSupportedUiLayouts(),
+	})
+	if err != nil {
+		return nil, err
+	}
+	authModes := gamResp.GetAuthenticationModes()
+	if len(authModes) == 0 {
+		return nil, status.Error(codes.FailedPrecondition, "no supported authentication mode available for this broker")
+	}
+
+	authModeID := authModes[0].GetId()
+	samResp, err := s.SelectAuthenticationMode(ctx, &authd.SAMRequest{
+		SessionId:            sessionID,
+		AuthenticationModeId: authModeID,
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	return &authd.BAResponse{
+		BrokerId:             brokerID,
+		SessionId:            sessionID,
+		EncryptionKey:        sbResp.GetEncryptionKey(),
+		AuthenticationModes:  authModes,
+		AuthenticationModeId: authModeID,
+		UiLayoutInfo:         samResp.GetUiLayoutInfo(),
+	}, nil
+}
+
 // IsAuthenticated returns broker answer to authentication request.
 func (s Service) IsAuthenticated(ctx context.Context, req *authd.IARequest) (resp *authd.IAResponse, err error) {
 	defer decorate.OnError(&err, "can't check authentication")
@@ -328,6 +328,95 @@ func TestSelectAuthenticationMode(t *testing.T) {
 	}
 }
 
+func TestBeginAuthentication(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		// These are the function arguments.
+		brokerID           string
+		username           string
+		supportedUILayouts []*authd.UILayout
+
+		// These are auxiliary inputs that affect the test setup and help control the mock output.
+		withPreviousBroker bool
+
+		// This is the expected return.
+		wantErr bool
+	}{
+		"Successfully begin authentication":                             {username: "SAM_success_required_entry"},
+		"Successfully begin authentication with the previous broker":    {username: "SAM_success_required_entry", brokerID: "-", withPreviousBroker: true},
+		"Successfully begin authentication with missing optional value": {username: "SAM_missing_optional_entry", supportedUILayouts: []*authd.UILayout{optionalEntry}},
+
+		"Error when username is empty":                      {wantErr: true},
+		"Error when there is no broker nor previous broker": {username: "no broker", brokerID: "-", wantErr: true},
+		"Error when broker does not exist":                  {username: "no broker", brokerID: "does not exist", wantErr: true},
+		"Error when starting the session":                   {username: "NS_error", wantErr: true},
+		"Error when passing invalid layout":                 {username: "success", supportedUILayouts: []*authd.UILayout{emptyType}, wantErr: true},
+		"Error when getting authentication modes":           {username: "GAM_error", wantErr: true},
+		"Error when broker returns no authentication modes": {username: "GAM_empty", wantErr: true},
+		"Error when selecting authentication mode":          {username: "SAM_error", wantErr: true},
+		"Error when returns layout without required value":  {username: "SAM_missing_required_entry", wantErr: true},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			client := newPamClient(t, nil)
+
+			if tc.brokerID == "" {
+				tc.brokerID = mockBrokerGeneratedID
+			} else if tc.brokerID == "-" {
+				tc.brokerID = ""
+			}
+
+			if tc.username != "" {
+				tc.username = t.Name() + brokertestutils.IDSeparator + tc.username
+			}
+
+			if tc.withPreviousBroker {
+				err := brokerManager.SetDefaultBrokerForUser(mockBrokerGeneratedID, tc.username)
+				require.NoError(t, err, "Setup: could not set previous broker for user")
+			}
+
+			if tc.supportedUILayouts == nil {
+				tc.supportedUILayouts = []*authd.UILayout{requiredEntry}
+			}
+
+			baReq := &authd.BARequest{
+				Username:           tc.username,
+				SupportedUiLayouts: tc.supportedUILayouts,
+			}
+			if tc.brokerID != "" {
+				baReq.BrokerId = &tc.brokerID
+			}
+			baResp, err := client.BeginAuthentication(context.Background(), baReq)
+			if tc.wantErr {
+				require.Error(t, err, "BeginAuthentication should return an error, but did not")
+				return
+			}
+			require.NoError(t, err, "BeginAuthentication should not return an error, but did")
+			require.Equal(t, mockBrokerGeneratedID, baResp.GetBrokerId(), "BeginAuthentication should return the selected broker")
+
+			got := struct {
+				SessionID            string
+				EncryptionKey        string
+				AuthenticationModes  []*authd.GAMResponse_AuthenticationMode
+				AuthenticationModeID string
+				UILayout             *authd.UILayout
+			}{
+				SessionID:            strings.ReplaceAll(baResp.GetSessionId(), mockBrokerGeneratedID, "BROKER_ID"),
+				EncryptionKey:        baResp.GetEncryptionKey(),
+				AuthenticationModes:  baResp.GetAuthenticationModes(),
+				AuthenticationModeID: baResp.GetAuthenticationModeId(),
+				UILayout:             baResp.GetUiLayoutInfo(),
+			}
+			want := testutils.LoadWithUpdateFromGoldenYAML(t, got)
+			require.Equal(t, want, got, "BeginAuthentication returned an unexpected response")
+		})
+	}
+}
+
 func TestIsAuthenticated(t *testing.T) {
 	tests := map[string]struct {
 		// These are the function arguments.
@@ -368,15 +457,16 @@ func TestIsAuthenticated(t *testing.T) {
 				t.Parallel()
 			}
 
-			destCmdsFile := filepath.Join(t.TempDir(), "gpasswd.output")
-
+			var groupFilePath string
 			if tc.localGroupsFile != "" {
-				groupFilePath := filepath.Join(testutils.TestFamilyPath(t), tc.localGroupsFile)
-				gpasswd := []string{"env", "GO_WANT_HELPER_PROCESS=1",
-					fmt.Sprintf("GO_WANT_HELPER_PROCESS_DEST=%s", destCmdsFile),
-					fmt.Sprintf("GO_WANT_HELPER_PROCESS_GROUPFILE=%s", groupFilePath),
-					os.Args[0], "-test.run=TestMockgpasswd", "--"}
-				usertests.OverrideDefaultOptions(t, groupFilePath, gpasswd)
+				groupFilePath = filepath.Join(testutils.TestFamilyPath(t), tc.localGroupsFile)
+				// The group file is edited in place, so we work on a copy of existing fixtures.
+				if d, err := os.ReadFile(groupFilePath); err == nil {
+					groupFilePath = filepath.Join(t.TempDir(), "group")
+					err = os.WriteFile(groupFilePath, d, 0644)
+					require.NoError(t, err, "Setup: could not copy group file fixture")
+				}
+				usertests.OverrideDefaultOptions(t, groupFilePath, filepath.Join(t.TempDir(), "gshadow"))
 			}
 
 			cacheDir := t.TempDir()
@@ -457,29 +547,18 @@ func TestIsAuthenticated(t *testing.T) {
 			wantDB := testutils.LoadWithUpdateFromGolden(t, gotDB, testutils.WithGoldenPath(filepath.Join(testutils.GoldenPath(t), "cache.db")))
 			require.Equal(t, wantDB, gotDB, "IsAuthenticated should update the cache database as expected")
 
-			// Finally, check the group file gpasswd commands.
-			// TODO: this should be extracted in testutils, but still allow post-treatement of file like sorting.
-			// Always check the golden files missing for no-op too on error.
-			goldenGpasswdPath := filepath.Join(testutils.GoldenPath(t), "gpasswd.output")
-			referenceFilePath := goldenGpasswdPath
-			if testutils.Update() {
-				// The file may already not exists.
-				_ = os.Remove(testutils.GoldenPath(t))
-				referenceFilePath = destCmdsFile
-			}
-
-			var shouldExists bool
-			if _, err := os.Stat(referenceFilePath); err == nil {
-				shouldExists = true
+			// Finally, check the group file.
+			if groupFilePath == "" {
+				return
 			}
-			if !shouldExists {
-				require.NoFileExists(t, destCmdsFile, "UpdateLocalGroups should not call gpasswd by did")
+			if _, err := os.Stat(groupFilePath); errors.Is(err, os.ErrNotExist) {
 				return
 			}
-
-			gotGPasswd := usertests.IdemnpotentOutputFromGPasswd(t, destCmdsFile)
-			wantGPasswd := testutils.LoadWithUpdateFromGolden(t, gotGPasswd, testutils.WithGoldenPath(goldenGpasswdPath))
-			require.Equal(t, wantGPasswd, gotGPasswd, "IsAuthenticated should return the expected combined data, but did not")
+			d, err := os.ReadFile(groupFilePath)
+			require.NoError(t, err, "Teardown: could not read group file")
+			gotGroups := string(d)
+			wantGroups := testutils.LoadWithUpdateFromGolden(t, gotGroups, testutils.WithGoldenPath(filepath.Join(testutils.GoldenPath(t), "group")))
+			require.Equal(t, wantGroups, gotGroups, "IsAuthenticated should update the local groups as expected")
 		})
 	}
 }
@@ -598,10 +677,6 @@ func TestEndSession(t *testing.T) {
 	}
 }
 
-func TestMockgpasswd(t *testing.T) {
-	usertests.Mockgpasswd(t)
-}
-
 // initBrokers starts dbus mock brokers on the system bus. It returns its config path.
 func initBrokers() (brokerConfigPath string, cleanup func(), err error) {
 	tmpDir, err := os.MkdirTemp("", "authd-internal-pam-tests-")
@@ -694,10 +769,6 @@ func startSession(t *testing.T, client authd.PAMClient, username string) string
 }
 
 func TestMain(m *testing.M) {
-	if os.Getenv("GO_WANT_HELPER_PROCESS") != "" {
-		os.Exit(m.Run())
-	}
-
 	testutils.InstallUpdateFlag()
 	flag.Parse()
 
@@ -120,6 +120,10 @@ func (b *BrokerBusMock) NewSession(username, lang string) (sessionID, encryption
 	if parsedUsername == "NS_no_id" {
 		return "", username + "_key", nil
 	}
+	if parsedUsername == "NS_slow" {
+		// Simulates a broker service which is slow to be activated.
+		time.Sleep(time.Second)
+	}
 	return GenerateSessionID(username), GenerateEncryptionKey(b.name), nil
 }
 
@@ -244,6 +248,12 @@ func (b *BrokerBusMock) IsAuthenticated(sessionID, authenticationData string) (a
 		access = responses.AuthCancelled
 		data = ""
 
+	case "IA_cancel_unanswered":
+		// CancelIsAuthenticated never answers for this session, so this is only cancelled when the mock is stopped.
+		<-ctx.Done()
+		access = responses.AuthCancelled
+		data = ""
+
 	case "IA_second_call":
 		select {
 		case <-ctx.Done():
@@ -305,6 +315,11 @@ func (b *BrokerBusMock) EndSession(sessionID string) (dbusErr *dbus.Error) {
 
 // CancelIsAuthenticated cancels an ongoing IsAuthenticated call if it exists.
 func (b *BrokerBusMock) CancelIsAuthenticated(sessionID string) (dbusErr *dbus.Error) {
+	if parseSessionID(sessionID) == "IA_cancel_unanswered" {
+		// Simulates a broker which is stuck.
+		select {}
+	}
+
 	b.isAuthenticatedCallsMu.Lock()
 	defer b.isAuthenticatedCallsMu.Unlock()
 	if _, exists := b.isAuthenticatedCalls[sessionID]; !exists {
@@ -1,5 +1,7 @@
 package users
 
+import "time"
+
 // WithGroupPath overrides the default /etc/group path for tests.
 func WithGroupPath(p string) Option {
 	return func(o *options) {
@@ -7,9 +9,23 @@ func WithGroupPath(p string) Option {
 	}
 }
 
-// WithGpasswdCmd overrides gpasswd call with specific commands for tests.
-func WithGpasswdCmd(cmds []string) Option {
+// WithGShadowPath overrides the default /etc/gshadow path for tests.
+func WithGShadowPath(p string) Option {
+	return func(o *options) {
+		o.gshadowPath = p
+	}
+}
+
+// WithPasswdLockPath overrides the default /etc/.pwd.lock path for tests.
+func WithPasswdLockPath(p string) Option {
+	return func(o *options) {
+		o.passwdLockPath = p
+	}
+}
+
+// WithLockTimeout overrides the time waiting for the group files to be unlocked for tests.
+func WithLockTimeout(timeout time.Duration) Option {
 	return func(o *options) {
-		o.gpasswdCmd = cmds
+		o.lockTimeout = timeout
 	}
 }
@@ -0,0 +1,282 @@
+package users
+
+import (
+	"errors"
+	"fmt"
+	"io"
+	"io/fs"
+	"log/slog"
+	"os"
+	"path/filepath"
+	"slices"
+	"strconv"
+	"strings"
+	"sync"
+	"syscall"
+	"time"
+
+	"github.com/ubuntu/decorate"
+)
+
+// lockRetryDelay is the time to wait before trying again to lock a group file held by another process.
+const lockRetryDelay = 100 * time.Millisecond
+
+// passwdLockMu serializes our own updates, as the lock taken by lockPasswdDatabase does not exclude the process holding it.
+var passwdLockMu sync.Mutex
+
+// lockPasswdDatabase takes the lock of the whole user and group database as lckpwdf(3) does, that is a fcntl write
+// lock on path. shadow-utils takes it before the lock of any of the files, so it must be taken first.
+// It returns a function to release the lock.
+func lockPasswdDatabase(path string, timeout time.Duration) (unlock func(), err error) {
+	defer decorate.OnError(&err, "could not lock %s", path)
+
+	passwdLockMu.Lock()
+	defer func() {
+		if err != nil {
+			passwdLockMu.Unlock()
+		}
+	}()
+
+	f, err := os.OpenFile(path, os.O_WRONLY|os.O_CREATE, 0600)
+	if err != nil {
+		return nil, err
+	}
+
+	lock := syscall.Flock_t{Type: syscall.F_WRLCK, Whence: io.SeekStart}
+	deadline := time.Now().Add(timeout)
+	for {
+		err := syscall.FcntlFlock(f.Fd(), syscall.F_SETLK, &lock)
+		if err == nil {
+			break
+		}
+		if !errors.Is(err, syscall.EAGAIN) && !errors.Is(err, syscall.EACCES) {
+			f.Close()
+			return nil, err
+		}
+		if time.Now().After(deadline) {
+			f.Close()
+			return nil, fmt.Errorf("%s is locked by another process", path)
+		}
+		time.Sleep(lockRetryDelay)
+	}
+
+	return func() {
+		// Closing the file releases the lock.
+		if err := f.Close(); err != nil {
+			slog.Warn(fmt.Sprintf("Could not unlock %s: %v", path, err))
+		}
+		passwdLockMu.Unlock()
+	}, nil
+}
+
+// lockGroupFile locks path the way shadow-utils does, so that gpasswd, groupadd and the like wait for us: path.lock
+// is created as a hard link to a file holding our pid, which makes the lock atomic and lets stale locks be detected.
+// It returns a function to release the lock.
+func lockGroupFile(path string, timeout time.Duration) (unlock func(), err error) {
+	defer decorate.OnError(&err, "could not lock %s", path)
+
+	lockPath := path + ".lock"
+
+	f, err := os.CreateTemp(filepath.Dir(path), filepath.Base(path)+".")
+	if err != nil {
+		return nil, err
+	}
+	defer os.Remove(f.Name())
+	_, err = f.WriteString(strconv.Itoa(os.Getpid()))
+	if closeErr := f.Close(); err == nil {
+		err = closeErr
+	}
+	if err != nil {
+		return nil, err
+	}
+
+	deadline := time.Now().Add(timeout)
+	for {
+		err := os.Link(f.Name(), lockPath)
+		if err == nil {
+			return func() {
+				if err := os.Remove(lockPath); err != nil {
+					slog.Warn(fmt.Sprintf("Could not remove lock file %s: %v", lockPath, err))
+				}
+			}, nil
+		}
+		if !errors.Is(err, fs.ErrExist) {
+			return nil, err
+		}
+
+		if removeStaleLock(lockPath) {
+			continue
+		}
+		if time.Now().After(deadline) {
+			return nil, fmt.Errorf("%s is locked by another process", path)
+		}
+		time.Sleep(lockRetryDelay)
+	}
+}
+
+// removeStaleLock removes lockPath if the process which created it is not running anymore.
+// It returns true if the lock was removed.
+func removeStaleLock(lockPath string) bool {
+	d, err := os.ReadFile(lockPath)
+	if err != nil {
+		// The lock may have just been released: try again.
+		return errors.Is(err, fs.ErrNotExist)
+	}
+	pid, err := strconv.Atoi(strings.TrimSpace(string(d)))
+	if err != nil || pid <= 0 {
+		return false
+	}
+	if err := syscall.Kill(pid, 0); !errors.Is(err, syscall.ESRCH) {
+		return false
+	}
+
+	slog.Info(fmt.Sprintf("Removing stale lock %s of process %d", lockPath, pid))
+	return os.Remove(lockPath) == nil
+}
+
+// updateGroupFilesMembers adds and removes user from the member lists of groups in all paths, which must be locked.
+// The new content of all the files is written aside before any of them is replaced, so that an error leaves all of
+// them untouched. Files in which no member list changed are not written.
+func updateGroupFilesMembers(paths []string, user string, groupsToAdd, groupsToRemove []string) (err error) {
+	staged := make(map[string]string)
+	defer func() {
+		for _, tmpPath := range staged {
+			_ = os.Remove(tmpPath)
+		}
+	}()
+
+	for _, path := range paths {
+		data, changed, err := groupFileMembers(path, user, groupsToAdd, groupsToRemove)
+		if err != nil {
+			return err
+		}
+		if !changed {
+			continue
+		}
+		tmpPath, err := stageFile(path, data)
+		if err != nil {
+			return fmt.Errorf("could not update %s: %w", path, err)
+		}
+		staged[path] = tmpPath
+	}
+
+	for _, path := range paths {
+		tmpPath, ok := staged[path]
+		if !ok {
+			continue
+		}
+		if err := os.Rename(tmpPath, path); err != nil {
+			return fmt.Errorf("could not update %s: %w", path, err)
+		}
+		delete(staged, path)
+	}
+
+	return nil
+}
+
+// groupFileMembers returns the content of path with user added to and removed from the member lists of groups, and
+// whether any member list changed.
+// Both /etc/group and /etc/gshadow have 4 fields per line, the last one being the list of members.
+// Groups that are not in the file are ignored.
+func groupFileMembers(path, user string, groupsToAdd, groupsToRemove []string) (data []byte, changed bool, err error) {
+	defer decorate.OnError(&err, "could not update %s", path)
+
+	d, err := os.ReadFile(path)
+	if err != nil {
+		return nil, false, err
+	}
+
+	found := make(map[string]struct{})
+	lines := strings.Split(string(d), "\n")
+	for i, line := range lines {
+		t := strings.TrimSpace(line)
+		if t == "" {
+			continue
+		}
+		elems := strings.Split(t, ":")
+		if len(elems) != 4 {
+			return nil, false, fmt.Errorf("unexpected number of elements in group file on line (should have 4 separators): %q", t)
+		}
+
+		group := elems[0]
+		var members []string
+		if elems[3] != "" {
+			members = strings.Split(elems[3], ",")
+		}
+
+		newMembers := members
+		switch {
+		case slices.Contains(groupsToAdd, group):
+			found[group] = struct{}{}
+			if !slices.Contains(members, user) {
+				newMembers = append(slices.Clone(members), user)
+			}
+		case slices.Contains(groupsToRemove, group):
+			newMembers = slices.DeleteFunc(slices.Clone(members), func(m string) bool { return m == user })
+		}
+		if len(newMembers) == len(members) {
+			continue
+		}
+
+		elems[3] = strings.Join(newMembers, ",")
+		lines[i] = strings.Join(elems, ":")
+		changed = true
+	}
+
+	for _, g := range groupsToAdd {
+		if _, ok := found[g]; !ok {
+			slog.Info(fmt.Sprintf("ignoring group %q, which is not in %s", g, path))
+		}
+	}
+
+	if !changed {
+		return nil, false, nil
+	}
+	return []byte(strings.Join(lines, "\n")), true, nil
+}
+
+// stageFile writes data to the temporary file which replaces path once renamed over it, with the permissions and
+// ownership of path. It returns the name of the temporary file.
+// It must only be called with the lock of path held, as the temporary file name is fixed, as for shadow-utils.
+func stageFile(path string, data []byte) (tmpPath string, err error) {
+	fi, err := os.Stat(path)
+	if err != nil {
+		return "", err
+	}
+
+	name := path + "+"
+	f, err := os.OpenFile(name, os.O_WRONLY|os.O_CREATE|os.O_TRUNC, fi.Mode().Perm())
+	if err != nil {
+		return "", err
+	}
+	defer func() {
+		if err != nil {
+			_ = os.Remove(name)
+		}
+	}()
+
+	if st, ok := fi.Sys().(*syscall.Stat_t); ok {
+		if err := f.Chown(int(st.Uid), int(st.Gid)); err != nil {
+			f.Close()
+			return "", err
+		}
+	}
+	// The permissions of the file we created are subject to the umask.
+	if err := f.Chmod(fi.Mode().Perm()); err != nil {
+		f.Close()
+		return "", err
+	}
+	if _, err := f.Write(data); err != nil {
+		f.Close()
+		return "", err
+	}
+	if err := f.Sync(); err != nil {
+		f.Close()
+		return "", err
+	}
+	if err := f.Close(); err != nil {
+		return "", err
+	}
+
+	return name, nil
+}
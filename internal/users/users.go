@@ -5,12 +5,12 @@ import (
 	"bufio"
 	"errors"
 	"fmt"
-	"log/slog"
 	"os"
-	"os/exec"
 	"slices"
 	"strings"
+	"time"
 
+	"github.com/ubuntu/authd/internal/metrics"
 	"github.com/ubuntu/decorate"
 )
 
@@ -32,13 +32,17 @@ type GroupInfo struct {
 }
 
 type options struct {
-	groupPath  string
-	gpasswdCmd []string
+	groupPath      string
+	gshadowPath    string
+	passwdLockPath string
+	lockTimeout    time.Duration
 }
 
 var defaultOptions = options{
-	groupPath:  "/etc/group",
-	gpasswdCmd: []string{"gpasswd"},
+	groupPath:      "/etc/group",
+	gshadowPath:    "/etc/gshadow",
+	passwdLockPath: "/etc/.pwd.lock",
+	lockTimeout:    15 * time.Second,
 }
 
 // Option represents an optional function to override UpdateLocalGroups default values.
@@ -47,6 +51,7 @@ type Option func(*options)
 // UpdateLocalGroups synchronizes for the given user the local group list with the current group list from UserInfo.
 func (u *UserInfo) UpdateLocalGroups(args ...Option) (err error) {
 	defer decorate.OnError(&err, "could not update local groups for user %q", u.Name)
+	defer metrics.Time("users/UpdateLocalGroups")()
 
 	if u.Name == "" {
 		return errors.New("empty user name")
@@ -69,23 +74,35 @@ func (u *UserInfo) UpdateLocalGroups(args ...Option) (err error) {
 	}
 
 	groupsToAdd, groupsToRemove := computeGroupOperation(u.Groups, currentLocalGroups)
+	if len(groupsToAdd) == 0 && len(groupsToRemove) == 0 {
+		return nil
+	}
 
-	for _, g := range groupsToRemove {
-		args := opts.gpasswdCmd[1:]
-		args = append(args, "--delete", u.Name, g)
-		if err := runGPasswd(opts.gpasswdCmd[0], args...); err != nil {
-			return err
-		}
+	// The files are read again once locked, so changes made in the meantime are kept.
+	unlockPasswd, err := lockPasswdDatabase(opts.passwdLockPath, opts.lockTimeout)
+	if err != nil {
+		return err
 	}
-	for _, g := range groupsToAdd {
-		args := opts.gpasswdCmd[1:]
-		args = append(args, "--add", u.Name, g)
-		if err := runGPasswd(opts.gpasswdCmd[0], args...); err != nil {
+	defer unlockPasswd()
+
+	unlockGroup, err := lockGroupFile(opts.groupPath, opts.lockTimeout)
+	if err != nil {
+		return err
+	}
+	defer unlockGroup()
+
+	// As gpasswd, keep the member lists of gshadow in sync, if the system uses it.
+	paths := []string{opts.groupPath}
+	if _, err := os.Stat(opts.gshadowPath); err == nil {
+		unlockGShadow, err := lockGroupFile(opts.gshadowPath, opts.lockTimeout)
+		if err != nil {
 			return err
 		}
+		defer unlockGShadow()
+		paths = append(paths, opts.gshadowPath)
 	}
 
-	return nil
+	return updateGroupFilesMembers(paths, u.Name, groupsToAdd, groupsToRemove)
 }
 
 // existingLocalGroups returns which groups from groupPath the user is part of.
@@ -96,6 +113,7 @@ func existingLocalGroups(user, groupPath string) (groups []string, err error) {
 	if err != nil {
 		return nil, err
 	}
+	defer f.Close()
 
 	// Format of a line composing the group file is:
 	// group_name:password:group_id:user1,…,usern
@@ -160,19 +178,3 @@ func computeGroupOperation(newGroupsInfo []GroupInfo, currentLocalGroups []strin
 
 	return groupsToAdd, groupsToRemove
 }
-
-// runGPasswd is a wrapper to cmdName ignoring exit code 3, meaning that the group doesn't exist.
-// Note: it’s the same return code for user not existing, but it’s something we are in control of as we
-// are responsible for the user itself and parsing the output is not desired.
-func runGPasswd(cmdName string, args ...string) error {
-	cmd := exec.Command(cmdName, args...)
-	out, err := cmd.CombinedOutput()
-	if err != nil {
-		if cmd.ProcessState.ExitCode() == 3 {
-			slog.Info(fmt.Sprintf("ignoring gpasswd error: %s", out))
-			return nil
-		}
-		return fmt.Errorf("%q returned: %v\nOutput: %s", strings.Join(cmd.Args, " "), err, out)
-	}
-	return nil
-}
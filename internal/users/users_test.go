@@ -1,16 +1,20 @@
 package users_test
 
 import (
+	"errors"
 	"flag"
-	"fmt"
+	"io/fs"
 	"os"
 	"path/filepath"
+	"strconv"
+	"strings"
 	"testing"
+	"time"
 
 	"github.com/stretchr/testify/require"
 	"github.com/ubuntu/authd/internal/testutils"
 	"github.com/ubuntu/authd/internal/users"
-	usertests "github.com/ubuntu/authd/internal/users/tests"
+	"golang.org/x/sys/unix"
 )
 
 func TestUpdateLocalGroups(t *testing.T) {
@@ -23,6 +27,9 @@ func TestUpdateLocalGroups(t *testing.T) {
 
 		groups        []users.GroupInfo
 		groupFilePath string
+		locked        bool
+		passwdLocked  bool
+		gshadowStuck  bool
 
 		wantErr bool
 	}{
@@ -39,22 +46,26 @@ func TestUpdateLocalGroups(t *testing.T) {
 		"Remove user from an additional group, being alone":                       {groupFilePath: "user_in_second_local_group.group"},
 		"Remove user from an additional group, multiple users in group":           {groupFilePath: "user_in_second_local_group_with_others.group"},
 		"Add and remove user from multiple groups, one remaining":                 {groupFilePath: "user_in_many_groups.group"},
+		"Add and remove user from multiple groups in gshadow too":                 {groupFilePath: "user_in_many_groups_with_gshadow.group"},
 
 		// Flexible accepted cases
 		"Missing group is ignored":              {groupFilePath: "missing_group.group"},
 		"Group file with empty line is ignored": {groupFilePath: "empty_line.group"},
+		"No-Op does not wait for the lock":      {groupFilePath: "user_in_both_groups.group", locked: true},
 
 		// No group
 		"No-Op for user with no groups and was in none": {groups: []users.GroupInfo{}, groupFilePath: "no_users_in_our_groups.group"},
 		"Remove user with no groups from existing ones": {groups: []users.GroupInfo{}, groupFilePath: "user_in_both_groups.group"},
 
 		// Error cases
-		"Error on missing groups file":                {groupFilePath: "does_not_exists.group", wantErr: true},
-		"Error when groups file is malformed":         {groupFilePath: "malformed_file.group", wantErr: true},
-		"Error on any unignored add gpasswd error":    {user: "gpasswdfail", groupFilePath: "no_users.group", wantErr: true},
-		"Error on any unignored delete gpasswd error": {user: "gpasswdfail", groupFilePath: "gpasswdfail_in_deleted_group.group", wantErr: true},
-		"Error on empty user name":                    {user: "-", groupFilePath: "no_users.group", wantErr: true},
-		"Error on empty group name":                   {groups: []users.GroupInfo{{Name: ""}}, groupFilePath: "no_users.group", wantErr: true},
+		"Error on missing groups file":                  {groupFilePath: "does_not_exists.group", wantErr: true},
+		"Error when groups file is malformed":           {groupFilePath: "malformed_file.group", wantErr: true},
+		"Error when groups file stays locked":           {groupFilePath: "no_users.group", locked: true, wantErr: true},
+		"Error when the password database stays locked": {groupFilePath: "no_users.group", passwdLocked: true, wantErr: true},
+		"Error when gshadow is malformed":               {groupFilePath: "user_in_many_groups_with_malformed_gshadow.group", wantErr: true},
+		"Error when gshadow can not be written":         {groupFilePath: "user_in_many_groups_with_gshadow.group", gshadowStuck: true, wantErr: true},
+		"Error on empty user name":                      {user: "-", groupFilePath: "no_users.group", wantErr: true},
+		"Error on empty group name":                     {groups: []users.GroupInfo{{Name: ""}}, groupFilePath: "no_users.group", wantErr: true},
 	}
 	for name, tc := range tests {
 		name := name
@@ -89,54 +100,129 @@ func TestUpdateLocalGroups(t *testing.T) {
 				Groups: tc.groups,
 			}
 
-			destCmdsFile := filepath.Join(t.TempDir(), "gpasswd.output")
+			// The group files are edited in place, so we work on copies of the fixtures.
+			tmpDir := t.TempDir()
+			groupFilePath := filepath.Join(tmpDir, "group")
+			gshadowFilePath := filepath.Join(tmpDir, "gshadow")
+			copyFixture(t, filepath.Join("testdata", tc.groupFilePath), groupFilePath)
+			copyFixture(t, filepath.Join("testdata", strings.TrimSuffix(tc.groupFilePath, ".group")+".gshadow"), gshadowFilePath)
+
+			if tc.locked {
+				// Lock the file as another running process would.
+				err := os.WriteFile(groupFilePath+".lock", []byte(strconv.Itoa(os.Getpid())), 0600)
+				require.NoError(t, err, "Setup: could not lock group file")
+			}
+			passwdLockPath := filepath.Join(tmpDir, ".pwd.lock")
+			if tc.passwdLocked {
+				lockPasswdDatabase(t, passwdLockPath)
+			}
+			if tc.gshadowStuck {
+				// The temporary gshadow file can't be opened for writing if it's a directory.
+				err := os.Mkdir(gshadowFilePath+"+", 0700)
+				require.NoError(t, err, "Setup: could not block temporary gshadow file")
+			}
 
-			groupFilePath := filepath.Join("testdata", tc.groupFilePath)
-			cmdArgs := []string{"env", "GO_WANT_HELPER_PROCESS=1",
-				fmt.Sprintf("GO_WANT_HELPER_PROCESS_DEST=%s", destCmdsFile),
-				fmt.Sprintf("GO_WANT_HELPER_PROCESS_GROUPFILE=%s", groupFilePath),
-				os.Args[0], "-test.run=TestMockgpasswd", "--"}
+			groupFileBefore, gshadowFileBefore := readFileState(t, groupFilePath), readFileState(t, gshadowFilePath)
 
-			err := u.UpdateLocalGroups(users.WithGroupPath(groupFilePath), users.WithGpasswdCmd(cmdArgs))
+			err := u.UpdateLocalGroups(users.WithGroupPath(groupFilePath), users.WithGShadowPath(gshadowFilePath),
+				users.WithPasswdLockPath(passwdLockPath), users.WithLockTimeout(500*time.Millisecond))
 			if tc.wantErr {
 				require.Error(t, err, "UpdateLocalGroups should have failed")
 			} else {
 				require.NoError(t, err, "UpdateLocalGroups should not have failed")
 			}
 
-			// Always check the golden files missing for no-op too on error
-			referenceFilePath := testutils.GoldenPath(t)
-			if testutils.Update() {
-				// The file may already not exists.
-				_ = os.Remove(testutils.GoldenPath(t))
-				referenceFilePath = destCmdsFile
+			require.NoFileExists(t, groupFilePath+"+", "Temporary group file should have been removed")
+			if !tc.gshadowStuck {
+				require.NoFileExists(t, gshadowFilePath+"+", "Temporary gshadow file should have been removed")
 			}
-
-			var shouldExists bool
-			if _, err := os.Stat(referenceFilePath); err == nil {
-				shouldExists = true
-			}
-			if !shouldExists {
-				require.NoFileExists(t, destCmdsFile, "UpdateLocalGroups should not call gpasswd by did")
-				return
+			if !tc.locked {
+				require.NoFileExists(t, groupFilePath+".lock", "Group file should have been unlocked")
+				require.NoFileExists(t, gshadowFilePath+".lock", "Gshadow file should have been unlocked")
 			}
 
-			got := usertests.IdemnpotentOutputFromGPasswd(t, destCmdsFile)
-			want := testutils.LoadWithUpdateFromGolden(t, got)
-			require.Equal(t, want, got, "UpdateLocalGroups should do the expected gpasswd operation, but did not")
+			requireGroupFile(t, groupFilePath, groupFileBefore, tc.wantErr)
+			requireGroupFile(t, gshadowFilePath, gshadowFileBefore, tc.wantErr)
 		})
 	}
 }
 
-func TestMockgpasswd(t *testing.T) {
-	usertests.Mockgpasswd(t)
+// lockPasswdDatabase locks path as another process calling lckpwdf would, until the end of the test.
+// The lock is an open file description lock, as the process-wide fcntl locks taken by lckpwdf never conflict with
+// the ones of the same process.
+func lockPasswdDatabase(t *testing.T, path string) {
+	t.Helper()
+
+	f, err := os.OpenFile(path, os.O_WRONLY|os.O_CREATE, 0600)
+	require.NoError(t, err, "Setup: could not open password database lock")
+	t.Cleanup(func() { f.Close() })
+
+	lock := unix.Flock_t{Type: unix.F_WRLCK}
+	err = unix.FcntlFlock(f.Fd(), unix.F_OFD_SETLK, &lock)
+	require.NoError(t, err, "Setup: could not lock password database")
 }
 
-func TestMain(m *testing.M) {
-	if os.Getenv("GO_WANT_HELPER_PROCESS") != "" {
-		os.Exit(m.Run())
+// fileState is the content of a file and its information, to check how it was changed.
+type fileState struct {
+	info    os.FileInfo
+	content string
+}
+
+// copyFixture copies the fixture src to dst, if it exists.
+func copyFixture(t *testing.T, src, dst string) {
+	t.Helper()
+
+	d, err := os.ReadFile(src)
+	if errors.Is(err, fs.ErrNotExist) {
+		return
+	}
+	require.NoError(t, err, "Setup: could not read fixture")
+	err = os.WriteFile(dst, d, 0644)
+	require.NoError(t, err, "Setup: could not copy fixture")
+}
+
+// readFileState returns the state of the file at path, or nil if it does not exist.
+func readFileState(t *testing.T, path string) *fileState {
+	t.Helper()
+
+	fi, err := os.Stat(path)
+	if errors.Is(err, fs.ErrNotExist) {
+		return nil
+	}
+	require.NoError(t, err, "Setup: could not stat file")
+	d, err := os.ReadFile(path)
+	require.NoError(t, err, "Setup: could not read file")
+
+	return &fileState{info: fi, content: string(d)}
+}
+
+// requireGroupFile checks that the group file at path matches its golden file, and that it was only rewritten if
+// its content changed. With wantUntouched, the file is expected to not have been rewritten.
+func requireGroupFile(t *testing.T, path string, before *fileState, wantUntouched bool) {
+	t.Helper()
+
+	if before == nil {
+		require.NoFileExists(t, path, "UpdateLocalGroups should not create group files")
+		return
 	}
 
+	after := readFileState(t, path)
+	require.NotNil(t, after, "Group file should still exist")
+	require.Equal(t, before.info.Mode(), after.info.Mode(), "Group file permissions should be kept")
+
+	rewritten := !os.SameFile(before.info, after.info)
+	if wantUntouched {
+		require.False(t, rewritten, "Group file should not have been rewritten")
+		require.Equal(t, before.content, after.content, "Group file should not have been modified")
+		return
+	}
+	require.Equal(t, before.content != after.content, rewritten, "Group file should only be rewritten when it changes")
+
+	want := testutils.LoadWithUpdateFromGolden(t, after.content, testutils.WithGoldenPath(filepath.Join(testutils.GoldenPath(t), filepath.Base(path))))
+	require.Equal(t, want, after.content, "UpdateLocalGroups should make the expected changes to the group file, but did not")
+}
+
+func TestMain(m *testing.M) {
 	testutils.InstallUpdateFlag()
 	flag.Parse()
 
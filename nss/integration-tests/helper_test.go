@@ -75,7 +75,10 @@ func outNSSCommandForLib(t *testing.T, socketPath, originOut string, cmds ...str
 	)
 
 	if socketPath != "" {
-		cmd.Env = append(cmd.Env, fmt.Sprintf("AUTHD_NSS_SOCKET=%s", socketPath))
+		cmd.Env = append(cmd.Env,
+			fmt.Sprintf("AUTHD_NSS_SOCKET=%s", socketPath),
+			fmt.Sprintf("AUTHD_NSS_SNAPSHOT=%s", nssSnapshotPath(socketPath)),
+		)
 	}
 
 	var out bytes.Buffer
@@ -89,15 +92,28 @@ func outNSSCommandForLib(t *testing.T, socketPath, originOut string, cmds ...str
 func runDaemon(ctx context.Context, t *testing.T, cacheDB string) (socketPath string, stopped chan struct{}) {
 	t.Helper()
 
+	var fillCache func(cacheDir string)
+	if cacheDB != "" {
+		fillCache = func(cacheDir string) {
+			createDBFile(t, filepath.Join("testdata", "db", cacheDB+".db.yaml"), cacheDir)
+		}
+	}
+	return runDaemonWithCache(ctx, t, fillCache)
+}
+
+// runDaemonWithCache runs the daemon with a cache directory populated by fillCache, if not nil.
+func runDaemonWithCache(ctx context.Context, t *testing.T, fillCache func(cacheDir string)) (socketPath string, stopped chan struct{}) {
+	t.Helper()
+
 	// Socket name has a maximum size, so we can't use t.TempDir() directly.
 	tempDir, err := os.MkdirTemp("", "authd-nss-tests")
 	require.NoError(t, err, "Setup: failed to create socket dir for tests")
 	t.Cleanup(func() { os.RemoveAll(tempDir) })
 
 	cacheDir := filepath.Join(tempDir, "cache")
-	if cacheDB != "" {
+	if fillCache != nil {
 		require.NoError(t, os.MkdirAll(cacheDir, 0700), "Setup: failed to create cache dir")
-		createDBFile(t, filepath.Join("testdata", "db", cacheDB+".db.yaml"), cacheDir)
+		fillCache(cacheDir)
 	}
 	socketPath = filepath.Join(tempDir, "authd.socket")
 
@@ -106,7 +122,8 @@ verbosity: 2
 paths:
   cache: %s
   socket: %s
-`, cacheDir, socketPath)
+  nsssnapshot: %s
+`, cacheDir, socketPath, nssSnapshotPath(socketPath))
 
 	configPath := filepath.Join(tempDir, "testconfig.yaml")
 	require.NoError(t, os.WriteFile(configPath, []byte(config), 0600), "Setup: failed to create config file for tests")
@@ -133,6 +150,11 @@ paths:
 	return socketPath, stopped
 }
 
+// nssSnapshotPath returns the path of the cache snapshot published by the daemon listening on socketPath.
+func nssSnapshotPath(socketPath string) string {
+	return filepath.Join(filepath.Dir(socketPath), "nss.snapshot")
+}
+
 // buildDaemon builds the daemon executable and returns the binary path.
 func buildDaemon() (execPath string, cleanup func(), err error) {
 	projectRoot := getProjectRoot()
@@ -0,0 +1,85 @@
+package nss_test
+
+import (
+	"context"
+	"flag"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strconv"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+	cachetests "github.com/ubuntu/authd/internal/cache/tests"
+)
+
+var (
+	loadUsers         = flag.Int("nss-load-users", 0, "run the NSS load test against a synthetic cache of this many users")
+	loadGroups        = flag.Int("nss-load-groups", 1000, "number of groups of the synthetic cache of the NSS load test")
+	loadGroupsPerUser = flag.Int("nss-load-groups-per-user", 20, "number of groups each user of the NSS load test is member of")
+	loadConcurrency   = flag.Int("nss-load-concurrency", 8, "number of concurrent lookups of the NSS load test")
+	loadDuration      = flag.Duration("nss-load-duration", 10*time.Second, "duration of the NSS load test for each operation")
+	loadOps           = flag.String("nss-load-ops", "getpwnam,getpwuid,getgrgid,getgrent", "comma separated operations of the NSS load test")
+)
+
+// TestLoad drives lookups through the NSS module against a synthetic large cache, and reports their throughput and
+// latencies. It's not a regular test: it only runs when requested with -nss-load-users.
+func TestLoad(t *testing.T) {
+	if *loadUsers == 0 {
+		t.Skip("NSS load test not requested, run with -nss-load-users to enable it")
+	}
+
+	buildRustNSSLib(t)
+	loadgen := buildLoadGenerator(t)
+
+	ctx, cancel := context.WithCancel(context.Background())
+	socketPath, daemonStopped := runDaemonWithCache(ctx, t, func(cacheDir string) {
+		err := cachetests.GenerateDB(cacheDir, *loadUsers, *loadGroups, *loadGroupsPerUser)
+		require.NoError(t, err, "Setup: could not generate synthetic cache")
+	})
+	t.Cleanup(func() {
+		cancel()
+		<-daemonStopped
+	})
+
+	// This does not use outNSSCommandForLib, as the debug logs of the module would be part of the measurements.
+	// #nosec:G204 - we control the command arguments in tests
+	cmd := exec.Command(loadgen,
+		"-users", strconv.Itoa(*loadUsers),
+		"-groups", strconv.Itoa(*loadGroups),
+		"-concurrency", strconv.Itoa(*loadConcurrency),
+		"-duration", loadDuration.String(),
+		"-ops", *loadOps,
+	)
+	cmd.Env = append(cmd.Env, rustCovEnv...)
+	cmd.Env = append(cmd.Env,
+		fmt.Sprintf("LD_PRELOAD=%s:%s", libPath, os.Getenv("LD_PRELOAD")),
+		fmt.Sprintf("LD_LIBRARY_PATH=%s:%s", filepath.Dir(libPath), os.Getenv("LD_LIBRARY_PATH")),
+		fmt.Sprintf("AUTHD_NSS_SOCKET=%s", socketPath),
+		fmt.Sprintf("AUTHD_NSS_SNAPSHOT=%s", nssSnapshotPath(socketPath)),
+	)
+	cmd.Stderr = os.Stderr
+
+	out, err := cmd.Output()
+	require.NoError(t, err, "Load generator should run without errors")
+	t.Logf("NSS load with %d users, %d groups, %d groups per user and %d concurrent lookups:\n%s",
+		*loadUsers, *loadGroups, *loadGroupsPerUser, *loadConcurrency, out)
+}
+
+// buildLoadGenerator builds the NSS load generator and returns its path.
+func buildLoadGenerator(t *testing.T) string {
+	t.Helper()
+
+	execPath := filepath.Join(t.TempDir(), "loadgen")
+	// #nosec:G204 - we control the command arguments in tests
+	cmd := exec.Command("go", "build", "-o", execPath, "./nss/integration-tests/loadgen")
+	cmd.Dir = getProjectRoot()
+	cmd.Env = append(os.Environ(), "CGO_ENABLED=1")
+
+	out, err := cmd.CombinedOutput()
+	require.NoError(t, err, "Setup: could not build NSS load generator: %s", out)
+
+	return execPath
+}
@@ -0,0 +1,202 @@
+// Package main is a load generator for the NSS module. It runs lookups through the C library, so that they go through
+// the whole NSS stack, against a synthetic cache created by cachetests.GenerateDB, and reports their throughput and
+// latencies.
+//
+// It's meant to be run with the NSS module preloaded, as the integration tests do.
+package main
+
+/*
+#include <errno.h>
+#include <grp.h>
+#include <pwd.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+// The lookups are wrapped so that the buffer sizes stay on the C side, and so that the calling goroutine doesn't
+// need to deal with the returned structures, which are not used.
+static int lookup_pwnam(const char *name, char *buf, size_t buflen) {
+	struct passwd pwd, *result;
+	int ret = getpwnam_r(name, &pwd, buf, buflen, &result);
+	return ret != 0 ? ret : (result == NULL ? ENOENT : 0);
+}
+
+static int lookup_pwuid(uid_t uid, char *buf, size_t buflen) {
+	struct passwd pwd, *result;
+	int ret = getpwuid_r(uid, &pwd, buf, buflen, &result);
+	return ret != 0 ? ret : (result == NULL ? ENOENT : 0);
+}
+
+static int lookup_grgid(gid_t gid, char *buf, size_t buflen) {
+	struct group grp, *result;
+	int ret = getgrgid_r(gid, &grp, buf, buflen, &result);
+	return ret != 0 ? ret : (result == NULL ? ENOENT : 0);
+}
+
+// enumerate_groups returns the number of groups listed by getgrent.
+static long enumerate_groups(void) {
+	long n = 0;
+	setgrent();
+	while (getgrent() != NULL) {
+		n++;
+	}
+	endgrent();
+	return n;
+}
+*/
+import "C"
+
+import (
+	"flag"
+	"fmt"
+	"os"
+	"sort"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"syscall"
+	"text/tabwriter"
+	"time"
+	"unsafe"
+
+	cachetests "github.com/ubuntu/authd/internal/cache/tests"
+)
+
+// lookupBufferSize is the size of the buffer given to the reentrant lookups. It's large enough for the groups of the
+// synthetic caches, which have thousands of members.
+const lookupBufferSize = 4 << 20
+
+var (
+	nUsers      = flag.Int("users", 10_000, "number of users of the synthetic cache")
+	nGroups     = flag.Int("groups", 1000, "number of groups of the synthetic cache")
+	concurrency = flag.Int("concurrency", 8, "number of concurrent lookups")
+	duration    = flag.Duration("duration", 10*time.Second, "duration of the load for each operation")
+	ops         = flag.String("ops", "getpwnam,getpwuid,getgrgid,getgrent", "comma separated operations to run")
+)
+
+// operations are the lookups the load generator can run. They are given a worker buffer and the index of the lookup.
+var operations = map[string]func(buf []byte, i int) error{
+	"getpwnam": func(buf []byte, i int) error {
+		name := C.CString(cachetests.SyntheticUserName(i % *nUsers))
+		defer C.free(unsafe.Pointer(name))
+		return errnoToError(C.lookup_pwnam(name, (*C.char)(unsafe.Pointer(&buf[0])), C.size_t(len(buf))))
+	},
+	"getpwuid": func(buf []byte, i int) error {
+		uid := C.uid_t(cachetests.SyntheticUID(i % *nUsers))
+		return errnoToError(C.lookup_pwuid(uid, (*C.char)(unsafe.Pointer(&buf[0])), C.size_t(len(buf))))
+	},
+	"getgrgid": func(buf []byte, i int) error {
+		gid := C.gid_t(cachetests.SyntheticGID(i % *nGroups))
+		return errnoToError(C.lookup_grgid(gid, (*C.char)(unsafe.Pointer(&buf[0])), C.size_t(len(buf))))
+	},
+	"getgrent": func(_ []byte, _ int) error {
+		// The enumeration state is global to the process, so enumerations can't run concurrently.
+		enumerationMu.Lock()
+		defer enumerationMu.Unlock()
+		if n := C.enumerate_groups(); n < C.long(*nGroups) {
+			return fmt.Errorf("getgrent listed %d groups, expected at least %d", n, *nGroups)
+		}
+		return nil
+	},
+}
+
+var enumerationMu sync.Mutex
+
+func main() {
+	flag.Parse()
+
+	var failed bool
+	w := tabwriter.NewWriter(os.Stdout, 0, 0, 2, ' ', tabwriter.AlignRight)
+	fmt.Fprintln(w, "operation\tlookups\terrors\tlookups/s\tp50\tp90\tp99\tmax\t")
+	for _, name := range strings.Split(*ops, ",") {
+		op, ok := operations[name]
+		if !ok {
+			fmt.Fprintf(os.Stderr, "unknown operation %q\n", name)
+			os.Exit(2)
+		}
+
+		r := run(op)
+		fmt.Fprintf(w, "%s\t%d\t%d\t%.0f\t%v\t%v\t%v\t%v\t\n", name, len(r.latencies), r.errors,
+			float64(len(r.latencies))/r.elapsed.Seconds(),
+			r.quantile(0.50), r.quantile(0.90), r.quantile(0.99), r.quantile(1))
+		if r.firstErr != nil {
+			fmt.Fprintf(os.Stderr, "%s: %d errors, first one: %v\n", name, r.errors, r.firstErr)
+			failed = true
+		}
+	}
+	w.Flush()
+
+	if failed {
+		os.Exit(1)
+	}
+}
+
+// result is the outcome of the load of an operation.
+type result struct {
+	latencies []time.Duration
+	elapsed   time.Duration
+	errors    int
+	firstErr  error
+}
+
+// run runs op from concurrency workers for the requested duration.
+func run(op func(buf []byte, i int) error) (r result) {
+	var next atomic.Int64
+	var mu sync.Mutex
+	var wg sync.WaitGroup
+
+	start := time.Now()
+	deadline := start.Add(*duration)
+	for w := 0; w < *concurrency; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+
+			buf := make([]byte, lookupBufferSize)
+			var latencies []time.Duration
+			var errs int
+			var firstErr error
+			for now := time.Now(); now.Before(deadline); {
+				err := op(buf, int(next.Add(1)))
+				end := time.Now()
+				latencies = append(latencies, end.Sub(now))
+				now = end
+				if err == nil {
+					continue
+				}
+				if errs == 0 {
+					firstErr = err
+				}
+				errs++
+			}
+
+			mu.Lock()
+			defer mu.Unlock()
+			r.latencies = append(r.latencies, latencies...)
+			r.errors += errs
+			if r.firstErr == nil {
+				r.firstErr = firstErr
+			}
+		}()
+	}
+	wg.Wait()
+	r.elapsed = time.Since(start)
+
+	sort.Slice(r.latencies, func(i, j int) bool { return r.latencies[i] < r.latencies[j] })
+	return r
+}
+
+// quantile returns the q quantile of the measured latencies.
+func (r result) quantile(q float64) time.Duration {
+	if len(r.latencies) == 0 {
+		return 0
+	}
+	return r.latencies[int(q*float64(len(r.latencies)-1))]
+}
+
+// errnoToError converts the return value of the lookups to an error.
+func errnoToError(ret C.int) error {
+	if ret == 0 {
+		return nil
+	}
+	return syscall.Errno(ret)
+}
@@ -51,10 +51,14 @@ func TestIntegration(t *testing.T) {
 		"Get entry from passwd by id": {db: "passwd", key: "1111"},
 		"Get entry from group by id":  {db: "group", key: "11111"},
 
+		"Get groups of user from initgroups": {db: "initgroups", key: "user2"},
+
 		// Even though those are "error" cases, the getent command won't fail since the other databases on the machine will return some entries.
 		"Returns empty when getting all entries from passwd and daemon is not available": {db: "passwd", noDaemon: true},
 		"Returns empty when getting all entries from group and daemon is not available":  {db: "group", noDaemon: true},
 		"Returns empty when getting all entries from shadow and daemon is not available": {db: "shadow", noDaemon: true},
+		"Returns no groups from initgroups when user does not exist":                     {db: "initgroups", key: "doesnotexist"},
+		"Returns no groups from initgroups when daemon is not available":                 {db: "initgroups", key: "user2", noDaemon: true},
 
 		"Returns empty when getting all entries from passwd after cleaning corrupted database": {db: "passwd", cacheDB: "invalid_entry_in_userByID", wantSecondCall: true},
 		"Returns empty when getting all entries from group after cleaning corrupted database":  {db: "group", cacheDB: "invalid_entry_in_groupByID", wantSecondCall: true},
@@ -0,0 +1,179 @@
+use libc::c_void;
+use std::collections::HashMap;
+use std::ffi::CString;
+use std::hash::Hash;
+use std::sync::atomic::{AtomicU32, Ordering};
+use std::sync::Mutex;
+use std::time::{Duration, Instant};
+use tonic::{Code, Status};
+
+/// The maximum number of results kept by each cache.
+const CAPACITY: usize = 256;
+
+/// The time for which found and not found results are kept.
+const POSITIVE_TTL: Duration = Duration::from_secs(30);
+const NEGATIVE_TTL: Duration = Duration::from_secs(10);
+
+// Size of the generation counter published by the daemon, see internal/cache/snapshot.go.
+const GENERATION_SIZE: usize = 4;
+
+lazy_static! {
+    /// The mapping of the generation counter, once it could be mapped.
+    static ref GENERATION: Mutex<Option<usize>> = Mutex::new(None);
+}
+
+/// generation returns the current value of the generation counter the daemon increments on each change of its
+/// database, or None if it's not available.
+fn generation() -> Option<u32> {
+    let mut mapping = GENERATION.lock().ok()?;
+    if mapping.is_none() {
+        *mapping = map_generation(&format!("{}.generation", super::snapshot_path()));
+    }
+
+    let counter = unsafe { &*((*mapping)? as *const AtomicU32) };
+    Some(counter.load(Ordering::Acquire))
+}
+
+/// map_generation maps the generation counter file in memory. The mapping is never released, as the file is never
+/// replaced by the daemon.
+fn map_generation(path: &str) -> Option<usize> {
+    let c_path = CString::new(path).ok()?;
+
+    let fd = unsafe { libc::open(c_path.as_ptr(), libc::O_RDONLY | libc::O_CLOEXEC) };
+    if fd < 0 {
+        return None;
+    }
+
+    let mut stat: libc::stat = unsafe { std::mem::zeroed() };
+    let ptr =
+        if unsafe { libc::fstat(fd, &mut stat) } == 0 && stat.st_size as usize == GENERATION_SIZE {
+            unsafe {
+                libc::mmap(
+                    std::ptr::null_mut(),
+                    GENERATION_SIZE,
+                    libc::PROT_READ,
+                    libc::MAP_SHARED,
+                    fd,
+                    0,
+                )
+            }
+        } else {
+            libc::MAP_FAILED
+        };
+    unsafe {
+        libc::close(fd);
+    }
+
+    if ptr == libc::MAP_FAILED {
+        return None;
+    }
+    Some(ptr as *const c_void as usize)
+}
+
+/// Entry is a cached result, None being a not found one.
+struct Entry<V> {
+    value: Option<V>,
+    generation: u32,
+    expires: Instant,
+    last_used: u64,
+}
+
+/// ResultCache is a bounded LRU cache of the results returned by the gRPC server.
+pub struct ResultCache<K, V> {
+    entries: HashMap<K, Entry<V>>,
+    uses: u64,
+}
+
+impl<K: Eq + Hash + Clone, V: Clone> ResultCache<K, V> {
+    pub fn new() -> Self {
+        ResultCache {
+            entries: HashMap::new(),
+            uses: 0,
+        }
+    }
+
+    /// get returns the result cached for key, if it's still valid for generation.
+    fn get(&mut self, key: &K, generation: u32) -> Option<Option<V>> {
+        self.uses += 1;
+
+        let entry = self.entries.get_mut(key)?;
+        if entry.generation != generation || entry.expires <= Instant::now() {
+            self.entries.remove(key);
+            return None;
+        }
+
+        entry.last_used = self.uses;
+        Some(entry.value.clone())
+    }
+
+    /// insert caches the result for key, evicting the least recently used one if the cache is full.
+    fn insert(&mut self, key: K, value: Option<V>, generation: u32) {
+        if self.entries.len() >= CAPACITY {
+            let now = Instant::now();
+            self.entries.retain(|_, e| e.expires > now);
+        }
+        if self.entries.len() >= CAPACITY {
+            let lru = self
+                .entries
+                .iter()
+                .min_by_key(|(_, e)| e.last_used)
+                .map(|(k, _)| k.clone());
+            if let Some(lru) = lru {
+                self.entries.remove(&lru);
+            }
+        }
+
+        let ttl = if value.is_some() {
+            POSITIVE_TTL
+        } else {
+            NEGATIVE_TTL
+        };
+        self.entries.insert(
+            key,
+            Entry {
+                value,
+                generation,
+                expires: Instant::now() + ttl,
+                last_used: self.uses,
+            },
+        );
+    }
+}
+
+/// lookup returns the result for key from cache, or the one returned by fetch, caching it if the entry was found or
+/// does not exist.
+///
+/// Results are only cached while the daemon publishes its generation counter, and until it changes.
+pub fn lookup<K, V, F>(cache: &Mutex<ResultCache<K, V>>, key: K, fetch: F) -> Result<V, Status>
+where
+    K: Eq + Hash + Clone,
+    V: Clone,
+    F: FnOnce() -> Result<V, Status>,
+{
+    // The generation is read before fetching the result, so that a result fetched while the daemon updates its
+    // database is only cached for the previous generation.
+    let generation = match generation() {
+        Some(g) => g,
+        None => return fetch(),
+    };
+
+    if let Ok(mut cache) = cache.lock() {
+        match cache.get(&key, generation) {
+            Some(Some(value)) => return Ok(value),
+            Some(None) => return Err(Status::not_found("")),
+            None => {}
+        }
+    }
+
+    let result = fetch();
+    let value = match &result {
+        Ok(value) => Some(value.clone()),
+        Err(e) if e.code() == Code::NotFound => None,
+        Err(_) => return result,
+    };
+
+    if let Ok(mut cache) = cache.lock() {
+        cache.insert(key, value, generation);
+    }
+    result
+}
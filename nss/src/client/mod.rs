@@ -1,17 +1,47 @@
 use authd::nss_client::NssClient;
 use std::error::Error;
+use std::future::Future;
+use std::sync::{Arc, Mutex};
 use tokio::net::UnixStream;
+use tokio::runtime::{Builder, Runtime};
 use tonic::transport::{Channel, Endpoint, Uri};
+use tonic::{Code, Status};
 use tower::service_fn;
 
-use crate::debug;
+use crate::{debug, error};
 
 pub mod authd {
     tonic::include_proto!("authd");
 }
 
-/// new_client creates a new client connection to the gRPC server or returns an active one.
-pub async fn new_client() -> Result<NssClient<Channel>, Box<dyn Error>> {
+/// Connection is the runtime and the client connection to the gRPC server shared by all the NSS calls of a process.
+struct Connection {
+    /// pid is the process that created the connection, it can't be used by forked children.
+    pid: u32,
+    runtime: Arc<Runtime>,
+    client: NssClient<Channel>,
+}
+
+lazy_static! {
+    static ref CONNECTION: Mutex<Option<Connection>> = Mutex::new(None);
+}
+
+/// new_client creates a new client connection to the gRPC server.
+async fn new_client() -> Result<NssClient<Channel>, Box<dyn Error>> {
+    debug!("Connecting to authd on {}...", super::socket_path());
+
+    // The URL must have a valid format, even though we don't use it.
+    let ch = Endpoint::try_from("https://not-used:404")?
+        .connect_with_connector(service_fn(|_: Uri| {
+            UnixStream::connect(super::socket_path())
+        }))
+        .await?;
+
+    Ok(NssClient::new(ch))
+}
+
+/// connection returns the process-wide runtime and client, creating them if needed.
+fn connection() -> Result<(Arc<Runtime>, NssClient<Channel>), Box<dyn Error>> {
     // We need to skip NSS lookups performed by dbus through systemd, otherwise
     // we could end up in a deadlock due to lookups happening while the authd
     // daemon is starting up.
@@ -22,14 +52,81 @@ pub async fn new_client() -> Result<NssClient<Channel>, Box<dyn Error>> {
         return Err("NSS lookup performed through systemd, skipping...".into());
     }
 
-    debug!("Connecting to authd on {}...", super::socket_path());
+    let mut connection = CONNECTION
+        .lock()
+        .map_err(|_| "connection to the gRPC server is poisoned")?;
 
-    // The URL must have a valid format, even though we don't use it.
-    let ch = Endpoint::try_from("https://not-used:404")?
-        .connect_with_connector(service_fn(|_: Uri| {
-            UnixStream::connect(super::socket_path())
-        }))
-        .await?;
+    let pid = std::process::id();
+    if let Some(c) = connection.as_ref() {
+        if c.pid == pid {
+            return Ok((c.runtime.clone(), c.client.clone()));
+        }
 
-    Ok(NssClient::new(ch))
+        // We have been forked: the runtime of the parent process can neither be used nor dropped from here.
+        debug!(
+            "process forked, discarding the connection of parent {}",
+            c.pid
+        );
+        std::mem::forget(connection.take());
+    }
+
+    let runtime = match Builder::new_current_thread().enable_all().build() {
+        Ok(rt) => Arc::new(rt),
+        Err(e) => {
+            error!("could not create runtime for NSS: {}", e);
+            return Err(e.into());
+        }
+    };
+    let client = runtime.block_on(new_client())?;
+
+    *connection = Some(Connection {
+        pid,
+        runtime: runtime.clone(),
+        client: client.clone(),
+    });
+
+    Ok((runtime, client))
+}
+
+/// reset drops the process-wide connection, so that the next call connects again.
+fn reset() {
+    if let Ok(mut connection) = CONNECTION.lock() {
+        if connection
+            .as_ref()
+            .is_some_and(|c| c.pid == std::process::id())
+        {
+            *connection = None;
+        }
+    }
+}
+
+/// call runs the request performed by f on the process-wide connection to the gRPC server.
+///
+/// If the request fails because the connection is unavailable, f is called once more on a new
+/// connection. Other errors are returned by the server itself, so retrying them would only repeat
+/// the request.
+pub fn call<T, F, Fut>(f: F) -> Result<T, Status>
+where
+    F: Fn(NssClient<Channel>) -> Fut,
+    Fut: Future<Output = Result<T, Status>>,
+{
+    let mut retried = false;
+    loop {
+        let (runtime, client) = connection().map_err(|e| {
+            error!("could not connect to gRPC server: {}", e);
+            Status::unavailable(e.to_string())
+        })?;
+
+        match runtime.block_on(f(client)) {
+            Err(e) if !retried && e.code() == Code::Unavailable => {
+                debug!(
+                    "request to gRPC server failed, reconnecting: {}",
+                    e.message()
+                );
+                reset();
+                retried = true;
+            }
+            r => return r,
+        }
+    }
 }
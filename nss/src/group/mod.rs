@@ -1,12 +1,27 @@
 use crate::error;
-use libc::gid_t;
+use libc::{c_char, c_int, c_long, gid_t};
 use libnss::group::{Group, GroupHooks};
 use libnss::interop::Response;
-use tokio::runtime::Builder;
-use tonic::Request;
+use std::ffi::CStr;
+use std::sync::Mutex;
+use tonic::{Request, Status};
 
+use crate::cache::{self, ResultCache};
 use crate::client::{self, authd};
-use authd::GroupEntry;
+use crate::snapshot;
+use authd::{GroupEntry, UserGroups};
+
+lazy_static! {
+    static ref BY_GID: Mutex<ResultCache<gid_t, GroupEntry>> = Mutex::new(ResultCache::new());
+    static ref BY_NAME: Mutex<ResultCache<String, GroupEntry>> = Mutex::new(ResultCache::new());
+    static ref BY_USER: Mutex<ResultCache<String, UserGroups>> = Mutex::new(ResultCache::new());
+}
+
+// NSS status codes, see nss.h. The libnss hooks macros don't provide the initgroups entry point.
+const NSS_STATUS_TRYAGAIN: c_int = -2;
+const NSS_STATUS_UNAVAIL: c_int = -1;
+const NSS_STATUS_NOTFOUND: c_int = 0;
+const NSS_STATUS_SUCCESS: c_int = 1;
 
 pub struct AuthdGroup;
 impl GroupHooks for AuthdGroup {
@@ -26,94 +41,164 @@ impl GroupHooks for AuthdGroup {
     }
 }
 
-/// get_all_entries connects to the grpc server and asks for all group entries.
+/// get_all_entries looks up all group entries in the cache snapshot, or connects to the grpc server and asks for them.
 fn get_all_entries() -> Response<Vec<Group>> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
-        Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
-        }
-    };
+    if let Some(r) = snapshot::group_entries() {
+        return r;
+    }
 
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
-            }
-        };
-
-        let request = Request::new(authd::Empty {});
-        match client.get_group_entries(request).await {
-            Ok(r) => Response::Success(group_entries_to_groups(r.into_inner().entries)),
-            Err(e) => {
-                error!("error when listing groups: {}", e.message());
-                super::grpc_status_to_nss_response(e)
+    let r = client::call(|mut c| {
+        let req = Request::new(authd::Empty {});
+        async move {
+            // The whole enumeration is returned to the libnss hooks, so every streamed group is kept.
+            let mut stream = c.stream_group_entries(req).await?.into_inner();
+            let mut entries = Vec::new();
+            while let Some(entry) = stream.message().await? {
+                entries.push(group_entry_to_group(entry));
             }
+            Ok::<_, Status>(entries)
         }
-    })
-}
+    });
 
-/// get_entry_by_gid connects to the grpc server and asks for the group entry with the given gid.
-fn get_entry_by_gid(gid: gid_t) -> Response<Group> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
+    match r {
+        Ok(entries) => Response::Success(entries),
         Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
+            error!("error when listing groups: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
-    };
+    }
+}
 
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
-            }
-        };
-
-        let req = Request::new(authd::GetByIdRequest { id: gid });
-        match client.get_group_by_gid(req).await {
-            Ok(r) => Response::Success(group_entry_to_group(r.into_inner())),
-            Err(e) => {
-                error!("error when getting group by gid: {}", e.message());
-                super::grpc_status_to_nss_response(e)
-            }
+/// get_entry_by_gid looks up the group entry with the given gid in the cache snapshot or in the
+/// results of previous calls, or connects to the grpc server and asks for it.
+fn get_entry_by_gid(gid: gid_t) -> Response<Group> {
+    if let Some(r) = snapshot::group_by_gid(gid) {
+        return r;
+    }
+
+    let r = cache::lookup(&BY_GID, gid, || {
+        client::call(|mut c| {
+            let req = Request::new(authd::GetByIdRequest { id: gid });
+            async move { c.get_group_by_gid(req).await.map(|r| r.into_inner()) }
+        })
+    });
+
+    match r {
+        Ok(r) => Response::Success(group_entry_to_group(r)),
+        Err(e) => {
+            error!("error when getting group by gid: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
-    })
+    }
 }
 
-/// get_entry_by_name connects to the grpc server and asks for the group entry with the given name.
+/// get_entry_by_name looks up the group entry with the given name in the cache snapshot or in the
+/// results of previous calls, or connects to the grpc server and asks for it.
 fn get_entry_by_name(name: String) -> Response<Group> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
+    if let Some(r) = snapshot::group_by_name(&name) {
+        return r;
+    }
+
+    let r = cache::lookup(&BY_NAME, name.clone(), || {
+        client::call(|mut c| {
+            let req = Request::new(authd::GetByNameRequest { name: name.clone() });
+            async move { c.get_group_by_name(req).await.map(|r| r.into_inner()) }
+        })
+    });
+
+    match r {
+        Ok(r) => Response::Success(group_entry_to_group(r)),
         Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
+            error!("error when getting group by name: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
+    }
+}
+
+/// _nss_authd_initgroups_dyn is the NSS entry point used by initgroups and getgrouplist. It appends the gids of the
+/// groups of user, except skip_group, to the groupsp array of size elements, of which start are used. The array is
+/// grown up to limit elements, if limit is positive.
+///
+/// Without it, glibc would enumerate all groups to find the ones user is a member of.
+///
+/// # Safety
+///
+/// It's called by glibc, with valid pointers to the arguments and an array allocated with malloc.
+#[no_mangle]
+pub unsafe extern "C" fn _nss_authd_initgroups_dyn(
+    user: *const c_char,
+    skip_group: gid_t,
+    start: *mut c_long,
+    size: *mut c_long,
+    groupsp: *mut *mut gid_t,
+    limit: c_long,
+    errnop: *mut c_int,
+) -> c_int {
+    let name = match CStr::from_ptr(user).to_str() {
+        Ok(name) => name.to_string(),
+        Err(_) => return NSS_STATUS_NOTFOUND,
     };
 
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
+    let gids = match get_groups_by_user(name) {
+        Response::Success(gids) => gids,
+        Response::NotFound => return NSS_STATUS_NOTFOUND,
+        _ => return NSS_STATUS_UNAVAIL,
+    };
+
+    for gid in gids {
+        if gid == skip_group {
+            continue;
+        }
+        let groups = std::slice::from_raw_parts(*groupsp, *start as usize);
+        if groups.contains(&gid) {
+            continue;
+        }
+
+        if *start == *size {
+            if limit > 0 && *size >= limit {
+                // The caller is only interested in the first limit groups.
+                break;
+            }
+            let mut new_size = (2 * *size).max(1);
+            if limit > 0 {
+                new_size = new_size.min(limit);
             }
-        };
-
-        let req = Request::new(authd::GetByNameRequest { name });
-        match client.get_group_by_name(req).await {
-            Ok(r) => Response::Success(group_entry_to_group(r.into_inner())),
-            Err(e) => {
-                error!("error when getting group by name: {}", e.message());
-                super::grpc_status_to_nss_response(e)
+            let new_groups = libc::realloc(
+                *groupsp as *mut libc::c_void,
+                new_size as usize * std::mem::size_of::<gid_t>(),
+            ) as *mut gid_t;
+            if new_groups.is_null() {
+                *errnop = libc::ENOMEM;
+                return NSS_STATUS_TRYAGAIN;
             }
+            *groupsp = new_groups;
+            *size = new_size;
         }
-    })
+
+        *(*groupsp).add(*start as usize) = gid;
+        *start += 1;
+    }
+
+    NSS_STATUS_SUCCESS
+}
+
+/// get_groups_by_user looks up the gids of the groups of the user with the given name in the results of previous
+/// calls, or connects to the grpc server and asks for them.
+fn get_groups_by_user(name: String) -> Response<Vec<gid_t>> {
+    let r = cache::lookup(&BY_USER, name.clone(), || {
+        client::call(|mut c| {
+            let req = Request::new(authd::GetByNameRequest { name: name.clone() });
+            async move { c.get_user_groups(req).await.map(|r| r.into_inner()) }
+        })
+    });
+
+    match r {
+        Ok(r) => Response::Success(r.gids),
+        Err(e) => {
+            error!("error when getting groups of user: {}", e.message());
+            super::grpc_status_to_nss_response(e)
+        }
+    }
 }
 
 /// group_entry_to_group converts a GroupEntry to a libnss::Group.
@@ -125,8 +210,3 @@ fn group_entry_to_group(entry: GroupEntry) -> Group {
         members: entry.members,
     }
 }
-
-/// group_entries_to_groups converts a Vec<GroupEntry> to a Vec<libnss::Group>.
-fn group_entries_to_groups(entries: Vec<GroupEntry>) -> Vec<Group> {
-    entries.into_iter().map(group_entry_to_group).collect()
-}
@@ -17,8 +17,12 @@ libnss_shadow_hooks!(authd, AuthdShadow);
 
 mod logs;
 
+mod cache;
+
 mod client;
 
+mod snapshot;
+
 /// socket_path returns the socket path to connect to the gRPC server.
 ///
 /// It uses the AUTHD_NSS_SOCKET env value if set and the custom_socket feature is enabled,
@@ -37,6 +41,24 @@ fn socket_path() -> String {
     "/run/authd.sock".to_string()
 }
 
+/// snapshot_path returns the path of the cache snapshot published by the daemon.
+///
+/// It uses the AUTHD_NSS_SNAPSHOT env value if set and the custom_socket feature is enabled,
+/// otherwise it uses the default path.
+fn snapshot_path() -> String {
+    #[cfg(feature = "custom_socket")]
+    match std::env::var("AUTHD_NSS_SNAPSHOT") {
+        Ok(s) => return s,
+        Err(err) => {
+            debug!(
+                "AUTHD_NSS_SNAPSHOT not set or badly configured, using default value: {}",
+                err
+            );
+        }
+    }
+    "/run/authd-nss.snapshot".to_string()
+}
+
 /// grpc_status_to_nss_response converts a gRPC status to a NSS response.
 fn grpc_status_to_nss_response<T>(status: Status) -> Response<T> {
     match status.code() {
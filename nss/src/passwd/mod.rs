@@ -2,12 +2,19 @@ use crate::error;
 use libc::uid_t;
 use libnss::interop::Response;
 use libnss::passwd::{Passwd, PasswdHooks};
-use tokio::runtime::Builder;
-use tonic::Request;
+use std::sync::Mutex;
+use tonic::{Request, Status};
 
+use crate::cache::{self, ResultCache};
 use crate::client::{self, authd};
+use crate::snapshot;
 use authd::PasswdEntry;
 
+lazy_static! {
+    static ref BY_UID: Mutex<ResultCache<uid_t, PasswdEntry>> = Mutex::new(ResultCache::new());
+    static ref BY_NAME: Mutex<ResultCache<String, PasswdEntry>> = Mutex::new(ResultCache::new());
+}
+
 pub struct AuthdPasswd;
 impl PasswdHooks for AuthdPasswd {
     /// get_all_entries returns all passwd entries.
@@ -26,94 +33,78 @@ impl PasswdHooks for AuthdPasswd {
     }
 }
 
-/// get_all_entries connects to the grpc server and asks for all passwd entries.
+/// get_all_entries looks up all passwd entries in the cache snapshot, or connects to the grpc server and asks for them.
 fn get_all_entries() -> Response<Vec<Passwd>> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
-        Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
-        }
-    };
-
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
-            }
-        };
+    if let Some(r) = snapshot::passwd_entries() {
+        return r;
+    }
 
+    let r = client::call(|mut c| {
         let req = Request::new(authd::Empty {});
-        match client.get_passwd_entries(req).await {
-            Ok(r) => Response::Success(passwd_entries_to_passwds(r.into_inner().entries)),
-            Err(e) => {
-                error!("error when listing passwd: {}", e.message());
-                super::grpc_status_to_nss_response(e)
+        async move {
+            // The libnss hooks need all the entries at once, so they are collected as they are streamed.
+            let mut stream = c.stream_passwd_entries(req).await?.into_inner();
+            let mut entries = Vec::new();
+            while let Some(entry) = stream.message().await? {
+                entries.push(passwd_entry_to_passwd(entry));
             }
+            Ok::<_, Status>(entries)
         }
-    })
-}
+    });
 
-/// get_entry_by_uid connects to the grpc server and asks for the passwd entry with the given uid.
-fn get_entry_by_uid(uid: uid_t) -> Response<Passwd> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
+    match r {
+        Ok(entries) => Response::Success(entries),
         Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
+            error!("error when listing passwd: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
-    };
+    }
+}
 
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
-            }
-        };
+/// get_entry_by_uid looks up the passwd entry with the given uid in the cache snapshot or in the
+/// results of previous calls, or connects to the grpc server and asks for it.
+fn get_entry_by_uid(uid: uid_t) -> Response<Passwd> {
+    if let Some(r) = snapshot::passwd_by_uid(uid) {
+        return r;
+    }
 
-        let req = Request::new(authd::GetByIdRequest { id: uid });
-        match client.get_passwd_by_uid(req).await {
-            Ok(r) => Response::Success(passwd_entry_to_passwd(r.into_inner())),
-            Err(e) => {
-                error!("error when getting passwd by uid: {}", e.message());
-                super::grpc_status_to_nss_response(e)
-            }
+    let r = cache::lookup(&BY_UID, uid, || {
+        client::call(|mut c| {
+            let req = Request::new(authd::GetByIdRequest { id: uid });
+            async move { c.get_passwd_by_uid(req).await.map(|r| r.into_inner()) }
+        })
+    });
+
+    match r {
+        Ok(r) => Response::Success(passwd_entry_to_passwd(r)),
+        Err(e) => {
+            error!("error when getting passwd by uid: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
-    })
+    }
 }
 
-/// get_entry_by_name connects to the grpc server and asks for the passwd entry with the given name.
+/// get_entry_by_name looks up the passwd entry with the given name in the cache snapshot or in the
+/// results of previous calls, or connects to the grpc server and asks for it.
 fn get_entry_by_name(name: String) -> Response<Passwd> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
-        Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
-        }
-    };
+    if let Some(r) = snapshot::passwd_by_name(&name) {
+        return r;
+    }
 
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
-            }
-        };
+    let r = cache::lookup(&BY_NAME, name.clone(), || {
+        client::call(|mut c| {
+            let req = Request::new(authd::GetByNameRequest { name: name.clone() });
+            async move { c.get_passwd_by_name(req).await.map(|r| r.into_inner()) }
+        })
+    });
 
-        let req = Request::new(authd::GetByNameRequest { name });
-        match client.get_passwd_by_name(req).await {
-            Ok(r) => Response::Success(passwd_entry_to_passwd(r.into_inner())),
-            Err(e) => {
-                error!("error when getting passwd by name: {}", e.message());
-                super::grpc_status_to_nss_response(e)
-            }
+    match r {
+        Ok(r) => Response::Success(passwd_entry_to_passwd(r)),
+        Err(e) => {
+            error!("error when getting passwd by name: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
-    })
+    }
 }
 
 /// passwd_entry_to_passwd converts a PasswdEntry to a libnss::Passwd.
@@ -128,8 +119,3 @@ fn passwd_entry_to_passwd(entry: PasswdEntry) -> Passwd {
         shell: entry.shell,
     }
 }
-
-/// passwd_entries_to_passwds converts a Vec<PasswdEntry> to a Vec<libnss::Passwd>.
-fn passwd_entries_to_passwds(entries: Vec<PasswdEntry>) -> Vec<Passwd> {
-    entries.into_iter().map(passwd_entry_to_passwd).collect()
-}
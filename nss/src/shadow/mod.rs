@@ -1,8 +1,7 @@
 use crate::error;
 use libnss::interop::Response;
 use libnss::shadow::{Shadow, ShadowHooks};
-use tokio::runtime::Builder;
-use tonic::Request;
+use tonic::{Request, Status};
 
 use crate::client::{self, authd};
 use authd::ShadowEntry;
@@ -23,65 +22,45 @@ impl ShadowHooks for AuthdShadow {
 
 /// get_all_entries connects to the grpc server and asks for all shadow entries.
 fn get_all_entries() -> Response<Vec<Shadow>> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
-        Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
-        }
-    };
-
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
-            }
-        };
-
+    let r = client::call(|mut c| {
         let req = Request::new(authd::Empty {});
-        match client.get_shadow_entries(req).await {
-            Ok(r) => Response::Success(shadow_entries_to_shadows(r.into_inner().entries)),
-            Err(e) => {
-                error!("error when listing shadow: {}", e.message());
-                super::grpc_status_to_nss_response(e)
+        async move {
+            // All the shadow entries are accumulated, as the libnss hooks take them in a single response.
+            let mut stream = c.stream_shadow_entries(req).await?.into_inner();
+            let mut entries = Vec::new();
+            while let Some(entry) = stream.message().await? {
+                entries.push(shadow_entry_to_shadow(entry));
             }
+            Ok::<_, Status>(entries)
         }
-    })
-}
+    });
 
-/// get_entry_by_name connects to the grpc server and asks for the shadow entry with the given name.
-fn get_entry_by_name(name: String) -> Response<Shadow> {
-    let rt = match Builder::new_current_thread().enable_all().build() {
-        Ok(rt) => rt,
+    match r {
+        Ok(entries) => Response::Success(entries),
         Err(e) => {
-            error!("could not create runtime for NSS: {}", e);
-            return Response::Unavail;
+            error!("error when listing shadow: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
-    };
+    }
+}
 
-    rt.block_on(async {
-        let mut client = match client::new_client().await {
-            Ok(c) => c,
-            Err(e) => {
-                error!("could not connect to gRPC server: {}", e);
-                return Response::Unavail;
-            }
-        };
+/// get_entry_by_name connects to the grpc server and asks for the shadow entry with the given name.
+fn get_entry_by_name(name: String) -> Response<Shadow> {
+    let r = client::call(|mut c| {
+        let req = Request::new(authd::GetByNameRequest { name: name.clone() });
+        async move { c.get_shadow_by_name(req).await }
+    });
 
-        let req = Request::new(authd::GetByNameRequest { name });
-        match client.get_shadow_by_name(req).await {
-            Ok(r) => Response::Success(shadow_entry_to_shadow(r.into_inner())),
-            Err(e) => {
-                error!("error when getting shadow by name: {}", e.message());
-                super::grpc_status_to_nss_response(e)
-            }
+    match r {
+        Ok(r) => Response::Success(shadow_entry_to_shadow(r.into_inner())),
+        Err(e) => {
+            error!("error when getting shadow by name: {}", e.message());
+            super::grpc_status_to_nss_response(e)
         }
-    })
+    }
 }
 
-/// shadow_entries_to_shadows converts a vector of shadow entries to a vector of shadows.
+/// shadow_entry_to_shadow converts a ShadowEntry to a libnss::Shadow.
 fn shadow_entry_to_shadow(entry: ShadowEntry) -> Shadow {
     Shadow {
         name: entry.name,
@@ -95,8 +74,3 @@ fn shadow_entry_to_shadow(entry: ShadowEntry) -> Shadow {
         reserved: usize::MAX,
     }
 }
-
-/// shadow_entries_to_shadows converts a vector of shadow entries to a vector of shadows.
-fn shadow_entries_to_shadows(entries: Vec<ShadowEntry>) -> Vec<Shadow> {
-    entries.into_iter().map(shadow_entry_to_shadow).collect()
-}
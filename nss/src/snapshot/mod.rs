@@ -0,0 +1,482 @@
+use libc::{c_void, gid_t, uid_t};
+use libnss::group::Group;
+use libnss::interop::Response;
+use libnss::passwd::Passwd;
+use std::ffi::CString;
+use std::ptr;
+use std::sync::atomic::{AtomicPtr, AtomicU32, AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex};
+use std::time::Instant;
+
+use crate::debug;
+
+// Layout of the snapshot published by the daemon, see internal/cache/snapshot.go.
+const MAGIC: &[u8] = b"AUTHDNSS";
+const VERSION: u32 = 1;
+
+const HEADER_SIZE: usize = 80;
+const VERSION_OFFSET: usize = 8;
+const STALE_FLAG_OFFSET: usize = 12;
+const SIZE_OFFSET: usize = 24;
+const N_USERS_OFFSET: usize = 28;
+const N_GROUPS_OFFSET: usize = 32;
+const N_MEMBERS_OFFSET: usize = 36;
+const USERS_OFFSET: usize = 40;
+const GROUPS_OFFSET: usize = 44;
+const MEMBERS_OFFSET: usize = 48;
+const USERS_BY_NAME_OFFSET: usize = 52;
+const USERS_BY_ID_OFFSET: usize = 56;
+const GROUPS_BY_NAME_OFFSET: usize = 60;
+const GROUPS_BY_ID_OFFSET: usize = 64;
+const STRINGS_OFFSET: usize = 68;
+const STRINGS_LEN_OFFSET: usize = 72;
+
+const USER_RECORD_SIZE: usize = 40;
+const GROUP_RECORD_SIZE: usize = 24;
+const STRING_REF_SIZE: usize = 8;
+const INDEX_ENTRY_SIZE: usize = 8;
+
+/// The minimum time between two attempts to map the snapshot, so that lookups don't keep trying
+/// when there is no usable snapshot.
+const REOPEN_INTERVAL_MS: u64 = 1000;
+
+/// The snapshot currently mapped, as returned by Arc::into_raw, or null if there is none.
+/// It's replaced once the daemon flags it as stale.
+static CURRENT: AtomicPtr<Snapshot> = AtomicPtr::new(ptr::null_mut());
+
+/// The number of readers that may have loaded CURRENT without holding a reference to it yet.
+static READERS: AtomicUsize = AtomicUsize::new(0);
+
+/// The time of the last attempt to map the snapshot, in milliseconds since EPOCH plus one, or 0.
+static LAST_OPEN: AtomicU64 = AtomicU64::new(0);
+
+lazy_static! {
+    static ref EPOCH: Instant = Instant::now();
+
+    /// The snapshots replaced in CURRENT that readers may still be taking a reference to.
+    /// Its lock also serializes the replacements of CURRENT.
+    static ref RETIRED: Mutex<Vec<Arc<Snapshot>>> = Mutex::new(Vec::new());
+}
+
+/// Section is a table of fixed-size entries in the snapshot.
+#[derive(Clone, Copy)]
+struct Section {
+    offset: usize,
+    len: usize,
+}
+
+/// Snapshot is a read-only memory mapping of the cache snapshot published by the daemon.
+pub struct Snapshot {
+    ptr: *const u8,
+    size: usize,
+
+    users: Section,
+    groups: Section,
+    members: Section,
+    users_by_name: Section,
+    users_by_id: Section,
+    groups_by_name: Section,
+    groups_by_id: Section,
+    strings: Section,
+}
+
+// The mapping is read-only and never mutated by us, apart from the stale flag that is atomically read.
+unsafe impl Send for Snapshot {}
+unsafe impl Sync for Snapshot {}
+
+impl Drop for Snapshot {
+    fn drop(&mut self) {
+        unsafe {
+            libc::munmap(self.ptr as *mut c_void, self.size);
+        }
+    }
+}
+
+impl Snapshot {
+    /// open maps the snapshot at path, returning None if it does not exist or is invalid.
+    fn open(path: &str) -> Option<Snapshot> {
+        let c_path = CString::new(path).ok()?;
+
+        let fd = unsafe { libc::open(c_path.as_ptr(), libc::O_RDONLY | libc::O_CLOEXEC) };
+        if fd < 0 {
+            return None;
+        }
+
+        let mut stat: libc::stat = unsafe { std::mem::zeroed() };
+        let ptr = if unsafe { libc::fstat(fd, &mut stat) } == 0
+            && is_trusted(&stat)
+            && stat.st_size as usize >= HEADER_SIZE
+        {
+            unsafe {
+                libc::mmap(
+                    std::ptr::null_mut(),
+                    stat.st_size as usize,
+                    libc::PROT_READ,
+                    libc::MAP_SHARED,
+                    fd,
+                    0,
+                )
+            }
+        } else {
+            libc::MAP_FAILED
+        };
+        unsafe {
+            libc::close(fd);
+        }
+        if ptr == libc::MAP_FAILED {
+            return None;
+        }
+
+        let mut snapshot = Snapshot {
+            ptr: ptr as *const u8,
+            size: stat.st_size as usize,
+            users: Section { offset: 0, len: 0 },
+            groups: Section { offset: 0, len: 0 },
+            members: Section { offset: 0, len: 0 },
+            users_by_name: Section { offset: 0, len: 0 },
+            users_by_id: Section { offset: 0, len: 0 },
+            groups_by_name: Section { offset: 0, len: 0 },
+            groups_by_id: Section { offset: 0, len: 0 },
+            strings: Section { offset: 0, len: 0 },
+        };
+        if !snapshot.load_header() {
+            debug!("ignoring invalid NSS snapshot {}", path);
+            return None;
+        }
+
+        debug!("mapped NSS snapshot {}", path);
+        Some(snapshot)
+    }
+
+    /// load_header validates the snapshot header and loads the sections it describes.
+    fn load_header(&mut self) -> bool {
+        if self.bytes(0, MAGIC.len()) != Some(MAGIC)
+            || self.u32_at(VERSION_OFFSET) != Some(VERSION)
+            || self.usize_at(SIZE_OFFSET) != Some(self.size)
+        {
+            return false;
+        }
+
+        let header = |off| self.usize_at(off).unwrap_or(usize::MAX);
+        let (n_users, n_groups, n_members) = (
+            header(N_USERS_OFFSET),
+            header(N_GROUPS_OFFSET),
+            header(N_MEMBERS_OFFSET),
+        );
+        let section = |off, len| Section {
+            offset: header(off),
+            len,
+        };
+        let sections = [
+            section(USERS_OFFSET, n_users),
+            section(GROUPS_OFFSET, n_groups),
+            section(MEMBERS_OFFSET, n_members),
+            section(USERS_BY_NAME_OFFSET, n_users),
+            section(USERS_BY_ID_OFFSET, n_users),
+            section(GROUPS_BY_NAME_OFFSET, n_groups),
+            section(GROUPS_BY_ID_OFFSET, n_groups),
+            section(STRINGS_OFFSET, header(STRINGS_LEN_OFFSET)),
+        ];
+        [
+            self.users,
+            self.groups,
+            self.members,
+            self.users_by_name,
+            self.users_by_id,
+            self.groups_by_name,
+            self.groups_by_id,
+            self.strings,
+        ] = sections;
+
+        [
+            (self.users, USER_RECORD_SIZE),
+            (self.groups, GROUP_RECORD_SIZE),
+            (self.members, STRING_REF_SIZE),
+            (self.users_by_name, INDEX_ENTRY_SIZE),
+            (self.users_by_id, INDEX_ENTRY_SIZE),
+            (self.groups_by_name, INDEX_ENTRY_SIZE),
+            (self.groups_by_id, INDEX_ENTRY_SIZE),
+            (self.strings, 1),
+        ]
+        .iter()
+        .all(|(s, entry_size)| {
+            s.len
+                .checked_mul(*entry_size)
+                .and_then(|len| s.offset.checked_add(len))
+                .is_some_and(|end| s.offset >= HEADER_SIZE && end <= self.size)
+        })
+    }
+
+    /// is_stale returns true if the daemon published a newer snapshot or withdrew this one.
+    fn is_stale(&self) -> bool {
+        let flag = unsafe { &*(self.ptr.add(STALE_FLAG_OFFSET) as *const AtomicU32) };
+        u32::from_le(flag.load(Ordering::Acquire)) != 0
+    }
+
+    /// bytes returns the len bytes at off, if they are within the mapping.
+    fn bytes(&self, off: usize, len: usize) -> Option<&[u8]> {
+        if off.checked_add(len)? > self.size {
+            return None;
+        }
+        Some(unsafe { std::slice::from_raw_parts(self.ptr.add(off), len) })
+    }
+
+    /// u32_at returns the little-endian integer at off.
+    fn u32_at(&self, off: usize) -> Option<u32> {
+        if off.checked_add(4)? > self.size {
+            return None;
+        }
+        Some(u32::from_le(unsafe {
+            std::ptr::read_unaligned(self.ptr.add(off) as *const u32)
+        }))
+    }
+
+    fn usize_at(&self, off: usize) -> Option<usize> {
+        self.u32_at(off).map(|v| v as usize)
+    }
+
+    /// string_at returns the string referenced at off.
+    fn string_at(&self, off: usize) -> Option<String> {
+        let (start, len) = (self.usize_at(off)?, self.usize_at(off + 4)?);
+        if start.checked_add(len)? > self.strings.len {
+            return None;
+        }
+        let bytes = self.bytes(self.strings.offset + start, len)?;
+        String::from_utf8(bytes.to_vec()).ok()
+    }
+
+    /// entry_offset returns the offset of the entry at index of a section.
+    fn entry_offset(section: Section, index: usize, entry_size: usize) -> Option<usize> {
+        if index >= section.len {
+            return None;
+        }
+        Some(section.offset + index * entry_size)
+    }
+
+    /// find returns the record indexes whose key matches in the sorted index, or None if the snapshot is invalid.
+    fn find(&self, index: Section, key: u32) -> Option<Vec<usize>> {
+        let key_at = |i| self.u32_at(Snapshot::entry_offset(index, i, INDEX_ENTRY_SIZE)?);
+
+        // Lower bound of key.
+        let (mut low, mut high) = (0, index.len);
+        while low < high {
+            let mid = low + (high - low) / 2;
+            if key_at(mid)? < key {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        let mut records = Vec::new();
+        for i in low..index.len {
+            if key_at(i)? != key {
+                break;
+            }
+            records.push(self.usize_at(Snapshot::entry_offset(index, i, INDEX_ENTRY_SIZE)? + 4)?);
+        }
+        Some(records)
+    }
+
+    /// passwd returns the user record at index.
+    fn passwd(&self, index: usize) -> Option<Passwd> {
+        let off = Snapshot::entry_offset(self.users, index, USER_RECORD_SIZE)?;
+        Some(Passwd {
+            uid: self.u32_at(off)?,
+            gid: self.u32_at(off + 4)?,
+            name: self.string_at(off + 8)?,
+            passwd: "x".to_string(),
+            gecos: self.string_at(off + 16)?,
+            dir: self.string_at(off + 24)?,
+            shell: self.string_at(off + 32)?,
+        })
+    }
+
+    /// group returns the group record at index.
+    fn group(&self, index: usize) -> Option<Group> {
+        let off = Snapshot::entry_offset(self.groups, index, GROUP_RECORD_SIZE)?;
+        let (first_member, n_members) = (self.usize_at(off + 12)?, self.usize_at(off + 16)?);
+
+        let mut members = Vec::with_capacity(n_members.min(self.members.len));
+        for i in first_member..first_member.checked_add(n_members)? {
+            members.push(self.string_at(Snapshot::entry_offset(
+                self.members,
+                i,
+                STRING_REF_SIZE,
+            )?)?);
+        }
+
+        Some(Group {
+            gid: self.u32_at(off)?,
+            name: self.string_at(off + 4)?,
+            passwd: "x".to_string(),
+            members,
+        })
+    }
+
+    fn passwd_by_uid(&self, uid: uid_t) -> Option<Response<Passwd>> {
+        match self.find(self.users_by_id, uid)?.first() {
+            Some(i) => self.passwd(*i).map(Response::Success),
+            None => Some(Response::NotFound),
+        }
+    }
+
+    fn passwd_by_name(&self, name: &str) -> Option<Response<Passwd>> {
+        for i in self.find(self.users_by_name, name_hash(name))? {
+            let entry = self.passwd(i)?;
+            if entry.name == name {
+                return Some(Response::Success(entry));
+            }
+        }
+        Some(Response::NotFound)
+    }
+
+    fn group_by_gid(&self, gid: gid_t) -> Option<Response<Group>> {
+        match self.find(self.groups_by_id, gid)?.first() {
+            Some(i) => self.group(*i).map(Response::Success),
+            None => Some(Response::NotFound),
+        }
+    }
+
+    fn group_by_name(&self, name: &str) -> Option<Response<Group>> {
+        for i in self.find(self.groups_by_name, name_hash(name))? {
+            let entry = self.group(i)?;
+            if entry.name == name {
+                return Some(Response::Success(entry));
+            }
+        }
+        Some(Response::NotFound)
+    }
+}
+
+/// is_trusted returns true if the snapshot file can only have been written by the daemon.
+#[cfg(not(feature = "custom_socket"))]
+fn is_trusted(stat: &libc::stat) -> bool {
+    stat.st_uid == 0 && stat.st_mode & (libc::S_IWGRP | libc::S_IWOTH) == 0
+}
+
+/// is_trusted returns true if the snapshot file can only have been written by the daemon.
+///
+/// With the custom_socket feature the daemon is not expected to run as root.
+#[cfg(feature = "custom_socket")]
+fn is_trusted(stat: &libc::stat) -> bool {
+    stat.st_mode & (libc::S_IWGRP | libc::S_IWOTH) == 0
+}
+
+/// name_hash returns the FNV-1a hash of name, used as key of the name indexes.
+fn name_hash(name: &str) -> u32 {
+    name.bytes().fold(0x811c9dc5, |hash, b| {
+        (hash ^ b as u32).wrapping_mul(0x01000193)
+    })
+}
+
+/// load returns a reference to the snapshot currently mapped, without locking.
+fn load() -> Option<Arc<Snapshot>> {
+    READERS.fetch_add(1, Ordering::SeqCst);
+    let current = CURRENT.load(Ordering::SeqCst);
+    let snapshot = (!current.is_null()).then(|| unsafe {
+        // The reference owned by CURRENT is only released by replace once no reader is counted,
+        // so the snapshot is still alive here.
+        Arc::increment_strong_count(current);
+        Arc::from_raw(current)
+    });
+    READERS.fetch_sub(1, Ordering::SeqCst);
+    snapshot
+}
+
+/// replace publishes snapshot as the current one. The replaced snapshot is released once no
+/// reader can still be taking a reference to it.
+fn replace(retired: &mut Vec<Arc<Snapshot>>, snapshot: Option<Arc<Snapshot>>) {
+    let new = snapshot.map_or(ptr::null_mut(), |s| Arc::into_raw(s) as *mut Snapshot);
+    let old = CURRENT.swap(new, Ordering::SeqCst);
+    if !old.is_null() {
+        retired.push(unsafe { Arc::from_raw(old) });
+    }
+
+    // Readers counted from now on can only load the new snapshot.
+    if READERS.load(Ordering::SeqCst) == 0 {
+        retired.clear();
+    }
+}
+
+/// now returns the time elapsed since EPOCH in milliseconds, plus one so that it's never 0.
+fn now() -> u64 {
+    EPOCH.elapsed().as_millis() as u64 + 1
+}
+
+/// reopen_allowed returns true if the snapshot was not mapped in the last REOPEN_INTERVAL_MS.
+fn reopen_allowed() -> bool {
+    let last = LAST_OPEN.load(Ordering::Relaxed);
+    last == 0 || now().saturating_sub(last) >= REOPEN_INTERVAL_MS
+}
+
+/// current returns the latest snapshot published by the daemon, mapping it again if it has been
+/// replaced. Lookups don't lock unless the snapshot needs to be mapped again, which is attempted at
+/// most once every REOPEN_INTERVAL_MS: None is returned meanwhile.
+fn current() -> Option<Arc<Snapshot>> {
+    if let Some(snapshot) = load() {
+        if !snapshot.is_stale() {
+            return Some(snapshot);
+        }
+    }
+
+    if !reopen_allowed() {
+        return None;
+    }
+    // Another thread is already mapping the snapshot.
+    let mut retired = RETIRED.try_lock().ok()?;
+    if let Some(snapshot) = load() {
+        if !snapshot.is_stale() {
+            return Some(snapshot);
+        }
+    }
+    if !reopen_allowed() {
+        return None;
+    }
+
+    LAST_OPEN.store(now(), Ordering::Relaxed);
+    let snapshot = Snapshot::open(&super::snapshot_path()).map(Arc::new);
+    if snapshot.is_none() {
+        debug!("no usable snapshot, retrying in {}ms", REOPEN_INTERVAL_MS);
+    }
+    replace(&mut retired, snapshot.clone());
+    snapshot
+}
+
+/// passwd_by_uid returns the passwd entry for the given uid, or None if there is no usable snapshot.
+pub fn passwd_by_uid(uid: uid_t) -> Option<Response<Passwd>> {
+    current()?.passwd_by_uid(uid)
+}
+
+/// passwd_by_name returns the passwd entry for the given name, or None if there is no usable snapshot.
+pub fn passwd_by_name(name: &str) -> Option<Response<Passwd>> {
+    current()?.passwd_by_name(name)
+}
+
+/// passwd_entries returns all passwd entries, or None if there is no usable snapshot.
+pub fn passwd_entries() -> Option<Response<Vec<Passwd>>> {
+    let snapshot = current()?;
+    let entries: Option<Vec<Passwd>> = (0..snapshot.users.len)
+        .map(|i| snapshot.passwd(i))
+        .collect();
+    entries.map(Response::Success)
+}
+
+/// group_by_gid returns the group entry for the given gid, or None if there is no usable snapshot.
+pub fn group_by_gid(gid: gid_t) -> Option<Response<Group>> {
+    current()?.group_by_gid(gid)
+}
+
+/// group_by_name returns the group entry for the given name, or None if there is no usable snapshot.
+pub fn group_by_name(name: &str) -> Option<Response<Group>> {
+    current()?.group_by_name(name)
+}
+
+/// group_entries returns all group entries, or None if there is no usable snapshot.
+pub fn group_entries() -> Option<Response<Vec<Group>>> {
+    let snapshot = current()?;
+    let entries: Option<Vec<Group>> = (0..snapshot.groups.len)
+        .map(|i| snapshot.group(i))
+        .collect();
+    entries.map(Response::Success)
+}
@@ -113,24 +113,10 @@ func (m authModeSelectionModel) Update(msg tea.Msg) (authModeSelectionModel, tea
 		return m, sendEvent(GetAuthenticationModesRequested{})
 
 	case authModesReceived:
-		m.availableAuthModes = msg.authModes
-
-		var allAuthModes []list.Item
-		var firstAuthModeID string
-		for _, a := range m.availableAuthModes {
-			if firstAuthModeID == "" {
-				firstAuthModeID = a.Id
-			}
-			allAuthModes = append(allAuthModes, authModeItem{
-				id:    a.Id,
-				label: a.Label,
-			})
-		}
-
-		cmds := []tea.Cmd{m.SetItems(allAuthModes)}
+		cmds := []tea.Cmd{m.setAuthModes(msg.authModes)}
 		// Autoselect first auth mode if any.
-		if firstAuthModeID != "" {
-			cmds = append(cmds, selectAuthMode(firstAuthModeID))
+		if len(msg.authModes) > 0 {
+			cmds = append(cmds, selectAuthMode(msg.authModes[0].Id))
 		}
 
 		return m, tea.Sequence(cmds...)
@@ -142,15 +128,7 @@ func (m authModeSelectionModel) Update(msg tea.Msg) (authModeSelectionModel, tea
 			return m, nil
 		}
 		m.currentAuthModeSelectedID = msg.id
-
-		// Select correct line to ensure model is synchronised
-		for i, a := range m.Items() {
-			a := convertTo[authModeItem](a)
-			if a.id != msg.id {
-				continue
-			}
-			m.Select(i)
-		}
+		m.selectItem(msg.id)
 
 		return m, sendEvent(AuthModeSelected{
 			ID: msg.id,
@@ -192,6 +170,31 @@ func (m authModeSelectionModel) Update(msg tea.Msg) (authModeSelectionModel, tea
 	return m, cmd
 }
 
+// setAuthModes sets the list of available authentication modes.
+func (m *authModeSelectionModel) setAuthModes(authModes []*authd.GAMResponse_AuthenticationMode) tea.Cmd {
+	m.availableAuthModes = authModes
+
+	var allAuthModes []list.Item
+	for _, a := range m.availableAuthModes {
+		allAuthModes = append(allAuthModes, authModeItem{
+			id:    a.Id,
+			label: a.Label,
+		})
+	}
+	return m.SetItems(allAuthModes)
+}
+
+// selectItem selects the line of the authentication mode id, to ensure model is synchronised.
+func (m *authModeSelectionModel) selectItem(id string) {
+	for i, a := range m.Items() {
+		a := convertTo[authModeItem](a)
+		if a.id != id {
+			continue
+		}
+		m.Select(i)
+	}
+}
+
 // Focus focuses this model.
 func (m *authModeSelectionModel) Focus() tea.Cmd {
 	m.focused = true
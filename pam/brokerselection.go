@@ -91,14 +91,7 @@ func (m brokerSelectionModel) Update(msg tea.Msg) (brokerSelectionModel, tea.Cmd
 			log.Infof(context.TODO(), "broker %q is not part of current active brokers", msg.brokerID)
 			return m, nil
 		}
-		// Select correct line to ensure model is synchronised
-		for i, b := range m.Items() {
-			b := convertTo[brokerItem](b)
-			if b.id != broker.Id {
-				continue
-			}
-			m.Select(i)
-		}
+		m.selectItem(broker.Id)
 
 		return m, sendEvent(BrokerSelected{
 			BrokerID: broker.Id,
@@ -158,8 +151,21 @@ func (m *brokerSelectionModel) Blur() {
 	m.focused = false
 }
 
+// selectItem selects the line of brokerID, to ensure model is synchronised.
+func (m *brokerSelectionModel) selectItem(brokerID string) {
+	for i, b := range m.Items() {
+		b := convertTo[brokerItem](b)
+		if b.id != brokerID {
+			continue
+		}
+		m.Select(i)
+	}
+}
+
 // AutoSelectForUser requests if any previous broker was used by this user to automatically selects it.
-func AutoSelectForUser(client authd.PAMClient, username string) tea.Cmd {
+// When the supported UI layouts are already known, the session is started and the first authentication mode is
+// selected along with it.
+func AutoSelectForUser(client authd.PAMClient, username string, uiLayouts []*authd.UILayout) tea.Cmd {
 	return func() tea.Msg {
 		r, err := client.GetPreviousBroker(context.TODO(),
 			&authd.GPBRequest{
@@ -175,7 +181,11 @@ func AutoSelectForUser(client authd.PAMClient, username string) tea.Cmd {
 			return nil
 		}
 
-		return selectBroker(brokerID)()
+		// The local broker has no session to start.
+		if brokerID == "local" || uiLayouts == nil {
+			return selectBroker(brokerID)()
+		}
+		return beginAuthentication(client, brokerID, username, uiLayouts)()
 	}
 }
 
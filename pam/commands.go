@@ -27,20 +27,10 @@ func startBrokerSession(client authd.PAMClient, brokerID, username string) tea.C
 		}
 
 		// Start a transaction for this user with the broker.
-		// TODO: gdm case?
-		lang := "C"
-		for _, e := range []string{"LANG", "LC_MESSAGES", "LC_ALL"} {
-			l := os.Getenv(e)
-			if l != "" {
-				lang = l
-			}
-		}
-		lang = strings.TrimSuffix(lang, ".UTF-8")
-
 		sbReq := &authd.SBRequest{
 			BrokerId: brokerID,
 			Username: username,
-			Lang:     lang,
+			Lang:     sessionLang(),
 		}
 
 		sbResp, err := client.SelectBroker(context.TODO(), sbReq)
@@ -65,6 +55,59 @@ func startBrokerSession(client authd.PAMClient, brokerID, username string) tea.C
 	}
 }
 
+// beginAuthentication starts a session with brokerID and selects its first authentication mode in a single call.
+// If this fails, the broker is selected as usual, so that each step reports its own errors.
+func beginAuthentication(client authd.PAMClient, brokerID, username string, uiLayouts []*authd.UILayout) tea.Cmd {
+	return func() tea.Msg {
+		baReq := &authd.BARequest{
+			BrokerId:           &brokerID,
+			Username:           username,
+			Lang:               sessionLang(),
+			SupportedUiLayouts: uiLayouts,
+		}
+
+		baResp, err := client.BeginAuthentication(context.TODO(), baReq)
+		if err != nil {
+			log.Infof(context.TODO(), "Could not begin authentication with broker %q, selecting it: %v", brokerID, err)
+			return selectBroker(brokerID)()
+		}
+
+		if baResp.GetSessionId() == "" {
+			return pamError{status: pam.ErrSystem, msg: "no session ID returned by broker"}
+		}
+		if baResp.GetEncryptionKey() == "" {
+			return pamError{status: pam.ErrSystem, msg: "no encryption key returned by broker"}
+		}
+		if baResp.GetUiLayoutInfo() == nil {
+			return pamError{status: pam.ErrSystem, msg: "invalid empty UI Layout information from broker"}
+		}
+
+		return authenticationBegun{
+			SessionStarted: SessionStarted{
+				brokerID:      baResp.GetBrokerId(),
+				sessionID:     baResp.GetSessionId(),
+				encryptionKey: baResp.GetEncryptionKey(),
+			},
+			authModes:  baResp.GetAuthenticationModes(),
+			authModeID: baResp.GetAuthenticationModeId(),
+			layout:     baResp.GetUiLayoutInfo(),
+		}
+	}
+}
+
+// sessionLang returns the language to start the broker sessions with.
+func sessionLang() string {
+	// TODO: gdm case?
+	lang := "C"
+	for _, e := range []string{"LANG", "LC_MESSAGES", "LC_ALL"} {
+		l := os.Getenv(e)
+		if l != "" {
+			lang = l
+		}
+	}
+	return strings.TrimSuffix(lang, ".UTF-8")
+}
+
 // getLayout fetches the layout for a given authModeID.
 func getLayout(client authd.PAMClient, sessionID, authModeID string) tea.Cmd {
 	return func() tea.Msg {
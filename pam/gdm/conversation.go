@@ -3,26 +3,211 @@ package gdm
 import "C"
 
 import (
+	"bytes"
+	"encoding/json"
 	"errors"
+	"fmt"
+	"math"
+	"time"
 
 	"github.com/msteinert/pam/v2"
 )
 
-func sendToGdm(pamMTx pam.ModuleTransaction, data []byte) ([]byte, error) {
-	binReq, err := NewBinaryJSONProtoRequest(data)
+// sendToGdmWithReplyView sends the JSON data to GDM and calls the handler with
+// a view of the reply, that is only valid while the handler runs.
+func sendToGdmWithReplyView(pamMTx pam.ModuleTransaction, protoVersion uint,
+	data []byte, handler func(reply []byte) error) error {
+	binReq, err := newBinaryJSONProtoRequestVersion(protoVersion, data)
 	if err != nil {
-		return nil, err
+		return err
 	}
 	defer binReq.Release()
 	res, err := pamMTx.StartConv(binReq)
 	if err != nil {
-		return nil, err
+		return err
 	}
 
 	binRes, ok := res.(pam.BinaryConvResponse)
 	if !ok {
-		return nil, errors.New("returned value is not in binary form")
+		return errors.New("returned value is not in binary form")
 	}
 	defer binRes.Release()
-	return binRes.Decode(decodeJSONProtoMessage)
+
+	reply, err := binRes.Decode(func(ptr pam.BinaryPointer) ([]byte, error) {
+		return decodeJSONProtoMessageVersion(protoVersion, ptr)
+	})
+	if err != nil {
+		return err
+	}
+	return handler(reply)
+}
+
+func sendToGdm(pamMTx pam.ModuleTransaction, data []byte) ([]byte, error) {
+	var reply []byte
+	err := sendToGdmWithReplyView(pamMTx, JSONProtoVersion, data, func(replyView []byte) error {
+		reply = bytes.Clone(replyView)
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+	return reply, nil
+}
+
+// SendData sends the data to GDM and returns its parsed reply.
+// The reply is parsed straight from the GDM response memory, without copying.
+func SendData(pamMTx pam.ModuleTransaction, d *Data) (*Data, error) {
+	bytes, err := d.JSON()
+	if err != nil {
+		return nil, err
+	}
+
+	var gdmData *Data
+	err = sendToGdmWithReplyView(pamMTx, JSONProtoVersion, bytes, func(reply []byte) error {
+		gdmData, err = NewDataFromJSON(reply)
+		return err
+	})
+	if err != nil {
+		return nil, err
+	}
+	return gdmData, nil
+}
+
+// protoVersionDataKey is the module data key where the JSON protocol version
+// negotiated with GDM is stored.
+const protoVersionDataKey = "authd-gdm-proto-version"
+
+// NegotiateProtoVersion sends an hello advertising [ProtoVersion] to GDM and
+// returns the protocol version supported by both, that is the lowest between
+// ours and the one GDM replied with.
+// The negotiated version is saved in the module data, so that the requests
+// introduced by later versions of the protocol can be refused if GDM does not
+// support them.
+func NegotiateProtoVersion(pamMTx pam.ModuleTransaction) (uint32, error) {
+	gdmData, err := SendData(pamMTx, &Data{
+		Type:  DataType_hello,
+		Hello: &HelloData{Version: ProtoVersion},
+	})
+	if err != nil {
+		return 0, err
+	}
+	if gdmData.Type != DataType_hello {
+		return 0, fmt.Errorf("unexpected reply type %v", gdmData.Type)
+	}
+
+	version := min(ProtoVersion, gdmData.GetHello().GetVersion())
+	if version < 1 {
+		return 0, fmt.Errorf("%w: GDM version %d", ErrProtoNotSupported, version)
+	}
+	if err := pamMTx.SetData(protoVersionDataKey, version); err != nil {
+		return 0, err
+	}
+	return version, nil
+}
+
+// NegotiatedProtoVersion returns the JSON protocol version negotiated with GDM
+// using [NegotiateProtoVersion], or the first version if none was negotiated.
+func NegotiatedProtoVersion(pamMTx pam.ModuleTransaction) uint32 {
+	data, err := pamMTx.GetData(protoVersionDataKey)
+	if err != nil {
+		return 1
+	}
+	version, ok := data.(uint32)
+	if !ok {
+		return 1
+	}
+	return version
+}
+
+// checkNegotiatedProtoVersion returns [ErrProtoNotSupported] if the protocol
+// version negotiated with GDM is lower than the version required by a feature.
+func checkNegotiatedProtoVersion(pamMTx pam.ModuleTransaction, feature string, required uint32) error {
+	if version := NegotiatedProtoVersion(pamMTx); version < required {
+		return fmt.Errorf("%w: %s requires version %d, negotiated version is %d",
+			ErrProtoNotSupported, feature, required, version)
+	}
+	return nil
+}
+
+// SendDataBatch sends all the data values to GDM in a single conversation, and
+// returns the parsed replies, one per each sent value.
+// GDM supports this only since the protocol version [BatchProtoVersion], if a
+// lower version was negotiated, [ErrProtoNotSupported] is returned and the
+// values should be sent one by one using [SendData].
+func SendDataBatch(pamMTx pam.ModuleTransaction, data []*Data) ([]*Data, error) {
+	if err := checkNegotiatedProtoVersion(pamMTx, "batch", BatchProtoVersion); err != nil {
+		return nil, err
+	}
+	if len(data) == 0 {
+		return nil, errors.New("no data to send")
+	}
+
+	var batch bytes.Buffer
+	batch.WriteByte('[')
+	for i, d := range data {
+		bytes, err := d.JSON()
+		if err != nil {
+			return nil, fmt.Errorf("batch data %d invalid: %w", i, err)
+		}
+		if i > 0 {
+			batch.WriteByte(',')
+		}
+		batch.Write(bytes)
+	}
+	batch.WriteByte(']')
+
+	var gdmData []*Data
+	err := sendToGdmWithReplyView(pamMTx, JSONProtoBatchVersion, batch.Bytes(), func(reply []byte) error {
+		var replies []json.RawMessage
+		if err := json.Unmarshal(reply, &replies); err != nil {
+			return fmt.Errorf("%w: %w", ErrInvalidJSON, err)
+		}
+		if len(replies) != len(data) {
+			return fmt.Errorf("unexpected number of replies: got %d, expected %d",
+				len(replies), len(data))
+		}
+
+		gdmData = make([]*Data, 0, len(replies))
+		for i, r := range replies {
+			d, err := NewDataFromJSON(r)
+			if err != nil {
+				return fmt.Errorf("batch reply %d invalid: %w", i, err)
+			}
+			gdmData = append(gdmData, d)
+		}
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+	return gdmData, nil
+}
+
+// WaitForEvents asks GDM to send its events, but unlike a poll request, GDM
+// holds the conversation until there are events to send or the timeout is
+// reached, in which case no events are returned.
+// GDM supports this only since the protocol version [WaitForEventsProtoVersion],
+// if a lower version was negotiated, [ErrProtoNotSupported] is returned and GDM
+// should be polled instead.
+func WaitForEvents(pamMTx pam.ModuleTransaction, timeout time.Duration) ([]*EventData, error) {
+	if err := checkNegotiatedProtoVersion(pamMTx, DataType_waitForEvents.String(), WaitForEventsProtoVersion); err != nil {
+		return nil, err
+	}
+	if timeout < time.Millisecond {
+		return nil, fmt.Errorf("invalid timeout %v", timeout)
+	}
+
+	timeoutMs := uint32(min(timeout.Milliseconds(), math.MaxUint32))
+	gdmData, err := SendData(pamMTx, &Data{
+		Type:          DataType_waitForEvents,
+		WaitForEvents: &WaitForEventsData{TimeoutMs: timeoutMs},
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	if gdmData.Type != DataType_pollResponse {
+		return nil, fmt.Errorf("unexpected reply type %v", gdmData.Type)
+	}
+	return gdmData.PollResponse, nil
 }
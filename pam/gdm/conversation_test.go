@@ -1,7 +1,9 @@
 package gdm
 
 import (
+	"fmt"
 	"testing"
+	"time"
 
 	"github.com/msteinert/pam/v2"
 	"github.com/stretchr/testify/require"
@@ -99,3 +101,363 @@ func TestSendToGdm(t *testing.T) {
 		})
 	}
 }
+
+func TestSendData(t *testing.T) {
+	t.Parallel()
+	t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+	testCases := map[string]struct {
+		data  *Data
+		reply []byte
+
+		wantData  *Data
+		wantError bool
+	}{
+		"Poll is sent and a poll response is received": {
+			data:  &Data{Type: DataType_poll},
+			reply: []byte(`{"type":"pollResponse"}`),
+
+			wantData: &Data{Type: DataType_pollResponse},
+		},
+		"Hello is sent and received": {
+			data:  &Data{Type: DataType_hello, Hello: &HelloData{Version: ProtoVersion}},
+			reply: []byte(fmt.Sprintf(`{"type":"hello","hello":{"version":%d}}`, ProtoVersion)),
+
+			wantData: &Data{Type: DataType_hello, Hello: &HelloData{Version: ProtoVersion}},
+		},
+		"Hello with version 2 is sent and received": {
+			data:  &Data{Type: DataType_hello, Hello: &HelloData{Version: 2}},
+			reply: []byte(`{"type":"hello","hello":{"version":2}}`),
+
+			wantData: &Data{Type: DataType_hello, Hello: &HelloData{Version: 2}},
+		},
+
+		// Error cases
+		"Error on invalid data": {
+			data:      &Data{},
+			wantError: true,
+		},
+		"Error on invalid reply data": {
+			data:      &Data{Type: DataType_poll},
+			reply:     []byte(`{"type":"event"}`),
+			wantError: true,
+		},
+		"Error on invalid JSON reply": {
+			data:      &Data{Type: DataType_poll},
+			reply:     []byte(`"not a data object"`),
+			wantError: true,
+		},
+	}
+	for name, tc := range testCases {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+			t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+			mt := pam_test.NewModuleTransactionDummy(pam.BinaryPointerConversationFunc(
+				func(ptr pam.BinaryPointer) (pam.BinaryPointer, error) {
+					msg, err := newJSONProtoMessage(tc.reply)
+					return pam.BinaryPointer(msg), err
+				}))
+
+			data, err := SendData(mt, tc.data)
+			if tc.wantError {
+				require.Error(t, err)
+				require.Nil(t, data)
+				return
+			}
+			require.NoError(t, err)
+			require.Equal(t, tc.wantData.String(), data.String())
+		})
+	}
+}
+
+func TestSendDataBatch(t *testing.T) {
+	t.Parallel()
+	t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+	pollResponse := &Data{
+		Type: DataType_pollResponse,
+		PollResponse: []*EventData{
+			{
+				Type: EventType_brokerSelected,
+				Data: &EventData_BrokerSelected{
+					BrokerSelected: &Events_BrokerSelected{BrokerId: "a broker"},
+				},
+			},
+		},
+	}
+	pollResponseJSON, err := pollResponse.JSON()
+	require.NoError(t, err)
+
+	testCases := map[string]struct {
+		data         []*Data
+		reply        []byte
+		replyVersion uint
+		protoVersion uint32
+
+		wantRequest []byte
+		wantData    []*Data
+		wantErr     bool
+		wantErrIs   error
+	}{
+		"Single value is sent and received": {
+			data:  []*Data{{Type: DataType_poll}},
+			reply: []byte(`[{"type":"pollResponse"}]`),
+
+			wantRequest: []byte(`[{"type":"poll"}]`),
+			wantData:    []*Data{{Type: DataType_pollResponse}},
+		},
+		"Multiple values are sent and received": {
+			data: []*Data{
+				{Type: DataType_eventAck},
+				{Type: DataType_poll},
+			},
+			reply: []byte(`[{"type":"eventAck"},` + string(pollResponseJSON) + `]`),
+
+			wantRequest: []byte(`[{"type":"eventAck"},{"type":"poll"}]`),
+			wantData:    []*Data{{Type: DataType_eventAck}, pollResponse},
+		},
+
+		// Error cases
+		"Error on no data": {
+			wantErr: true,
+		},
+		"Error on invalid data": {
+			data:    []*Data{{Type: DataType_poll}, {}},
+			wantErr: true,
+		},
+		"Error if GDM negotiated a version not supporting batching": {
+			data:         []*Data{{Type: DataType_poll}},
+			protoVersion: 1,
+			wantErr:      true,
+			wantErrIs:    ErrProtoNotSupported,
+		},
+		"Error if GDM does not reply with a batch": {
+			data:         []*Data{{Type: DataType_poll}},
+			reply:        []byte(`{"type":"pollResponse"}`),
+			replyVersion: JSONProtoVersion,
+			wantErr:      true,
+			wantErrIs:    ErrProtoNotSupported,
+		},
+		"Error on non-array reply": {
+			data:      []*Data{{Type: DataType_poll}},
+			reply:     []byte(`{"type":"pollResponse"}`),
+			wantErr:   true,
+			wantErrIs: ErrInvalidJSON,
+		},
+		"Error on unexpected number of replies": {
+			data:    []*Data{{Type: DataType_poll}, {Type: DataType_poll}},
+			reply:   []byte(`[{"type":"pollResponse"}]`),
+			wantErr: true,
+		},
+		"Error on invalid reply value": {
+			data:    []*Data{{Type: DataType_poll}},
+			reply:   []byte(`[{"type":"event"}]`),
+			wantErr: true,
+		},
+	}
+	for name, tc := range testCases {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+			t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+			if tc.replyVersion == 0 {
+				tc.replyVersion = JSONProtoBatchVersion
+			}
+			if tc.protoVersion == 0 {
+				tc.protoVersion = BatchProtoVersion
+			}
+
+			mt := pam_test.NewModuleTransactionDummy(pam.BinaryPointerConversationFunc(
+				func(ptr pam.BinaryPointer) (pam.BinaryPointer, error) {
+					req, err := decodeJSONProtoMessageVersion(JSONProtoBatchVersion, ptr)
+					require.NoError(t, err)
+					if tc.wantRequest != nil {
+						require.JSONEq(t, string(tc.wantRequest), string(req))
+					}
+					msg, err := newJSONProtoMessageVersion(tc.replyVersion, tc.reply)
+					return pam.BinaryPointer(msg), err
+				}))
+
+			require.NoError(t, mt.SetData(protoVersionDataKey, tc.protoVersion))
+
+			data, err := SendDataBatch(mt, tc.data)
+			if tc.wantErr {
+				require.Error(t, err)
+				if tc.wantErrIs != nil {
+					require.ErrorIs(t, err, tc.wantErrIs)
+				}
+				require.Nil(t, data)
+				return
+			}
+			require.NoError(t, err)
+			require.Len(t, data, len(tc.wantData))
+			for i, d := range data {
+				require.Equal(t, tc.wantData[i].String(), d.String())
+			}
+		})
+	}
+}
+
+func TestNegotiateProtoVersion(t *testing.T) {
+	t.Parallel()
+	t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+	testCases := map[string]struct {
+		reply []byte
+
+		wantVersion uint32
+		wantErr     bool
+		wantErrIs   error
+	}{
+		"Version 1 is negotiated with GDM supporting version 1": {
+			reply:       []byte(`{"type":"hello","hello":{"version":1}}`),
+			wantVersion: 1,
+		},
+		"Version 2 is negotiated with GDM supporting version 2": {
+			reply:       []byte(`{"type":"hello","hello":{"version":2}}`),
+			wantVersion: 2,
+		},
+		"Our version is negotiated with GDM supporting a later version": {
+			reply:       []byte(`{"type":"hello","hello":{"version":55}}`),
+			wantVersion: ProtoVersion,
+		},
+
+		// Error cases
+		"Error on unexpected reply type": {
+			reply:   []byte(`{"type":"pollResponse"}`),
+			wantErr: true,
+		},
+		"Error on GDM version 0": {
+			reply:     []byte(`{"type":"hello","hello":{}}`),
+			wantErr:   true,
+			wantErrIs: ErrProtoNotSupported,
+		},
+	}
+	for name, tc := range testCases {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+			t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+			mt := pam_test.NewModuleTransactionDummy(pam.BinaryPointerConversationFunc(
+				func(ptr pam.BinaryPointer) (pam.BinaryPointer, error) {
+					req, err := decodeJSONProtoMessage(ptr)
+					require.NoError(t, err)
+					gdmData, err := NewDataFromJSON(req)
+					require.NoError(t, err)
+					require.Equal(t, DataType_hello, gdmData.Type)
+					require.Equal(t, ProtoVersion, gdmData.Hello.Version)
+
+					msg, err := newJSONProtoMessage(tc.reply)
+					return pam.BinaryPointer(msg), err
+				}))
+
+			require.Equal(t, uint32(1), NegotiatedProtoVersion(mt),
+				"Version should be the first one before negotiation")
+
+			version, err := NegotiateProtoVersion(mt)
+			if tc.wantErr {
+				require.Error(t, err)
+				if tc.wantErrIs != nil {
+					require.ErrorIs(t, err, tc.wantErrIs)
+				}
+				require.Equal(t, uint32(1), NegotiatedProtoVersion(mt),
+					"Version should not change on failed negotiation")
+				return
+			}
+			require.NoError(t, err)
+			require.Equal(t, tc.wantVersion, version)
+			require.Equal(t, tc.wantVersion, NegotiatedProtoVersion(mt))
+		})
+	}
+}
+
+func TestWaitForEvents(t *testing.T) {
+	t.Parallel()
+	t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+	testCases := map[string]struct {
+		timeout      time.Duration
+		reply        []byte
+		protoVersion uint32
+
+		wantTimeoutMs uint32
+		wantEvents    int
+		wantErr       bool
+		wantErrIs     error
+	}{
+		"Events are returned": {
+			timeout: 2 * time.Second,
+			reply: []byte(`{"type":"pollResponse","pollResponse":` +
+				`[{"type":"brokerSelected","brokerSelected":{"brokerId":"a broker"}},` +
+				`{"type":"authModeSelected","authModeSelected":{"authModeId":"auth mode"}}]}`),
+
+			wantTimeoutMs: 2000,
+			wantEvents:    2,
+		},
+		"No events are returned on timeout": {
+			timeout: time.Millisecond,
+			reply:   []byte(`{"type":"pollResponse"}`),
+
+			wantTimeoutMs: 1,
+		},
+
+		// Error cases
+		"Error on invalid timeout": {
+			timeout: time.Microsecond,
+			wantErr: true,
+		},
+		"Error on unexpected reply type": {
+			timeout: time.Second,
+			reply:   []byte(`{"type":"eventAck"}`),
+			wantErr: true,
+		},
+		"Error if GDM negotiated a version not supporting it": {
+			timeout:      time.Second,
+			protoVersion: 1,
+			wantErr:      true,
+			wantErrIs:    ErrProtoNotSupported,
+		},
+	}
+	for name, tc := range testCases {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+			t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+			if tc.protoVersion == 0 {
+				tc.protoVersion = WaitForEventsProtoVersion
+			}
+
+			mt := pam_test.NewModuleTransactionDummy(pam.BinaryPointerConversationFunc(
+				func(ptr pam.BinaryPointer) (pam.BinaryPointer, error) {
+					req, err := decodeJSONProtoMessage(ptr)
+					require.NoError(t, err)
+					gdmData, err := NewDataFromJSON(req)
+					require.NoError(t, err)
+					require.Equal(t, DataType_waitForEvents, gdmData.Type)
+					require.Equal(t, tc.wantTimeoutMs, gdmData.WaitForEvents.TimeoutMs)
+
+					msg, err := newJSONProtoMessage(tc.reply)
+					return pam.BinaryPointer(msg), err
+				}))
+
+			require.NoError(t, mt.SetData(protoVersionDataKey, tc.protoVersion))
+
+			events, err := WaitForEvents(mt, tc.timeout)
+			if tc.wantErr {
+				require.Error(t, err)
+				if tc.wantErrIs != nil {
+					require.ErrorIs(t, err, tc.wantErrIs)
+				}
+				require.Nil(t, events)
+				return
+			}
+			require.NoError(t, err)
+			require.Len(t, events, tc.wantEvents)
+		})
+	}
+}
@@ -25,6 +25,11 @@ const (
 	JSONProtoName = "com.ubuntu.authd.gdm"
 	// JSONProtoVersion is the gdm private string protocol version.
 	JSONProtoVersion = uint(1)
+	// JSONProtoBatchVersion is the gdm private string protocol version where
+	// each message contains a JSON array of values, so that multiple values
+	// can be exchanged in a single conversation. It's only used once the
+	// negotiated JSON protocol version is at least [BatchProtoVersion].
+	JSONProtoBatchVersion = uint(BatchProtoVersion)
 
 	jsonProtoMessageSize = C.GDM_PAM_EXTENSION_CUSTOM_JSON_SIZE
 )
@@ -55,6 +60,13 @@ func IsPamExtensionSupported(extension string) bool {
 	return bool(C.is_gdm_pam_extension_supported(cExtension))
 }
 
+// InvalidatePamExtensionsCache drops the cached list of the extensions that GDM
+// supports, so that it's parsed again on next usage. This is only needed if the
+// environment has been changed without using [AdvertisePamExtensions].
+func InvalidatePamExtensionsCache() {
+	C.gdm_extensions_invalidate_cache()
+}
+
 // AdvertisePamExtensions enable GDM pam extensions in the current binary.
 func AdvertisePamExtensions(extensions []string) {
 	if len(extensions) == 0 {
@@ -72,37 +84,58 @@ func AdvertisePamExtensions(extensions []string) {
 
 type jsonProtoMessage = C.GdmPamExtensionJSONProtocol
 
+// cJSONProtoName is the C version of JSONProtoName, allocated once since it's
+// used by every message we send.
+var cJSONProtoName = C.CString(JSONProtoName)
+
 func allocateJSONProtoMessage() *jsonProtoMessage {
 	// We do manual memory management here, instead of returning a go-allocated
 	// structure, so that we can just use a single finalizer function for both
 	// request and response messages.
-	var msg *jsonProtoMessage
-	msg = (*jsonProtoMessage)(C.malloc(C.size_t(unsafe.Sizeof(*msg))))
-	return msg
+	// Messages are taken from a C-side pool, so that both the structure and its
+	// JSON buffer can be reused across the many messages exchanged with GDM.
+	return (*jsonProtoMessage)(C.gdm_custom_json_message_new())
 }
 
 func newJSONProtoMessage(jsonValue []byte) (*jsonProtoMessage, error) {
+	return newJSONProtoMessageVersion(JSONProtoVersion, jsonValue)
+}
+
+func newJSONProtoMessageVersion(protoVersion uint, jsonValue []byte) (*jsonProtoMessage, error) {
 	if err := validateJSONFunc(jsonValue); err != nil {
 		return nil, err
 	}
 	msg := allocateJSONProtoMessage()
-	msg.init(JSONProtoName, JSONProtoVersion, jsonValue)
+	if msg == nil {
+		return nil, pam.ErrBuf
+	}
+	if err := msg.init(JSONProtoName, protoVersion, jsonValue); err != nil {
+		msg.release()
+		return nil, err
+	}
 	return msg, nil
 }
 
-func (msg *jsonProtoMessage) init(protoName string, protoVersion uint, jsonValue []byte) {
-	cProto := C.CString(protoName)
-	defer C.free(unsafe.Pointer(cProto))
+func (msg *jsonProtoMessage) init(protoName string, protoVersion uint, jsonValue []byte) error {
+	cProto := cJSONProtoName
+	if protoName != JSONProtoName {
+		cProto = C.CString(protoName)
+		defer C.free(unsafe.Pointer(cProto))
+	}
 	cJSON := (*C.char)(nil)
 	if jsonValue != nil {
-		// We don't use string() here to avoid an extra copy, so we need to
-		// add ourself the final null byte to the string.
-		// Also the newly allocated C bytes are stolen, since they will be
-		// owned by the jsonProtoMessage now. So it's up to it to release
-		// them via finalizer functions.
-		cJSON = (*C.char)(C.CBytes(append(jsonValue, 0)))
+		// We don't use string() here to avoid an extra copy, the JSON is only
+		// copied once into the message buffer, which is also where the final
+		// null byte is added.
+		// SliceData returns a non-nil pointer for empty non-nil slices, so that
+		// they still lead to an empty string.
+		cJSON = (*C.char)(unsafe.Pointer(unsafe.SliceData(jsonValue)))
 	}
-	C.gdm_custom_json_request_init(msg, cProto, C.uint(protoVersion), cJSON)
+	if !C.gdm_custom_json_message_init(msg, cProto, C.uint(protoVersion), cJSON,
+		C.size_t(len(jsonValue))) {
+		return pam.ErrBuf
+	}
+	return nil
 }
 
 func (msg *jsonProtoMessage) release() {
@@ -110,8 +143,7 @@ func (msg *jsonProtoMessage) release() {
 		return
 	}
 
-	C.free(unsafe.Pointer(msg.json))
-	C.free(unsafe.Pointer(msg))
+	C.gdm_custom_json_message_free(msg)
 }
 
 func (msg *jsonProtoMessage) protoName() string {
@@ -122,13 +154,15 @@ func (msg *jsonProtoMessage) protoVersion() uint {
 	return uint(msg.version)
 }
 
+// JSON returns a view of the message JSON value, this is not a copy and so it's
+// only valid until the message is released.
 func (msg *jsonProtoMessage) JSON() ([]byte, error) {
 	if msg.json == nil {
 		return nil, ErrInvalidJSON
 	}
 
 	jsonLen := C.strlen(msg.json)
-	jsonValue := C.GoBytes(unsafe.Pointer(msg.json), C.int(jsonLen))
+	jsonValue := unsafe.Slice((*byte)(unsafe.Pointer(msg.json)), jsonLen)
 
 	if err := validateJSONFunc(jsonValue); err != nil {
 		return nil, err
@@ -143,23 +177,35 @@ func (msg *jsonProtoMessage) encode() pam.BinaryPointer {
 // NewBinaryJSONProtoRequest returns a new pam.BinaryConvRequest from the
 // provided data.
 func NewBinaryJSONProtoRequest(data []byte) (*pam.BinaryConvRequest, error) {
-	request, err := newJSONProtoMessage(data)
+	return newBinaryJSONProtoRequestVersion(JSONProtoVersion, data)
+}
+
+func newBinaryJSONProtoRequestVersion(protoVersion uint, data []byte) (*pam.BinaryConvRequest, error) {
+	request, err := newJSONProtoMessageVersion(protoVersion, data)
 	if err != nil {
 		return nil, err
 	}
-	log.Debugf(context.TODO(), "Sending to gdm %s", string(data))
+	log.Debugf(context.TODO(), "Sending to gdm (v%d) %s", protoVersion, string(data))
 	return pam.NewBinaryConvRequest(request.encode(),
 		func(ptr pam.BinaryPointer) { (*jsonProtoMessage)(ptr).release() }), nil
 }
 
 // decodeJSONProtoMessage decodes a binary pointer into its JSON representation.
+// The returned value is a view of the message memory, so it must be copied if
+// it's needed after that the message has been released.
 func decodeJSONProtoMessage(response pam.BinaryPointer) ([]byte, error) {
+	return decodeJSONProtoMessageVersion(JSONProtoVersion, response)
+}
+
+// decodeJSONProtoMessageVersion is like decodeJSONProtoMessage, but for a
+// message that is expected to use the provided protocol version.
+func decodeJSONProtoMessageVersion(protoVersion uint, response pam.BinaryPointer) ([]byte, error) {
 	reply := (*jsonProtoMessage)(response)
 
 	if reply.protoName() != JSONProtoName ||
-		reply.protoVersion() != JSONProtoVersion {
+		reply.protoVersion() != protoVersion {
 		return nil, fmt.Errorf("%w: got %s v%d, expected %s v%d", ErrProtoNotSupported,
-			reply.protoName(), reply.protoVersion(), JSONProtoName, JSONProtoVersion)
+			reply.protoName(), reply.protoVersion(), JSONProtoName, protoVersion)
 	}
 
 	return reply.JSON()
@@ -1,3 +1,6 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -7,12 +10,200 @@
 static char pam_extension_environment_block[_POSIX_ARG_MAX];
 static char **supported_extensions = NULL;
 
+/* The index of the extensions table is an open addressing hash table of the
+ * extension names, twice as large as the maximum number of extensions so that
+ * a lookup only needs to probe a few slots. Each slot holds the extension type
+ * plus one, zero being an empty slot. */
+#define GDM_EXTENSIONS_INDEX_SIZE (2 * (UCHAR_MAX + 1))
+
+/* The parsed contents of GDM_SUPPORTED_PAM_EXTENSIONS, where each extension
+ * name is at the index of its type, and the index to find the type of a name.
+ * It's built on first use, and must be invalidated whenever the environment
+ * variable changes, so that we don't need to look up and parse the environment
+ * for each message. */
+typedef struct
+{
+  bool     loaded;
+  char    *buffer;
+  char    *names[UCHAR_MAX + 1];
+  size_t   n_names;
+  uint16_t index[GDM_EXTENSIONS_INDEX_SIZE];
+  int      custom_json_type;
+} GdmExtensionsTable;
+
+static pthread_mutex_t gdm_extensions_table_lock = PTHREAD_MUTEX_INITIALIZER;
+static GdmExtensionsTable gdm_extensions_table = { .custom_json_type = -1 };
+
+static inline size_t
+gdm_extensions_name_hash (const char *name)
+{
+  /* FNV-1a */
+  uint32_t hash = 2166136261u;
+
+  for (const unsigned char *p = (const unsigned char *) name; *p; ++p)
+    hash = (hash ^ *p) * 16777619u;
+
+  return hash % GDM_EXTENSIONS_INDEX_SIZE;
+}
+
+/* Returns the index slot of the extension name, or the empty slot where it
+ * should be added. */
+static inline uint16_t *
+gdm_extensions_table_index_slot (GdmExtensionsTable *table,
+                                 const char         *name)
+{
+  size_t slot = gdm_extensions_name_hash (name);
+
+  while (table->index[slot] != 0 &&
+         strcmp (table->names[table->index[slot] - 1], name) != 0)
+    slot = (slot + 1) % GDM_EXTENSIONS_INDEX_SIZE;
+
+  return &table->index[slot];
+}
+
+static inline void
+gdm_extensions_table_load_locked (void)
+{
+  GdmExtensionsTable *table = &gdm_extensions_table;
+  const char *env_value;
+  char *saveptr = NULL;
+
+  if (table->loaded)
+    return;
+
+  table->loaded = true;
+  env_value = getenv ("GDM_SUPPORTED_PAM_EXTENSIONS");
+  if (!env_value)
+    return;
+
+  table->buffer = strdup (env_value);
+  if (!table->buffer)
+    {
+      /* Let's try again on next usage. */
+      table->loaded = false;
+      return;
+    }
+
+  for (char *name = strtok_r (table->buffer, " ", &saveptr);
+       name && table->n_names <= UCHAR_MAX;
+       name = strtok_r (NULL, " ", &saveptr))
+    {
+      uint16_t *slot = gdm_extensions_table_index_slot (table, name);
+
+      table->names[table->n_names++] = name;
+
+      /* As for GDM, a duplicated name has the type of its first occurrence. */
+      if (*slot == 0)
+        *slot = table->n_names;
+    }
+
+  if (table->n_names > 0)
+    {
+      uint16_t slot = *gdm_extensions_table_index_slot (table, GDM_PAM_EXTENSION_CUSTOM_JSON);
+      table->custom_json_type = (int) slot - 1;
+    }
+}
+
+/* Drops the cached extensions table, it will be parsed again on next use. */
+static inline void
+gdm_extensions_invalidate_cache (void)
+{
+  pthread_mutex_lock (&gdm_extensions_table_lock);
+  free (gdm_extensions_table.buffer);
+  gdm_extensions_table = (GdmExtensionsTable) { .custom_json_type = -1 };
+  pthread_mutex_unlock (&gdm_extensions_table_lock);
+}
+
+static inline bool
+gdm_extensions_look_up_type (const char    *extension,
+                             unsigned char *extension_type)
+{
+  uint16_t slot;
+
+  pthread_mutex_lock (&gdm_extensions_table_lock);
+  gdm_extensions_table_load_locked ();
+  slot = *gdm_extensions_table_index_slot (&gdm_extensions_table, extension);
+  pthread_mutex_unlock (&gdm_extensions_table_lock);
+
+  if (slot == 0)
+    return false;
+
+  if (extension_type)
+    *extension_type = slot - 1;
+  return true;
+}
+
+/* Returns whether the extension type is one of the supported extensions. */
+static inline bool
+gdm_extensions_is_valid_type (unsigned char extension_type)
+{
+  bool valid;
+
+  pthread_mutex_lock (&gdm_extensions_table_lock);
+  gdm_extensions_table_load_locked ();
+  valid = extension_type < gdm_extensions_table.n_names;
+  pthread_mutex_unlock (&gdm_extensions_table_lock);
+
+  return valid;
+}
+
+/* Returns whether the extension type is the one of the extension name. */
+static inline bool
+gdm_extensions_type_matches (unsigned char extension_type,
+                             const char   *extension)
+{
+  bool matches;
+
+  pthread_mutex_lock (&gdm_extensions_table_lock);
+  gdm_extensions_table_load_locked ();
+  matches = extension_type < gdm_extensions_table.n_names &&
+            strcmp (gdm_extensions_table.names[extension_type], extension) == 0;
+  pthread_mutex_unlock (&gdm_extensions_table_lock);
+
+  return matches;
+}
+
+/* Same as gdm_extensions_look_up_type (GDM_PAM_EXTENSION_CUSTOM_JSON), but
+ * without any lookup, as it's the extension type we use for every message. */
+static inline bool
+gdm_extensions_get_custom_json_type (unsigned char *extension_type)
+{
+  int custom_json_type;
+
+  pthread_mutex_lock (&gdm_extensions_table_lock);
+  gdm_extensions_table_load_locked ();
+  custom_json_type = gdm_extensions_table.custom_json_type;
+  pthread_mutex_unlock (&gdm_extensions_table_lock);
+
+  if (custom_json_type < 0)
+    return false;
+
+  *extension_type = custom_json_type;
+  return true;
+}
+
 static inline bool
 is_gdm_pam_extension_supported (const char *extension)
 {
-  return GDM_PAM_EXTENSION_SUPPORTED (extension);
+  return gdm_extensions_look_up_type (extension, NULL);
 }
 
+/* The GDM extension headers are a copy of the upstream ones, whose type lookup
+ * and validation macros parse the environment each time. Override them to use
+ * the cached table instead, so that the other upstream macros using them, as
+ * GDM_PAM_EXTENSION_CUSTOM_JSON_REQUEST_INIT, do too. */
+#undef GDM_PAM_EXTENSION_LOOK_UP_TYPE
+#define GDM_PAM_EXTENSION_LOOK_UP_TYPE(name, extension_type) \
+  gdm_extensions_look_up_type ((name), (extension_type))
+
+#undef GDM_PAM_EXTENSION_MESSAGE_INVALID_TYPE
+#define GDM_PAM_EXTENSION_MESSAGE_INVALID_TYPE(msg) \
+  (!gdm_extensions_is_valid_type ((msg)->type))
+
+#undef GDM_PAM_EXTENSION_MESSAGE_MATCH
+#define GDM_PAM_EXTENSION_MESSAGE_MATCH(msg, supported_extensions, name) \
+  gdm_extensions_type_matches ((msg)->type, (name))
+
 static inline void
 gdm_extensions_advertise_supported (const char *extensions[],
                                     size_t      n_extensions)
@@ -33,14 +224,209 @@ gdm_extensions_advertise_supported (const char *extensions[],
 
   GDM_PAM_EXTENSION_ADVERTISE_SUPPORTED_EXTENSIONS (
     pam_extension_environment_block, supported_extensions);
+
+  gdm_extensions_invalidate_cache ();
 }
 
+/* This is GDM_PAM_EXTENSION_CUSTOM_JSON_REQUEST_INIT, but using the cached
+ * extensions table to look up the message type. */
 static inline void
 gdm_custom_json_request_init (GdmPamExtensionJSONProtocol *request,
                                const char                  *proto_name,
                                unsigned int                 proto_version,
                                const char                  *json)
 {
-  GDM_PAM_EXTENSION_CUSTOM_JSON_REQUEST_INIT (request, proto_name,
-                                               proto_version, json);
+  size_t proto_len = strnlen (proto_name, sizeof (request->protocol_name) - 1);
+
+  gdm_extensions_get_custom_json_type (&request->header.type);
+  request->header.length = htobe32 (GDM_PAM_EXTENSION_CUSTOM_JSON_SIZE);
+  memcpy ((char *) request->protocol_name, proto_name, proto_len);
+  ((char *) request->protocol_name)[proto_len] = '\0';
+  request->version = proto_version;
+  request->json = (char *) json;
+}
+
+/* The JSON protocol messages we send are kept in a small pool, so that both
+ * the messages and their JSON buffers can be reused by the next requests
+ * instead of being allocated for each message exchanged with GDM.
+ * The pool lives in C memory so that it's always visible by leak checkers. */
+#define JSON_PROTO_MESSAGE_POOL_SIZE 8
+
+/* Messages whose JSON buffer grew more than this are not kept in the pool. */
+#define JSON_PROTO_MESSAGE_POOL_MAX_JSON_SIZE (64 * 1024)
+
+typedef struct
+{
+  GdmPamExtensionJSONProtocol *message;
+  char                        *json_buffer;
+  size_t                       json_size;
+  bool                         in_use;
+} JSONProtoPoolEntry;
+
+static pthread_mutex_t json_proto_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static JSONProtoPoolEntry json_proto_pool[JSON_PROTO_MESSAGE_POOL_SIZE];
+
+static inline JSONProtoPoolEntry *
+json_proto_pool_lookup (GdmPamExtensionJSONProtocol *message)
+{
+  for (size_t i = 0; i < JSON_PROTO_MESSAGE_POOL_SIZE; ++i)
+    {
+      if (json_proto_pool[i].message == message)
+        return &json_proto_pool[i];
+    }
+
+  return NULL;
+}
+
+static inline GdmPamExtensionJSONProtocol *
+gdm_custom_json_message_new (void)
+{
+  GdmPamExtensionJSONProtocol *message;
+  JSONProtoPoolEntry *empty_entry = NULL;
+
+  pthread_mutex_lock (&json_proto_pool_lock);
+
+  for (size_t i = 0; i < JSON_PROTO_MESSAGE_POOL_SIZE; ++i)
+    {
+      JSONProtoPoolEntry *entry = &json_proto_pool[i];
+
+      if (!entry->message)
+        {
+          if (!empty_entry)
+            empty_entry = entry;
+          continue;
+        }
+
+      if (!entry->in_use)
+        {
+          entry->in_use = true;
+          pthread_mutex_unlock (&json_proto_pool_lock);
+          return entry->message;
+        }
+    }
+
+  message = calloc (1, sizeof (GdmPamExtensionJSONProtocol));
+
+  /* If the pool is full, the message is just not tracked and it will be
+   * released as any other message we've not allocated. */
+  if (message && empty_entry)
+    *empty_entry = (JSONProtoPoolEntry) { .message = message, .in_use = true };
+
+  pthread_mutex_unlock (&json_proto_pool_lock);
+
+  return message;
+}
+
+static inline bool
+json_proto_pool_entry_reserve (JSONProtoPoolEntry *entry,
+                               size_t              size)
+{
+  size_t json_size;
+
+  if (entry->json_size >= size)
+    return true;
+
+  for (json_size = entry->json_size ? entry->json_size : 256; json_size < size;)
+    json_size *= 2;
+
+  /* Not using realloc, since the buffer is going to be overwritten anyways
+   * and its previous contents have already been cleared on release. */
+  free (entry->json_buffer);
+  entry->json_buffer = malloc (json_size);
+  entry->json_size = entry->json_buffer ? json_size : 0;
+
+  return entry->json_buffer != NULL;
+}
+
+/* Initializes a message, copying the JSON value in the message buffer.
+ * The json value does not need to be NUL terminated, and if it's NULL the
+ * message JSON will be NULL too. */
+static inline bool
+gdm_custom_json_message_init (GdmPamExtensionJSONProtocol *message,
+                              const char                  *proto_name,
+                              unsigned int                 proto_version,
+                              const char                  *json,
+                              size_t                       json_len)
+{
+  JSONProtoPoolEntry *entry;
+  char *json_buffer = NULL;
+
+  pthread_mutex_lock (&json_proto_pool_lock);
+  entry = json_proto_pool_lookup (message);
+
+  if (json && entry)
+    {
+      if (!json_proto_pool_entry_reserve (entry, json_len + 1))
+        {
+          pthread_mutex_unlock (&json_proto_pool_lock);
+          return false;
+        }
+
+      json_buffer = entry->json_buffer;
+    }
+  else if (json)
+    {
+      free (message->json);
+      message->json = NULL;
+
+      json_buffer = malloc (json_len + 1);
+      if (!json_buffer)
+        {
+          pthread_mutex_unlock (&json_proto_pool_lock);
+          return false;
+        }
+    }
+
+  pthread_mutex_unlock (&json_proto_pool_lock);
+
+  if (json_buffer)
+    {
+      memcpy (json_buffer, json, json_len);
+      json_buffer[json_len] = '\0';
+    }
+
+  gdm_custom_json_request_init (message, proto_name, proto_version, json_buffer);
+
+  return true;
+}
+
+/* Releases a message, returning it to the pool if we own it, otherwise it's
+ * a message allocated by GDM (or an untracked one) and it's just freed. */
+static inline void
+gdm_custom_json_message_free (GdmPamExtensionJSONProtocol *message)
+{
+  JSONProtoPoolEntry *entry;
+
+  if (!message)
+    return;
+
+  pthread_mutex_lock (&json_proto_pool_lock);
+  entry = json_proto_pool_lookup (message);
+
+  if (entry)
+    {
+      /* The JSON may contain sensitive data, so don't keep it around. */
+      if (entry->json_buffer)
+        explicit_bzero (entry->json_buffer, entry->json_size);
+
+      if (entry->json_size > JSON_PROTO_MESSAGE_POOL_MAX_JSON_SIZE)
+        {
+          free (entry->json_buffer);
+          entry->json_buffer = NULL;
+          entry->json_size = 0;
+        }
+
+      memset (message, 0, sizeof (GdmPamExtensionJSONProtocol));
+      entry->in_use = false;
+      pthread_mutex_unlock (&json_proto_pool_lock);
+      return;
+    }
+
+  pthread_mutex_unlock (&json_proto_pool_lock);
+
+  if (message->json)
+    explicit_bzero (message->json, strlen (message->json));
+
+  free (message->json);
+  free (message);
 }
@@ -1,6 +1,7 @@
 package gdm
 
 import (
+	"fmt"
 	"slices"
 	"testing"
 	"unsafe"
@@ -45,6 +46,11 @@ func TestGdmExtensionSupport(t *testing.T) {
 			checkExtensions:     []string{PamExtensionCustomJSON},
 			supportedExtensions: nil,
 		},
+		"Many extensions are advertised": {
+			advertisedExtensions: manyExtensions(200),
+			checkExtensions:      append(manyExtensions(250), PamExtensionCustomJSON),
+			supportedExtensions:  manyExtensions(200),
+		},
 	}
 	for name, tc := range testCases {
 		t.Run(name, func(t *testing.T) {
@@ -62,6 +68,41 @@ func TestGdmExtensionSupport(t *testing.T) {
 	}
 }
 
+// manyExtensions returns n extension names.
+func manyExtensions(n int) []string {
+	extensions := make([]string, 0, n)
+	for i := 0; i < n; i++ {
+		extensions = append(extensions, fmt.Sprintf("com.example.Extension%d", i))
+	}
+	return extensions
+}
+
+func TestGdmExtensionsCacheInvalidation(t *testing.T) {
+	// This test can't be parallel since it acts on env variables.
+	t.Cleanup(pam_test.MaybeDoLeakCheck)
+	t.Cleanup(InvalidatePamExtensionsCache)
+
+	t.Setenv("GDM_SUPPORTED_PAM_EXTENSIONS", "foo "+PamExtensionCustomJSON)
+	InvalidatePamExtensionsCache()
+	require.True(t, IsPamExtensionSupported("foo"))
+	require.True(t, IsPamExtensionSupported(PamExtensionCustomJSON))
+	require.False(t, IsPamExtensionSupported("fo"))
+
+	msg, err := newJSONProtoMessage([]byte("null"))
+	require.NoError(t, err)
+	t.Cleanup(msg.release)
+	require.Equal(t, 1, int(msg.header._type), "Unexpected message type")
+
+	t.Setenv("GDM_SUPPORTED_PAM_EXTENSIONS", "bar")
+	require.True(t, IsPamExtensionSupported("foo"), "Extensions should be cached")
+	require.False(t, IsPamExtensionSupported("bar"), "Extensions should be cached")
+
+	InvalidatePamExtensionsCache()
+	require.False(t, IsPamExtensionSupported("foo"))
+	require.False(t, IsPamExtensionSupported(PamExtensionCustomJSON))
+	require.True(t, IsPamExtensionSupported("bar"))
+}
+
 func TestGdmJSONProto(t *testing.T) {
 	t.Parallel()
 	t.Cleanup(pam_test.MaybeDoLeakCheck)
@@ -114,6 +155,31 @@ func TestGdmJSONProto(t *testing.T) {
 	}
 }
 
+func TestGdmJSONProtoMessagesAreReused(t *testing.T) {
+	// This test can't be parallel since it checks the shared messages pool.
+	t.Cleanup(pam_test.MaybeDoLeakCheck)
+
+	first, err := newJSONProtoMessage([]byte(`{"type":"poll"}`))
+	require.NoError(t, err)
+	firstPtr := unsafe.Pointer(first)
+	first.release()
+
+	second, err := newJSONProtoMessage([]byte(`"a bigger value that needs growing the buffer"`))
+	require.NoError(t, err)
+	t.Cleanup(second.release)
+	require.Equal(t, firstPtr, unsafe.Pointer(second), "Message has not been reused")
+
+	decoded, err := decodeJSONProtoMessage(pam.BinaryPointer(second))
+	require.NoError(t, err)
+	require.Equal(t, `"a bigger value that needs growing the buffer"`, string(decoded))
+
+	third, err := newJSONProtoMessage([]byte("null"))
+	require.NoError(t, err)
+	t.Cleanup(third.release)
+	require.NotEqual(t, unsafe.Pointer(second), unsafe.Pointer(third),
+		"Message in use should not be reused")
+}
+
 func TestGdmJSONProtoRequestErrors(t *testing.T) {
 	t.Parallel()
 	t.Cleanup(pam_test.MaybeDoLeakCheck)
@@ -207,7 +273,7 @@ func TestGdmJSONProtoResponseErrors(t *testing.T) {
 
 			req := allocateJSONProtoMessage()
 			t.Cleanup(req.release)
-			req.init(tc.protoName, tc.protoVersion, tc.jsonValue)
+			require.NoError(t, req.init(tc.protoName, tc.protoVersion, tc.jsonValue))
 			require.Equal(t, req.protoVersion(), tc.protoVersion)
 			require.Equal(t, req.protoName(), tc.protoName)
 
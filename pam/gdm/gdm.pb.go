@@ -40,6 +40,9 @@ const (
 	DataType_poll DataType = 6
 	// DataType_pollResponse is a poll response DataType.
 	DataType_pollResponse DataType = 7
+	// DataType_waitForEvents is a poll DataType that is only replied once
+	// there are events or the timeout is reached.
+	DataType_waitForEvents DataType = 8
 )
 
 // Enum value maps for DataType.
@@ -53,16 +56,18 @@ var (
 		5: "response",
 		6: "poll",
 		7: "pollResponse",
+		8: "waitForEvents",
 	}
 	DataType_value = map[string]int32{
-		"unknownType":  0,
-		"hello":        1,
-		"event":        2,
-		"eventAck":     3,
-		"request":      4,
-		"response":     5,
-		"poll":         6,
-		"pollResponse": 7,
+		"unknownType":   0,
+		"hello":         1,
+		"event":         2,
+		"eventAck":      3,
+		"request":       4,
+		"response":      5,
+		"poll":          6,
+		"pollResponse":  7,
+		"waitForEvents": 8,
 	}
 )
 
@@ -246,12 +251,13 @@ type Data struct {
 	sizeCache     protoimpl.SizeCache
 	unknownFields protoimpl.UnknownFields
 
-	Type         DataType      `protobuf:"varint,1,opt,name=type,proto3,enum=gdm.DataType" json:"type,omitempty"`
-	Hello        *HelloData    `protobuf:"bytes,2,opt,name=hello,proto3,oneof" json:"hello,omitempty"`
-	Request      *RequestData  `protobuf:"bytes,3,opt,name=request,proto3,oneof" json:"request,omitempty"`
-	Response     *ResponseData `protobuf:"bytes,4,opt,name=response,proto3,oneof" json:"response,omitempty"`
-	Event        *EventData    `protobuf:"bytes,5,opt,name=event,proto3,oneof" json:"event,omitempty"`
-	PollResponse []*EventData  `protobuf:"bytes,6,rep,name=pollResponse,proto3" json:"pollResponse,omitempty"`
+	Type          DataType           `protobuf:"varint,1,opt,name=type,proto3,enum=gdm.DataType" json:"type,omitempty"`
+	Hello         *HelloData         `protobuf:"bytes,2,opt,name=hello,proto3,oneof" json:"hello,omitempty"`
+	Request       *RequestData       `protobuf:"bytes,3,opt,name=request,proto3,oneof" json:"request,omitempty"`
+	Response      *ResponseData      `protobuf:"bytes,4,opt,name=response,proto3,oneof" json:"response,omitempty"`
+	Event         *EventData         `protobuf:"bytes,5,opt,name=event,proto3,oneof" json:"event,omitempty"`
+	PollResponse  []*EventData       `protobuf:"bytes,6,rep,name=pollResponse,proto3" json:"pollResponse,omitempty"`
+	WaitForEvents *WaitForEventsData `protobuf:"bytes,7,opt,name=waitForEvents,proto3,oneof" json:"waitForEvents,omitempty"`
 }
 
 func (x *Data) Reset() {
@@ -328,6 +334,13 @@ func (x *Data) GetPollResponse() []*EventData {
 	return nil
 }
 
+func (x *Data) GetWaitForEvents() *WaitForEventsData {
+	if x != nil {
+		return x.WaitForEvents
+	}
+	return nil
+}
+
 type HelloData struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -375,6 +388,54 @@ func (x *HelloData) GetVersion() uint32 {
 	return 0
 }
 
+type WaitForEventsData struct {
+	state         protoimpl.MessageState
+	sizeCache     protoimpl.SizeCache
+	unknownFields protoimpl.UnknownFields
+
+	// The maximum time GDM can hold the conversation before replying.
+	TimeoutMs uint32 `protobuf:"varint,1,opt,name=timeoutMs,proto3" json:"timeoutMs,omitempty"`
+}
+
+func (x *WaitForEventsData) Reset() {
+	*x = WaitForEventsData{}
+	if protoimpl.UnsafeEnabled {
+		mi := &file_gdm_proto_msgTypes[2]
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		ms.StoreMessageInfo(mi)
+	}
+}
+
+func (x *WaitForEventsData) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*WaitForEventsData) ProtoMessage() {}
+
+func (x *WaitForEventsData) ProtoReflect() protoreflect.Message {
+	mi := &file_gdm_proto_msgTypes[2]
+	if protoimpl.UnsafeEnabled && x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use WaitForEventsData.ProtoReflect.Descriptor instead.
+func (*WaitForEventsData) Descriptor() ([]byte, []int) {
+	return file_gdm_proto_rawDescGZIP(), []int{2}
+}
+
+func (x *WaitForEventsData) GetTimeoutMs() uint32 {
+	if x != nil {
+		return x.TimeoutMs
+	}
+	return 0
+}
+
 type Requests struct {
 	state         protoimpl.MessageState
 	sizeCache     protoimpl.SizeCache
@@ -384,7 +445,7 @@ type Requests struct {
 func (x *Requests) Reset() {
 	*x = Requests{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[2]
+		mi := &file_gdm_proto_msgTypes[3]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -397,7 +458,7 @@ func (x *Requests) String() string {
 func (*Requests) ProtoMessage() {}
 
 func (x *Requests) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[2]
+	mi := &file_gdm_proto_msgTypes[3]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -410,7 +471,7 @@ func (x *Requests) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Requests.ProtoReflect.Descriptor instead.
 func (*Requests) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{2}
+	return file_gdm_proto_rawDescGZIP(), []int{3}
 }
 
 type RequestData struct {
@@ -429,7 +490,7 @@ type RequestData struct {
 func (x *RequestData) Reset() {
 	*x = RequestData{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[3]
+		mi := &file_gdm_proto_msgTypes[4]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -442,7 +503,7 @@ func (x *RequestData) String() string {
 func (*RequestData) ProtoMessage() {}
 
 func (x *RequestData) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[3]
+	mi := &file_gdm_proto_msgTypes[4]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -455,7 +516,7 @@ func (x *RequestData) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use RequestData.ProtoReflect.Descriptor instead.
 func (*RequestData) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{3}
+	return file_gdm_proto_rawDescGZIP(), []int{4}
 }
 
 func (x *RequestData) GetType() RequestType {
@@ -511,7 +572,7 @@ type Responses struct {
 func (x *Responses) Reset() {
 	*x = Responses{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[4]
+		mi := &file_gdm_proto_msgTypes[5]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -524,7 +585,7 @@ func (x *Responses) String() string {
 func (*Responses) ProtoMessage() {}
 
 func (x *Responses) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[4]
+	mi := &file_gdm_proto_msgTypes[5]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -537,7 +598,7 @@ func (x *Responses) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Responses.ProtoReflect.Descriptor instead.
 func (*Responses) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{4}
+	return file_gdm_proto_rawDescGZIP(), []int{5}
 }
 
 type ResponseData struct {
@@ -556,7 +617,7 @@ type ResponseData struct {
 func (x *ResponseData) Reset() {
 	*x = ResponseData{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[5]
+		mi := &file_gdm_proto_msgTypes[6]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -569,7 +630,7 @@ func (x *ResponseData) String() string {
 func (*ResponseData) ProtoMessage() {}
 
 func (x *ResponseData) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[5]
+	mi := &file_gdm_proto_msgTypes[6]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -582,7 +643,7 @@ func (x *ResponseData) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use ResponseData.ProtoReflect.Descriptor instead.
 func (*ResponseData) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{5}
+	return file_gdm_proto_rawDescGZIP(), []int{6}
 }
 
 func (x *ResponseData) GetType() RequestType {
@@ -638,7 +699,7 @@ type Events struct {
 func (x *Events) Reset() {
 	*x = Events{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[6]
+		mi := &file_gdm_proto_msgTypes[7]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -651,7 +712,7 @@ func (x *Events) String() string {
 func (*Events) ProtoMessage() {}
 
 func (x *Events) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[6]
+	mi := &file_gdm_proto_msgTypes[7]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -664,7 +725,7 @@ func (x *Events) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events.ProtoReflect.Descriptor instead.
 func (*Events) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6}
+	return file_gdm_proto_rawDescGZIP(), []int{7}
 }
 
 type EventData struct {
@@ -692,7 +753,7 @@ type EventData struct {
 func (x *EventData) Reset() {
 	*x = EventData{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[7]
+		mi := &file_gdm_proto_msgTypes[8]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -705,7 +766,7 @@ func (x *EventData) String() string {
 func (*EventData) ProtoMessage() {}
 
 func (x *EventData) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[7]
+	mi := &file_gdm_proto_msgTypes[8]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -718,7 +779,7 @@ func (x *EventData) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use EventData.ProtoReflect.Descriptor instead.
 func (*EventData) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{7}
+	return file_gdm_proto_rawDescGZIP(), []int{8}
 }
 
 func (x *EventData) GetType() EventType {
@@ -891,7 +952,7 @@ type Requests_UiLayoutCapabilities struct {
 func (x *Requests_UiLayoutCapabilities) Reset() {
 	*x = Requests_UiLayoutCapabilities{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[8]
+		mi := &file_gdm_proto_msgTypes[9]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -904,7 +965,7 @@ func (x *Requests_UiLayoutCapabilities) String() string {
 func (*Requests_UiLayoutCapabilities) ProtoMessage() {}
 
 func (x *Requests_UiLayoutCapabilities) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[8]
+	mi := &file_gdm_proto_msgTypes[9]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -917,7 +978,7 @@ func (x *Requests_UiLayoutCapabilities) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Requests_UiLayoutCapabilities.ProtoReflect.Descriptor instead.
 func (*Requests_UiLayoutCapabilities) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{2, 0}
+	return file_gdm_proto_rawDescGZIP(), []int{3, 0}
 }
 
 type Requests_ChangeStage struct {
@@ -931,7 +992,7 @@ type Requests_ChangeStage struct {
 func (x *Requests_ChangeStage) Reset() {
 	*x = Requests_ChangeStage{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[9]
+		mi := &file_gdm_proto_msgTypes[10]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -944,7 +1005,7 @@ func (x *Requests_ChangeStage) String() string {
 func (*Requests_ChangeStage) ProtoMessage() {}
 
 func (x *Requests_ChangeStage) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[9]
+	mi := &file_gdm_proto_msgTypes[10]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -957,7 +1018,7 @@ func (x *Requests_ChangeStage) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Requests_ChangeStage.ProtoReflect.Descriptor instead.
 func (*Requests_ChangeStage) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{2, 1}
+	return file_gdm_proto_rawDescGZIP(), []int{3, 1}
 }
 
 func (x *Requests_ChangeStage) GetStage() int32 {
@@ -976,7 +1037,7 @@ type Responses_Ack struct {
 func (x *Responses_Ack) Reset() {
 	*x = Responses_Ack{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[10]
+		mi := &file_gdm_proto_msgTypes[11]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -989,7 +1050,7 @@ func (x *Responses_Ack) String() string {
 func (*Responses_Ack) ProtoMessage() {}
 
 func (x *Responses_Ack) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[10]
+	mi := &file_gdm_proto_msgTypes[11]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1002,7 +1063,7 @@ func (x *Responses_Ack) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Responses_Ack.ProtoReflect.Descriptor instead.
 func (*Responses_Ack) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{4, 0}
+	return file_gdm_proto_rawDescGZIP(), []int{5, 0}
 }
 
 type Responses_UiLayoutCapabilities struct {
@@ -1016,7 +1077,7 @@ type Responses_UiLayoutCapabilities struct {
 func (x *Responses_UiLayoutCapabilities) Reset() {
 	*x = Responses_UiLayoutCapabilities{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[11]
+		mi := &file_gdm_proto_msgTypes[12]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1029,7 +1090,7 @@ func (x *Responses_UiLayoutCapabilities) String() string {
 func (*Responses_UiLayoutCapabilities) ProtoMessage() {}
 
 func (x *Responses_UiLayoutCapabilities) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[11]
+	mi := &file_gdm_proto_msgTypes[12]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1042,7 +1103,7 @@ func (x *Responses_UiLayoutCapabilities) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Responses_UiLayoutCapabilities.ProtoReflect.Descriptor instead.
 func (*Responses_UiLayoutCapabilities) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{4, 1}
+	return file_gdm_proto_rawDescGZIP(), []int{5, 1}
 }
 
 func (x *Responses_UiLayoutCapabilities) GetSupportedUiLayouts() []*authd.UILayout {
@@ -1063,7 +1124,7 @@ type Events_BrokersReceived struct {
 func (x *Events_BrokersReceived) Reset() {
 	*x = Events_BrokersReceived{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[12]
+		mi := &file_gdm_proto_msgTypes[13]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1076,7 +1137,7 @@ func (x *Events_BrokersReceived) String() string {
 func (*Events_BrokersReceived) ProtoMessage() {}
 
 func (x *Events_BrokersReceived) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[12]
+	mi := &file_gdm_proto_msgTypes[13]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1089,7 +1150,7 @@ func (x *Events_BrokersReceived) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_BrokersReceived.ProtoReflect.Descriptor instead.
 func (*Events_BrokersReceived) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 0}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 0}
 }
 
 func (x *Events_BrokersReceived) GetBrokersInfos() []*authd.ABResponse_BrokerInfo {
@@ -1110,7 +1171,7 @@ type Events_BrokerSelected struct {
 func (x *Events_BrokerSelected) Reset() {
 	*x = Events_BrokerSelected{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[13]
+		mi := &file_gdm_proto_msgTypes[14]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1123,7 +1184,7 @@ func (x *Events_BrokerSelected) String() string {
 func (*Events_BrokerSelected) ProtoMessage() {}
 
 func (x *Events_BrokerSelected) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[13]
+	mi := &file_gdm_proto_msgTypes[14]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1136,7 +1197,7 @@ func (x *Events_BrokerSelected) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_BrokerSelected.ProtoReflect.Descriptor instead.
 func (*Events_BrokerSelected) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 1}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 1}
 }
 
 func (x *Events_BrokerSelected) GetBrokerId() string {
@@ -1157,7 +1218,7 @@ type Events_UserSelected struct {
 func (x *Events_UserSelected) Reset() {
 	*x = Events_UserSelected{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[14]
+		mi := &file_gdm_proto_msgTypes[15]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1170,7 +1231,7 @@ func (x *Events_UserSelected) String() string {
 func (*Events_UserSelected) ProtoMessage() {}
 
 func (x *Events_UserSelected) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[14]
+	mi := &file_gdm_proto_msgTypes[15]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1183,7 +1244,7 @@ func (x *Events_UserSelected) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_UserSelected.ProtoReflect.Descriptor instead.
 func (*Events_UserSelected) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 2}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 2}
 }
 
 func (x *Events_UserSelected) GetUserId() string {
@@ -1202,7 +1263,7 @@ type Events_StartAuthentication struct {
 func (x *Events_StartAuthentication) Reset() {
 	*x = Events_StartAuthentication{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[15]
+		mi := &file_gdm_proto_msgTypes[16]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1215,7 +1276,7 @@ func (x *Events_StartAuthentication) String() string {
 func (*Events_StartAuthentication) ProtoMessage() {}
 
 func (x *Events_StartAuthentication) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[15]
+	mi := &file_gdm_proto_msgTypes[16]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1228,7 +1289,7 @@ func (x *Events_StartAuthentication) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_StartAuthentication.ProtoReflect.Descriptor instead.
 func (*Events_StartAuthentication) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 3}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 3}
 }
 
 type Events_AuthModesReceived struct {
@@ -1242,7 +1303,7 @@ type Events_AuthModesReceived struct {
 func (x *Events_AuthModesReceived) Reset() {
 	*x = Events_AuthModesReceived{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[16]
+		mi := &file_gdm_proto_msgTypes[17]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1255,7 +1316,7 @@ func (x *Events_AuthModesReceived) String() string {
 func (*Events_AuthModesReceived) ProtoMessage() {}
 
 func (x *Events_AuthModesReceived) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[16]
+	mi := &file_gdm_proto_msgTypes[17]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1268,7 +1329,7 @@ func (x *Events_AuthModesReceived) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_AuthModesReceived.ProtoReflect.Descriptor instead.
 func (*Events_AuthModesReceived) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 4}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 4}
 }
 
 func (x *Events_AuthModesReceived) GetAuthModes() []*authd.GAMResponse_AuthenticationMode {
@@ -1289,7 +1350,7 @@ type Events_AuthModeSelected struct {
 func (x *Events_AuthModeSelected) Reset() {
 	*x = Events_AuthModeSelected{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[17]
+		mi := &file_gdm_proto_msgTypes[18]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1302,7 +1363,7 @@ func (x *Events_AuthModeSelected) String() string {
 func (*Events_AuthModeSelected) ProtoMessage() {}
 
 func (x *Events_AuthModeSelected) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[17]
+	mi := &file_gdm_proto_msgTypes[18]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1315,7 +1376,7 @@ func (x *Events_AuthModeSelected) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_AuthModeSelected.ProtoReflect.Descriptor instead.
 func (*Events_AuthModeSelected) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 5}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 5}
 }
 
 func (x *Events_AuthModeSelected) GetAuthModeId() string {
@@ -1336,7 +1397,7 @@ type Events_AuthEvent struct {
 func (x *Events_AuthEvent) Reset() {
 	*x = Events_AuthEvent{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[18]
+		mi := &file_gdm_proto_msgTypes[19]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1349,7 +1410,7 @@ func (x *Events_AuthEvent) String() string {
 func (*Events_AuthEvent) ProtoMessage() {}
 
 func (x *Events_AuthEvent) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[18]
+	mi := &file_gdm_proto_msgTypes[19]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1362,7 +1423,7 @@ func (x *Events_AuthEvent) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_AuthEvent.ProtoReflect.Descriptor instead.
 func (*Events_AuthEvent) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 6}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 6}
 }
 
 func (x *Events_AuthEvent) GetResponse() *authd.IAResponse {
@@ -1381,7 +1442,7 @@ type Events_ReselectAuthMode struct {
 func (x *Events_ReselectAuthMode) Reset() {
 	*x = Events_ReselectAuthMode{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[19]
+		mi := &file_gdm_proto_msgTypes[20]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1394,7 +1455,7 @@ func (x *Events_ReselectAuthMode) String() string {
 func (*Events_ReselectAuthMode) ProtoMessage() {}
 
 func (x *Events_ReselectAuthMode) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[19]
+	mi := &file_gdm_proto_msgTypes[20]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1407,7 +1468,7 @@ func (x *Events_ReselectAuthMode) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_ReselectAuthMode.ProtoReflect.Descriptor instead.
 func (*Events_ReselectAuthMode) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 7}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 7}
 }
 
 type Events_IsAuthenticatedRequested struct {
@@ -1422,7 +1483,7 @@ type Events_IsAuthenticatedRequested struct {
 func (x *Events_IsAuthenticatedRequested) Reset() {
 	*x = Events_IsAuthenticatedRequested{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[20]
+		mi := &file_gdm_proto_msgTypes[21]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1435,7 +1496,7 @@ func (x *Events_IsAuthenticatedRequested) String() string {
 func (*Events_IsAuthenticatedRequested) ProtoMessage() {}
 
 func (x *Events_IsAuthenticatedRequested) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[20]
+	mi := &file_gdm_proto_msgTypes[21]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1448,7 +1509,7 @@ func (x *Events_IsAuthenticatedRequested) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_IsAuthenticatedRequested.ProtoReflect.Descriptor instead.
 func (*Events_IsAuthenticatedRequested) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 8}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 8}
 }
 
 func (x *Events_IsAuthenticatedRequested) GetChallenge() string {
@@ -1476,7 +1537,7 @@ type Events_StageChanged struct {
 func (x *Events_StageChanged) Reset() {
 	*x = Events_StageChanged{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[21]
+		mi := &file_gdm_proto_msgTypes[22]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1489,7 +1550,7 @@ func (x *Events_StageChanged) String() string {
 func (*Events_StageChanged) ProtoMessage() {}
 
 func (x *Events_StageChanged) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[21]
+	mi := &file_gdm_proto_msgTypes[22]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1502,7 +1563,7 @@ func (x *Events_StageChanged) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_StageChanged.ProtoReflect.Descriptor instead.
 func (*Events_StageChanged) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 9}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 9}
 }
 
 func (x *Events_StageChanged) GetStage() int32 {
@@ -1523,7 +1584,7 @@ type Events_UiLayoutReceived struct {
 func (x *Events_UiLayoutReceived) Reset() {
 	*x = Events_UiLayoutReceived{}
 	if protoimpl.UnsafeEnabled {
-		mi := &file_gdm_proto_msgTypes[22]
+		mi := &file_gdm_proto_msgTypes[23]
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		ms.StoreMessageInfo(mi)
 	}
@@ -1536,7 +1597,7 @@ func (x *Events_UiLayoutReceived) String() string {
 func (*Events_UiLayoutReceived) ProtoMessage() {}
 
 func (x *Events_UiLayoutReceived) ProtoReflect() protoreflect.Message {
-	mi := &file_gdm_proto_msgTypes[22]
+	mi := &file_gdm_proto_msgTypes[23]
 	if protoimpl.UnsafeEnabled && x != nil {
 		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
 		if ms.LoadMessageInfo() == nil {
@@ -1549,7 +1610,7 @@ func (x *Events_UiLayoutReceived) ProtoReflect() protoreflect.Message {
 
 // Deprecated: Use Events_UiLayoutReceived.ProtoReflect.Descriptor instead.
 func (*Events_UiLayoutReceived) Descriptor() ([]byte, []int) {
-	return file_gdm_proto_rawDescGZIP(), []int{6, 10}
+	return file_gdm_proto_rawDescGZIP(), []int{7, 10}
 }
 
 func (x *Events_UiLayoutReceived) GetUiLayout() *authd.UILayout {
@@ -1563,7 +1624,7 @@ var File_gdm_proto protoreflect.FileDescriptor
 
 var file_gdm_proto_rawDesc = []byte{
 	0x0a, 0x09, 0x67, 0x64, 0x6d, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x12, 0x03, 0x67, 0x64, 0x6d,
-	0x1a, 0x0b, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x22, 0xc5, 0x02,
+	0x1a, 0x0b, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x22, 0x9a, 0x03,
 	0x0a, 0x04, 0x44, 0x61, 0x74, 0x61, 0x12, 0x21, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01,
 	0x20, 0x01, 0x28, 0x0e, 0x32, 0x0d, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x44, 0x61, 0x74, 0x61, 0x54,
 	0x79, 0x70, 0x65, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x29, 0x0a, 0x05, 0x68, 0x65, 0x6c,
@@ -1581,179 +1642,189 @@ var file_gdm_proto_rawDesc = []byte{
 	0x74, 0x88, 0x01, 0x01, 0x12, 0x32, 0x0a, 0x0c, 0x70, 0x6f, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70,
 	0x6f, 0x6e, 0x73, 0x65, 0x18, 0x06, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x0e, 0x2e, 0x67, 0x64, 0x6d,
 	0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x61, 0x74, 0x61, 0x52, 0x0c, 0x70, 0x6f, 0x6c, 0x6c,
-	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x42, 0x08, 0x0a, 0x06, 0x5f, 0x68, 0x65, 0x6c,
-	0x6c, 0x6f, 0x42, 0x0a, 0x0a, 0x08, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x42, 0x0b,
-	0x0a, 0x09, 0x5f, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x42, 0x08, 0x0a, 0x06, 0x5f,
-	0x65, 0x76, 0x65, 0x6e, 0x74, 0x22, 0x25, 0x0a, 0x09, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x44, 0x61,
-	0x74, 0x61, 0x12, 0x18, 0x0a, 0x07, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x18, 0x01, 0x20,
-	0x01, 0x28, 0x0d, 0x52, 0x07, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x47, 0x0a, 0x08,
-	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x1a, 0x16, 0x0a, 0x14, 0x55, 0x69, 0x4c, 0x61,
-	0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73,
-	0x1a, 0x23, 0x0a, 0x0b, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x74, 0x61, 0x67, 0x65, 0x12,
-	0x14, 0x0a, 0x05, 0x73, 0x74, 0x61, 0x67, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x05,
-	0x73, 0x74, 0x61, 0x67, 0x65, 0x22, 0xd4, 0x01, 0x0a, 0x0b, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
-	0x74, 0x44, 0x61, 0x74, 0x61, 0x12, 0x24, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20,
-	0x01, 0x28, 0x0e, 0x32, 0x10, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
-	0x74, 0x54, 0x79, 0x70, 0x65, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x58, 0x0a, 0x14, 0x75,
-	0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74,
-	0x69, 0x65, 0x73, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x22, 0x2e, 0x67, 0x64, 0x6d, 0x2e,
-	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x2e, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75,
-	0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x48, 0x00, 0x52,
-	0x14, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c,
-	0x69, 0x74, 0x69, 0x65, 0x73, 0x12, 0x3d, 0x0a, 0x0b, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53,
-	0x74, 0x61, 0x67, 0x65, 0x18, 0x0b, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x19, 0x2e, 0x67, 0x64, 0x6d,
-	0x2e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x2e, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65,
-	0x53, 0x74, 0x61, 0x67, 0x65, 0x48, 0x00, 0x52, 0x0b, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53,
-	0x74, 0x61, 0x67, 0x65, 0x42, 0x06, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x22, 0x6b, 0x0a, 0x09,
-	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x73, 0x1a, 0x05, 0x0a, 0x03, 0x41, 0x63, 0x6b,
-	0x1a, 0x57, 0x0a, 0x14, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61,
-	0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x12, 0x3f, 0x0a, 0x12, 0x73, 0x75, 0x70, 0x70,
-	0x6f, 0x72, 0x74, 0x65, 0x64, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x73, 0x18, 0x0a,
-	0x20, 0x03, 0x28, 0x0b, 0x32, 0x0f, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x55, 0x49, 0x4c,
-	0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x12, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64,
-	0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x73, 0x22, 0xbf, 0x01, 0x0a, 0x0c, 0x52, 0x65,
-	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x44, 0x61, 0x74, 0x61, 0x12, 0x24, 0x0a, 0x04, 0x74, 0x79,
-	0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x10, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52,
-	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x54, 0x79, 0x70, 0x65, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65,
-	0x12, 0x26, 0x0a, 0x03, 0x61, 0x63, 0x6b, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e,
-	0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x73, 0x2e, 0x41, 0x63,
-	0x6b, 0x48, 0x00, 0x52, 0x03, 0x61, 0x63, 0x6b, 0x12, 0x59, 0x0a, 0x14, 0x75, 0x69, 0x4c, 0x61,
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x12, 0x41, 0x0a, 0x0d, 0x77, 0x61, 0x69, 0x74,
+	0x46, 0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x16, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x57, 0x61, 0x69, 0x74, 0x46, 0x6f, 0x72, 0x45, 0x76, 0x65,
+	0x6e, 0x74, 0x73, 0x44, 0x61, 0x74, 0x61, 0x48, 0x04, 0x52, 0x0d, 0x77, 0x61, 0x69, 0x74, 0x46,
+	0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x88, 0x01, 0x01, 0x42, 0x08, 0x0a, 0x06, 0x5f,
+	0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x42, 0x0a, 0x0a, 0x08, 0x5f, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73,
+	0x74, 0x42, 0x0b, 0x0a, 0x09, 0x5f, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x42, 0x08,
+	0x0a, 0x06, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x42, 0x10, 0x0a, 0x0e, 0x5f, 0x77, 0x61, 0x69,
+	0x74, 0x46, 0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x22, 0x25, 0x0a, 0x09, 0x48, 0x65,
+	0x6c, 0x6c, 0x6f, 0x44, 0x61, 0x74, 0x61, 0x12, 0x18, 0x0a, 0x07, 0x76, 0x65, 0x72, 0x73, 0x69,
+	0x6f, 0x6e, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0d, 0x52, 0x07, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+	0x6e, 0x22, 0x31, 0x0a, 0x11, 0x57, 0x61, 0x69, 0x74, 0x46, 0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e,
+	0x74, 0x73, 0x44, 0x61, 0x74, 0x61, 0x12, 0x1c, 0x0a, 0x09, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75,
+	0x74, 0x4d, 0x73, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0d, 0x52, 0x09, 0x74, 0x69, 0x6d, 0x65, 0x6f,
+	0x75, 0x74, 0x4d, 0x73, 0x22, 0x47, 0x0a, 0x08, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73,
+	0x1a, 0x16, 0x0a, 0x14, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61,
+	0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x1a, 0x23, 0x0a, 0x0b, 0x43, 0x68, 0x61, 0x6e,
+	0x67, 0x65, 0x53, 0x74, 0x61, 0x67, 0x65, 0x12, 0x14, 0x0a, 0x05, 0x73, 0x74, 0x61, 0x67, 0x65,
+	0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x73, 0x74, 0x61, 0x67, 0x65, 0x22, 0xd4, 0x01,
+	0x0a, 0x0b, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x44, 0x61, 0x74, 0x61, 0x12, 0x24, 0x0a,
+	0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x10, 0x2e, 0x67, 0x64,
+	0x6d, 0x2e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x54, 0x79, 0x70, 0x65, 0x52, 0x04, 0x74,
+	0x79, 0x70, 0x65, 0x12, 0x58, 0x0a, 0x14, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43,
+	0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x18, 0x0a, 0x20, 0x01, 0x28,
+	0x0b, 0x32, 0x22, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73,
+	0x2e, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c,
+	0x69, 0x74, 0x69, 0x65, 0x73, 0x48, 0x00, 0x52, 0x14, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75,
+	0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x12, 0x3d, 0x0a,
+	0x0b, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x74, 0x61, 0x67, 0x65, 0x18, 0x0b, 0x20, 0x01,
+	0x28, 0x0b, 0x32, 0x19, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+	0x73, 0x2e, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x74, 0x61, 0x67, 0x65, 0x48, 0x00, 0x52,
+	0x0b, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x74, 0x61, 0x67, 0x65, 0x42, 0x06, 0x0a, 0x04,
+	0x64, 0x61, 0x74, 0x61, 0x22, 0x6b, 0x0a, 0x09, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+	0x73, 0x1a, 0x05, 0x0a, 0x03, 0x41, 0x63, 0x6b, 0x1a, 0x57, 0x0a, 0x14, 0x55, 0x69, 0x4c, 0x61,
 	0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73,
-	0x18, 0x0b, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x23, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x73,
-	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x73, 0x2e, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43,
-	0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x48, 0x00, 0x52, 0x14, 0x75,
+	0x12, 0x3f, 0x0a, 0x12, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x55, 0x69, 0x4c,
+	0x61, 0x79, 0x6f, 0x75, 0x74, 0x73, 0x18, 0x0a, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x0f, 0x2e, 0x61,
+	0x75, 0x74, 0x68, 0x64, 0x2e, 0x55, 0x49, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x12, 0x73,
+	0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74,
+	0x73, 0x22, 0xbf, 0x01, 0x0a, 0x0c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x44, 0x61,
+	0x74, 0x61, 0x12, 0x24, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e,
+	0x32, 0x10, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x54, 0x79,
+	0x70, 0x65, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x26, 0x0a, 0x03, 0x61, 0x63, 0x6b, 0x18,
+	0x0a, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x12, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x73, 0x70,
+	0x6f, 0x6e, 0x73, 0x65, 0x73, 0x2e, 0x41, 0x63, 0x6b, 0x48, 0x00, 0x52, 0x03, 0x61, 0x63, 0x6b,
+	0x12, 0x59, 0x0a, 0x14, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61,
+	0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x18, 0x0b, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x23,
+	0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x73, 0x2e, 0x55,
 	0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74,
-	0x69, 0x65, 0x73, 0x42, 0x06, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x22, 0xfe, 0x04, 0x0a, 0x06,
-	0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x1a, 0x53, 0x0a, 0x0f, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x72,
-	0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x40, 0x0a, 0x0c, 0x62, 0x72, 0x6f,
-	0x6b, 0x65, 0x72, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32,
-	0x1c, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x41, 0x42, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-	0x73, 0x65, 0x2e, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x0c, 0x62,
-	0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x49, 0x6e, 0x66, 0x6f, 0x73, 0x1a, 0x2c, 0x0a, 0x0e, 0x42,
-	0x72, 0x6f, 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x1a, 0x0a,
-	0x08, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x49, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
-	0x08, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x49, 0x64, 0x1a, 0x26, 0x0a, 0x0c, 0x55, 0x73, 0x65,
-	0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x16, 0x0a, 0x06, 0x75, 0x73, 0x65,
-	0x72, 0x49, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x06, 0x75, 0x73, 0x65, 0x72, 0x49,
-	0x64, 0x1a, 0x15, 0x0a, 0x13, 0x53, 0x74, 0x61, 0x72, 0x74, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e,
-	0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x1a, 0x58, 0x0a, 0x11, 0x41, 0x75, 0x74, 0x68,
-	0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x43, 0x0a,
-	0x09, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b,
-	0x32, 0x25, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x47, 0x41, 0x4d, 0x52, 0x65, 0x73, 0x70,
-	0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74,
-	0x69, 0x6f, 0x6e, 0x4d, 0x6f, 0x64, 0x65, 0x52, 0x09, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64,
-	0x65, 0x73, 0x1a, 0x32, 0x0a, 0x10, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x53, 0x65,
-	0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x1e, 0x0a, 0x0a, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f,
-	0x64, 0x65, 0x49, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0a, 0x61, 0x75, 0x74, 0x68,
-	0x4d, 0x6f, 0x64, 0x65, 0x49, 0x64, 0x1a, 0x3a, 0x0a, 0x09, 0x41, 0x75, 0x74, 0x68, 0x45, 0x76,
-	0x65, 0x6e, 0x74, 0x12, 0x2d, 0x0a, 0x08, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x18,
-	0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x11, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x49, 0x41,
-	0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x52, 0x08, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-	0x73, 0x65, 0x1a, 0x12, 0x0a, 0x10, 0x52, 0x65, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x41, 0x75,
-	0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x1a, 0x6d, 0x0a, 0x18, 0x49, 0x73, 0x41, 0x75, 0x74, 0x68,
-	0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
-	0x65, 0x64, 0x12, 0x21, 0x0a, 0x09, 0x63, 0x68, 0x61, 0x6c, 0x6c, 0x65, 0x6e, 0x67, 0x65, 0x18,
-	0x01, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52, 0x09, 0x63, 0x68, 0x61, 0x6c, 0x6c, 0x65, 0x6e,
-	0x67, 0x65, 0x88, 0x01, 0x01, 0x12, 0x17, 0x0a, 0x04, 0x77, 0x61, 0x69, 0x74, 0x18, 0x02, 0x20,
-	0x01, 0x28, 0x08, 0x48, 0x01, 0x52, 0x04, 0x77, 0x61, 0x69, 0x74, 0x88, 0x01, 0x01, 0x42, 0x0c,
-	0x0a, 0x0a, 0x5f, 0x63, 0x68, 0x61, 0x6c, 0x6c, 0x65, 0x6e, 0x67, 0x65, 0x42, 0x07, 0x0a, 0x05,
-	0x5f, 0x77, 0x61, 0x69, 0x74, 0x1a, 0x24, 0x0a, 0x0c, 0x53, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68,
-	0x61, 0x6e, 0x67, 0x65, 0x64, 0x12, 0x14, 0x0a, 0x05, 0x73, 0x74, 0x61, 0x67, 0x65, 0x18, 0x01,
-	0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x73, 0x74, 0x61, 0x67, 0x65, 0x1a, 0x3f, 0x0a, 0x10, 0x55,
-	0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12,
-	0x2b, 0x0a, 0x08, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x18, 0x01, 0x20, 0x01, 0x28,
-	0x0b, 0x32, 0x0f, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x55, 0x49, 0x4c, 0x61, 0x79, 0x6f,
-	0x75, 0x74, 0x52, 0x08, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x22, 0xe9, 0x06, 0x0a,
-	0x09, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x61, 0x74, 0x61, 0x12, 0x22, 0x0a, 0x04, 0x74, 0x79,
-	0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e, 0x32, 0x0e, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45,
-	0x76, 0x65, 0x6e, 0x74, 0x54, 0x79, 0x70, 0x65, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x47,
-	0x0a, 0x0f, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65,
-	0x64, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1b, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76,
-	0x65, 0x6e, 0x74, 0x73, 0x2e, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x52, 0x65, 0x63, 0x65,
-	0x69, 0x76, 0x65, 0x64, 0x48, 0x00, 0x52, 0x0f, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x52,
-	0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x44, 0x0a, 0x0e, 0x62, 0x72, 0x6f, 0x6b, 0x65,
-	0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x18, 0x0b, 0x20, 0x01, 0x28, 0x0b, 0x32,
-	0x1a, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x42, 0x72, 0x6f,
-	0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x48, 0x00, 0x52, 0x0e, 0x62,
-	0x72, 0x6f, 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x4d, 0x0a,
-	0x11, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76,
-	0x65, 0x64, 0x18, 0x0c, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1d, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45,
-	0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52,
-	0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x48, 0x00, 0x52, 0x11, 0x61, 0x75, 0x74, 0x68, 0x4d,
-	0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x4a, 0x0a, 0x10,
+	0x69, 0x65, 0x73, 0x48, 0x00, 0x52, 0x14, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43,
+	0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x42, 0x06, 0x0a, 0x04, 0x64,
+	0x61, 0x74, 0x61, 0x22, 0xfe, 0x04, 0x0a, 0x06, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x1a, 0x53,
+	0x0a, 0x0f, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65,
+	0x64, 0x12, 0x40, 0x0a, 0x0c, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x49, 0x6e, 0x66, 0x6f,
+	0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x1c, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2e,
+	0x41, 0x42, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x42, 0x72, 0x6f, 0x6b, 0x65,
+	0x72, 0x49, 0x6e, 0x66, 0x6f, 0x52, 0x0c, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x49, 0x6e,
+	0x66, 0x6f, 0x73, 0x1a, 0x2c, 0x0a, 0x0e, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c,
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x1a, 0x0a, 0x08, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x49,
+	0x64, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x49,
+	0x64, 0x1a, 0x26, 0x0a, 0x0c, 0x55, 0x73, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65,
+	0x64, 0x12, 0x16, 0x0a, 0x06, 0x75, 0x73, 0x65, 0x72, 0x49, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28,
+	0x09, 0x52, 0x06, 0x75, 0x73, 0x65, 0x72, 0x49, 0x64, 0x1a, 0x15, 0x0a, 0x13, 0x53, 0x74, 0x61,
+	0x72, 0x74, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x1a, 0x58, 0x0a, 0x11, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63,
+	0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x43, 0x0a, 0x09, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64,
+	0x65, 0x73, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0b, 0x32, 0x25, 0x2e, 0x61, 0x75, 0x74, 0x68, 0x64,
+	0x2e, 0x47, 0x41, 0x4d, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x2e, 0x41, 0x75, 0x74,
+	0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4d, 0x6f, 0x64, 0x65, 0x52,
+	0x09, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x1a, 0x32, 0x0a, 0x10, 0x41, 0x75,
+	0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x1e,
+	0x0a, 0x0a, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x49, 0x64, 0x18, 0x01, 0x20, 0x01,
+	0x28, 0x09, 0x52, 0x0a, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x49, 0x64, 0x1a, 0x3a,
+	0x0a, 0x09, 0x41, 0x75, 0x74, 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x12, 0x2d, 0x0a, 0x08, 0x72,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x11, 0x2e,
+	0x61, 0x75, 0x74, 0x68, 0x64, 0x2e, 0x49, 0x41, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65,
+	0x52, 0x08, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x1a, 0x12, 0x0a, 0x10, 0x52, 0x65,
+	0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x1a, 0x6d,
+	0x0a, 0x18, 0x49, 0x73, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65,
+	0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x12, 0x21, 0x0a, 0x09, 0x63, 0x68,
+	0x61, 0x6c, 0x6c, 0x65, 0x6e, 0x67, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x48, 0x00, 0x52,
+	0x09, 0x63, 0x68, 0x61, 0x6c, 0x6c, 0x65, 0x6e, 0x67, 0x65, 0x88, 0x01, 0x01, 0x12, 0x17, 0x0a,
+	0x04, 0x77, 0x61, 0x69, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x48, 0x01, 0x52, 0x04, 0x77,
+	0x61, 0x69, 0x74, 0x88, 0x01, 0x01, 0x42, 0x0c, 0x0a, 0x0a, 0x5f, 0x63, 0x68, 0x61, 0x6c, 0x6c,
+	0x65, 0x6e, 0x67, 0x65, 0x42, 0x07, 0x0a, 0x05, 0x5f, 0x77, 0x61, 0x69, 0x74, 0x1a, 0x24, 0x0a,
+	0x0c, 0x53, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x12, 0x14, 0x0a,
+	0x05, 0x73, 0x74, 0x61, 0x67, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x73, 0x74,
+	0x61, 0x67, 0x65, 0x1a, 0x3f, 0x0a, 0x10, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52,
+	0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x2b, 0x0a, 0x08, 0x75, 0x69, 0x4c, 0x61, 0x79,
+	0x6f, 0x75, 0x74, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x0f, 0x2e, 0x61, 0x75, 0x74, 0x68,
+	0x64, 0x2e, 0x55, 0x49, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x08, 0x75, 0x69, 0x4c, 0x61,
+	0x79, 0x6f, 0x75, 0x74, 0x22, 0xe9, 0x06, 0x0a, 0x09, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x61,
+	0x74, 0x61, 0x12, 0x22, 0x0a, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0e,
+	0x32, 0x0e, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x54, 0x79, 0x70, 0x65,
+	0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x47, 0x0a, 0x0f, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72,
+	0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x18, 0x0a, 0x20, 0x01, 0x28, 0x0b, 0x32,
+	0x1b, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x42, 0x72, 0x6f,
+	0x6b, 0x65, 0x72, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x48, 0x00, 0x52, 0x0f,
+	0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12,
+	0x44, 0x0a, 0x0e, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65,
+	0x64, 0x18, 0x0b, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1a, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76,
+	0x65, 0x6e, 0x74, 0x73, 0x2e, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63,
+	0x74, 0x65, 0x64, 0x48, 0x00, 0x52, 0x0e, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c,
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x4d, 0x0a, 0x11, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64,
+	0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x18, 0x0c, 0x20, 0x01, 0x28, 0x0b,
+	0x32, 0x1d, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x41, 0x75,
+	0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x48,
+	0x00, 0x52, 0x11, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65,
+	0x69, 0x76, 0x65, 0x64, 0x12, 0x4a, 0x0a, 0x10, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65,
+	0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x18, 0x0d, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c,
+	0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x41, 0x75, 0x74, 0x68,
+	0x4d, 0x6f, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x48, 0x00, 0x52, 0x10,
 	0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64,
-	0x18, 0x0d, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65,
-	0x6e, 0x74, 0x73, 0x2e, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65,
-	0x63, 0x74, 0x65, 0x64, 0x48, 0x00, 0x52, 0x10, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65,
-	0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x12, 0x62, 0x0a, 0x18, 0x69, 0x73, 0x41, 0x75,
+	0x12, 0x62, 0x0a, 0x18, 0x69, 0x73, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61,
+	0x74, 0x65, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x18, 0x0e, 0x20, 0x01,
+	0x28, 0x0b, 0x32, 0x24, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e,
+	0x49, 0x73, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x52,
+	0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x48, 0x00, 0x52, 0x18, 0x69, 0x73, 0x41, 0x75,
 	0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65,
-	0x73, 0x74, 0x65, 0x64, 0x18, 0x0e, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x24, 0x2e, 0x67, 0x64, 0x6d,
-	0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x49, 0x73, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e,
-	0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64,
-	0x48, 0x00, 0x52, 0x18, 0x69, 0x73, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61,
-	0x74, 0x65, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x12, 0x3e, 0x0a, 0x0c,
-	0x73, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x18, 0x0f, 0x20, 0x01,
-	0x28, 0x0b, 0x32, 0x18, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e,
-	0x53, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x48, 0x00, 0x52, 0x0c,
-	0x73, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x12, 0x4a, 0x0a, 0x10,
+	0x73, 0x74, 0x65, 0x64, 0x12, 0x3e, 0x0a, 0x0c, 0x73, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61,
+	0x6e, 0x67, 0x65, 0x64, 0x18, 0x0f, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x18, 0x2e, 0x67, 0x64, 0x6d,
+	0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61,
+	0x6e, 0x67, 0x65, 0x64, 0x48, 0x00, 0x52, 0x0c, 0x73, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61,
+	0x6e, 0x67, 0x65, 0x64, 0x12, 0x4a, 0x0a, 0x10, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74,
+	0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x18, 0x10, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c,
+	0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x55, 0x69, 0x4c, 0x61,
+	0x79, 0x6f, 0x75, 0x74, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x48, 0x00, 0x52, 0x10,
 	0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64,
-	0x18, 0x10, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65,
-	0x6e, 0x74, 0x73, 0x2e, 0x55, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x65, 0x63, 0x65,
-	0x69, 0x76, 0x65, 0x64, 0x48, 0x00, 0x52, 0x10, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74,
-	0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x12, 0x35, 0x0a, 0x09, 0x61, 0x75, 0x74, 0x68,
-	0x45, 0x76, 0x65, 0x6e, 0x74, 0x18, 0x11, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x67, 0x64,
-	0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x41, 0x75, 0x74, 0x68, 0x45, 0x76, 0x65,
-	0x6e, 0x74, 0x48, 0x00, 0x52, 0x09, 0x61, 0x75, 0x74, 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x12,
-	0x4a, 0x0a, 0x10, 0x72, 0x65, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d,
-	0x6f, 0x64, 0x65, 0x18, 0x12, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1c, 0x2e, 0x67, 0x64, 0x6d, 0x2e,
-	0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x52, 0x65, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x41,
-	0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x48, 0x00, 0x52, 0x10, 0x72, 0x65, 0x73, 0x65, 0x6c,
-	0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x12, 0x53, 0x0a, 0x13, 0x73,
-	0x74, 0x61, 0x72, 0x74, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x18, 0x13, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x1f, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45,
-	0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x53, 0x74, 0x61, 0x72, 0x74, 0x41, 0x75, 0x74, 0x68, 0x65,
-	0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x48, 0x00, 0x52, 0x13, 0x73, 0x74, 0x61,
-	0x72, 0x74, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x12, 0x3e, 0x0a, 0x0c, 0x75, 0x73, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64,
-	0x18, 0x14, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x18, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65,
-	0x6e, 0x74, 0x73, 0x2e, 0x55, 0x73, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64,
-	0x48, 0x00, 0x52, 0x0c, 0x75, 0x73, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64,
-	0x42, 0x06, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61, 0x2a, 0x76, 0x0a, 0x08, 0x44, 0x61, 0x74, 0x61,
-	0x54, 0x79, 0x70, 0x65, 0x12, 0x0f, 0x0a, 0x0b, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x54,
-	0x79, 0x70, 0x65, 0x10, 0x00, 0x12, 0x09, 0x0a, 0x05, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x10, 0x01,
-	0x12, 0x09, 0x0a, 0x05, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x10, 0x02, 0x12, 0x0c, 0x0a, 0x08, 0x65,
-	0x76, 0x65, 0x6e, 0x74, 0x41, 0x63, 0x6b, 0x10, 0x03, 0x12, 0x0b, 0x0a, 0x07, 0x72, 0x65, 0x71,
-	0x75, 0x65, 0x73, 0x74, 0x10, 0x04, 0x12, 0x0c, 0x0a, 0x08, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e,
-	0x73, 0x65, 0x10, 0x05, 0x12, 0x08, 0x0a, 0x04, 0x70, 0x6f, 0x6c, 0x6c, 0x10, 0x06, 0x12, 0x10,
-	0x0a, 0x0c, 0x70, 0x6f, 0x6c, 0x6c, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x10, 0x07,
-	0x2a, 0x82, 0x01, 0x0a, 0x0b, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x54, 0x79, 0x70, 0x65,
-	0x12, 0x12, 0x0a, 0x0e, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x52, 0x65, 0x71, 0x75, 0x65,
-	0x73, 0x74, 0x10, 0x00, 0x12, 0x15, 0x0a, 0x11, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x42, 0x72,
-	0x6f, 0x6b, 0x65, 0x72, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x10, 0x01, 0x12, 0x1d, 0x0a, 0x19, 0x63,
-	0x6f, 0x6d, 0x70, 0x6f, 0x73, 0x65, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61,
-	0x74, 0x69, 0x6f, 0x6e, 0x56, 0x69, 0x65, 0x77, 0x10, 0x02, 0x12, 0x18, 0x0a, 0x14, 0x75, 0x69,
-	0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69,
-	0x65, 0x73, 0x10, 0x03, 0x12, 0x0f, 0x0a, 0x0b, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x74,
-	0x61, 0x67, 0x65, 0x10, 0x04, 0x2a, 0x89, 0x02, 0x0a, 0x09, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x54,
-	0x79, 0x70, 0x65, 0x12, 0x10, 0x0a, 0x0c, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x45, 0x76,
-	0x65, 0x6e, 0x74, 0x10, 0x00, 0x12, 0x10, 0x0a, 0x0c, 0x75, 0x73, 0x65, 0x72, 0x53, 0x65, 0x6c,
-	0x65, 0x63, 0x74, 0x65, 0x64, 0x10, 0x01, 0x12, 0x13, 0x0a, 0x0f, 0x62, 0x72, 0x6f, 0x6b, 0x65,
-	0x72, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x10, 0x02, 0x12, 0x12, 0x0a, 0x0e,
-	0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x10, 0x03,
-	0x12, 0x15, 0x0a, 0x11, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63,
-	0x65, 0x69, 0x76, 0x65, 0x64, 0x10, 0x04, 0x12, 0x14, 0x0a, 0x10, 0x61, 0x75, 0x74, 0x68, 0x4d,
-	0x6f, 0x64, 0x65, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x10, 0x05, 0x12, 0x14, 0x0a,
-	0x10, 0x72, 0x65, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64,
-	0x65, 0x10, 0x06, 0x12, 0x0d, 0x0a, 0x09, 0x61, 0x75, 0x74, 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74,
-	0x10, 0x07, 0x12, 0x14, 0x0a, 0x10, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x65,
-	0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x10, 0x08, 0x12, 0x17, 0x0a, 0x13, 0x73, 0x74, 0x61, 0x72,
-	0x74, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x10,
-	0x09, 0x12, 0x1c, 0x0a, 0x18, 0x69, 0x73, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63,
-	0x61, 0x74, 0x65, 0x64, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x10, 0x0a, 0x12,
-	0x10, 0x0a, 0x0c, 0x73, 0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x10,
-	0x0b, 0x42, 0x21, 0x5a, 0x1f, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f,
-	0x75, 0x62, 0x75, 0x6e, 0x74, 0x75, 0x2f, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2f, 0x70, 0x61, 0x6d,
-	0x2f, 0x67, 0x64, 0x6d, 0x62, 0x06, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
+	0x12, 0x35, 0x0a, 0x09, 0x61, 0x75, 0x74, 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x18, 0x11, 0x20,
+	0x01, 0x28, 0x0b, 0x32, 0x15, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
+	0x2e, 0x41, 0x75, 0x74, 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x48, 0x00, 0x52, 0x09, 0x61, 0x75,
+	0x74, 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x12, 0x4a, 0x0a, 0x10, 0x72, 0x65, 0x73, 0x65, 0x6c,
+	0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x18, 0x12, 0x20, 0x01, 0x28,
+	0x0b, 0x32, 0x1c, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x52,
+	0x65, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x48,
+	0x00, 0x52, 0x10, 0x72, 0x65, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d,
+	0x6f, 0x64, 0x65, 0x12, 0x53, 0x0a, 0x13, 0x73, 0x74, 0x61, 0x72, 0x74, 0x41, 0x75, 0x74, 0x68,
+	0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18, 0x13, 0x20, 0x01, 0x28, 0x0b,
+	0x32, 0x1f, 0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x53, 0x74,
+	0x61, 0x72, 0x74, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
+	0x6e, 0x48, 0x00, 0x52, 0x13, 0x73, 0x74, 0x61, 0x72, 0x74, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e,
+	0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x3e, 0x0a, 0x0c, 0x75, 0x73, 0x65, 0x72,
+	0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x18, 0x14, 0x20, 0x01, 0x28, 0x0b, 0x32, 0x18,
+	0x2e, 0x67, 0x64, 0x6d, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x55, 0x73, 0x65, 0x72,
+	0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x48, 0x00, 0x52, 0x0c, 0x75, 0x73, 0x65, 0x72,
+	0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x42, 0x06, 0x0a, 0x04, 0x64, 0x61, 0x74, 0x61,
+	0x2a, 0x89, 0x01, 0x0a, 0x08, 0x44, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x12, 0x0f, 0x0a,
+	0x0b, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x10, 0x00, 0x12, 0x09,
+	0x0a, 0x05, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x10, 0x01, 0x12, 0x09, 0x0a, 0x05, 0x65, 0x76, 0x65,
+	0x6e, 0x74, 0x10, 0x02, 0x12, 0x0c, 0x0a, 0x08, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x41, 0x63, 0x6b,
+	0x10, 0x03, 0x12, 0x0b, 0x0a, 0x07, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x10, 0x04, 0x12,
+	0x0c, 0x0a, 0x08, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x10, 0x05, 0x12, 0x08, 0x0a,
+	0x04, 0x70, 0x6f, 0x6c, 0x6c, 0x10, 0x06, 0x12, 0x10, 0x0a, 0x0c, 0x70, 0x6f, 0x6c, 0x6c, 0x52,
+	0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x10, 0x07, 0x12, 0x11, 0x0a, 0x0d, 0x77, 0x61, 0x69,
+	0x74, 0x46, 0x6f, 0x72, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x10, 0x08, 0x2a, 0x82, 0x01, 0x0a,
+	0x0b, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x54, 0x79, 0x70, 0x65, 0x12, 0x12, 0x0a, 0x0e,
+	0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x10, 0x00,
+	0x12, 0x15, 0x0a, 0x11, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x72,
+	0x73, 0x4c, 0x69, 0x73, 0x74, 0x10, 0x01, 0x12, 0x1d, 0x0a, 0x19, 0x63, 0x6f, 0x6d, 0x70, 0x6f,
+	0x73, 0x65, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+	0x56, 0x69, 0x65, 0x77, 0x10, 0x02, 0x12, 0x18, 0x0a, 0x14, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f,
+	0x75, 0x74, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x10, 0x03,
+	0x12, 0x0f, 0x0a, 0x0b, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x74, 0x61, 0x67, 0x65, 0x10,
+	0x04, 0x2a, 0x89, 0x02, 0x0a, 0x09, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x54, 0x79, 0x70, 0x65, 0x12,
+	0x10, 0x0a, 0x0c, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x10,
+	0x00, 0x12, 0x10, 0x0a, 0x0c, 0x75, 0x73, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65,
+	0x64, 0x10, 0x01, 0x12, 0x13, 0x0a, 0x0f, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x72, 0x73, 0x52, 0x65,
+	0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x10, 0x02, 0x12, 0x12, 0x0a, 0x0e, 0x62, 0x72, 0x6f, 0x6b,
+	0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x10, 0x03, 0x12, 0x15, 0x0a, 0x11,
+	0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65,
+	0x64, 0x10, 0x04, 0x12, 0x14, 0x0a, 0x10, 0x61, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x53,
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x10, 0x05, 0x12, 0x14, 0x0a, 0x10, 0x72, 0x65, 0x73,
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x41, 0x75, 0x74, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x10, 0x06, 0x12,
+	0x0d, 0x0a, 0x09, 0x61, 0x75, 0x74, 0x68, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x10, 0x07, 0x12, 0x14,
+	0x0a, 0x10, 0x75, 0x69, 0x4c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76,
+	0x65, 0x64, 0x10, 0x08, 0x12, 0x17, 0x0a, 0x13, 0x73, 0x74, 0x61, 0x72, 0x74, 0x41, 0x75, 0x74,
+	0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x10, 0x09, 0x12, 0x1c, 0x0a,
+	0x18, 0x69, 0x73, 0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64,
+	0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x10, 0x0a, 0x12, 0x10, 0x0a, 0x0c, 0x73,
+	0x74, 0x61, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x10, 0x0b, 0x42, 0x21, 0x5a,
+	0x1f, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x75, 0x62, 0x75, 0x6e,
+	0x74, 0x75, 0x2f, 0x61, 0x75, 0x74, 0x68, 0x64, 0x2f, 0x70, 0x61, 0x6d, 0x2f, 0x67, 0x64, 0x6d,
+	0x62, 0x06, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
 }
 
 var (
@@ -1769,74 +1840,76 @@ func file_gdm_proto_rawDescGZIP() []byte {
 }
 
 var file_gdm_proto_enumTypes = make([]protoimpl.EnumInfo, 3)
-var file_gdm_proto_msgTypes = make([]protoimpl.MessageInfo, 23)
+var file_gdm_proto_msgTypes = make([]protoimpl.MessageInfo, 24)
 var file_gdm_proto_goTypes = []interface{}{
 	(DataType)(0),                                // 0: gdm.DataType
 	(RequestType)(0),                             // 1: gdm.RequestType
 	(EventType)(0),                               // 2: gdm.EventType
 	(*Data)(nil),                                 // 3: gdm.Data
 	(*HelloData)(nil),                            // 4: gdm.HelloData
-	(*Requests)(nil),                             // 5: gdm.Requests
-	(*RequestData)(nil),                          // 6: gdm.RequestData
-	(*Responses)(nil),                            // 7: gdm.Responses
-	(*ResponseData)(nil),                         // 8: gdm.ResponseData
-	(*Events)(nil),                               // 9: gdm.Events
-	(*EventData)(nil),                            // 10: gdm.EventData
-	(*Requests_UiLayoutCapabilities)(nil),        // 11: gdm.Requests.UiLayoutCapabilities
-	(*Requests_ChangeStage)(nil),                 // 12: gdm.Requests.ChangeStage
-	(*Responses_Ack)(nil),                        // 13: gdm.Responses.Ack
-	(*Responses_UiLayoutCapabilities)(nil),       // 14: gdm.Responses.UiLayoutCapabilities
-	(*Events_BrokersReceived)(nil),               // 15: gdm.Events.BrokersReceived
-	(*Events_BrokerSelected)(nil),                // 16: gdm.Events.BrokerSelected
-	(*Events_UserSelected)(nil),                  // 17: gdm.Events.UserSelected
-	(*Events_StartAuthentication)(nil),           // 18: gdm.Events.StartAuthentication
-	(*Events_AuthModesReceived)(nil),             // 19: gdm.Events.AuthModesReceived
-	(*Events_AuthModeSelected)(nil),              // 20: gdm.Events.AuthModeSelected
-	(*Events_AuthEvent)(nil),                     // 21: gdm.Events.AuthEvent
-	(*Events_ReselectAuthMode)(nil),              // 22: gdm.Events.ReselectAuthMode
-	(*Events_IsAuthenticatedRequested)(nil),      // 23: gdm.Events.IsAuthenticatedRequested
-	(*Events_StageChanged)(nil),                  // 24: gdm.Events.StageChanged
-	(*Events_UiLayoutReceived)(nil),              // 25: gdm.Events.UiLayoutReceived
-	(*authd.UILayout)(nil),                       // 26: authd.UILayout
-	(*authd.ABResponse_BrokerInfo)(nil),          // 27: authd.ABResponse.BrokerInfo
-	(*authd.GAMResponse_AuthenticationMode)(nil), // 28: authd.GAMResponse.AuthenticationMode
-	(*authd.IAResponse)(nil),                     // 29: authd.IAResponse
+	(*WaitForEventsData)(nil),                    // 5: gdm.WaitForEventsData
+	(*Requests)(nil),                             // 6: gdm.Requests
+	(*RequestData)(nil),                          // 7: gdm.RequestData
+	(*Responses)(nil),                            // 8: gdm.Responses
+	(*ResponseData)(nil),                         // 9: gdm.ResponseData
+	(*Events)(nil),                               // 10: gdm.Events
+	(*EventData)(nil),                            // 11: gdm.EventData
+	(*Requests_UiLayoutCapabilities)(nil),        // 12: gdm.Requests.UiLayoutCapabilities
+	(*Requests_ChangeStage)(nil),                 // 13: gdm.Requests.ChangeStage
+	(*Responses_Ack)(nil),                        // 14: gdm.Responses.Ack
+	(*Responses_UiLayoutCapabilities)(nil),       // 15: gdm.Responses.UiLayoutCapabilities
+	(*Events_BrokersReceived)(nil),               // 16: gdm.Events.BrokersReceived
+	(*Events_BrokerSelected)(nil),                // 17: gdm.Events.BrokerSelected
+	(*Events_UserSelected)(nil),                  // 18: gdm.Events.UserSelected
+	(*Events_StartAuthentication)(nil),           // 19: gdm.Events.StartAuthentication
+	(*Events_AuthModesReceived)(nil),             // 20: gdm.Events.AuthModesReceived
+	(*Events_AuthModeSelected)(nil),              // 21: gdm.Events.AuthModeSelected
+	(*Events_AuthEvent)(nil),                     // 22: gdm.Events.AuthEvent
+	(*Events_ReselectAuthMode)(nil),              // 23: gdm.Events.ReselectAuthMode
+	(*Events_IsAuthenticatedRequested)(nil),      // 24: gdm.Events.IsAuthenticatedRequested
+	(*Events_StageChanged)(nil),                  // 25: gdm.Events.StageChanged
+	(*Events_UiLayoutReceived)(nil),              // 26: gdm.Events.UiLayoutReceived
+	(*authd.UILayout)(nil),                       // 27: authd.UILayout
+	(*authd.ABResponse_BrokerInfo)(nil),          // 28: authd.ABResponse.BrokerInfo
+	(*authd.GAMResponse_AuthenticationMode)(nil), // 29: authd.GAMResponse.AuthenticationMode
+	(*authd.IAResponse)(nil),                     // 30: authd.IAResponse
 }
 var file_gdm_proto_depIdxs = []int32{
 	0,  // 0: gdm.Data.type:type_name -> gdm.DataType
 	4,  // 1: gdm.Data.hello:type_name -> gdm.HelloData
-	6,  // 2: gdm.Data.request:type_name -> gdm.RequestData
-	8,  // 3: gdm.Data.response:type_name -> gdm.ResponseData
-	10, // 4: gdm.Data.event:type_name -> gdm.EventData
-	10, // 5: gdm.Data.pollResponse:type_name -> gdm.EventData
-	1,  // 6: gdm.RequestData.type:type_name -> gdm.RequestType
-	11, // 7: gdm.RequestData.uiLayoutCapabilities:type_name -> gdm.Requests.UiLayoutCapabilities
-	12, // 8: gdm.RequestData.changeStage:type_name -> gdm.Requests.ChangeStage
-	1,  // 9: gdm.ResponseData.type:type_name -> gdm.RequestType
-	13, // 10: gdm.ResponseData.ack:type_name -> gdm.Responses.Ack
-	14, // 11: gdm.ResponseData.uiLayoutCapabilities:type_name -> gdm.Responses.UiLayoutCapabilities
-	2,  // 12: gdm.EventData.type:type_name -> gdm.EventType
-	15, // 13: gdm.EventData.brokersReceived:type_name -> gdm.Events.BrokersReceived
-	16, // 14: gdm.EventData.brokerSelected:type_name -> gdm.Events.BrokerSelected
-	19, // 15: gdm.EventData.authModesReceived:type_name -> gdm.Events.AuthModesReceived
-	20, // 16: gdm.EventData.authModeSelected:type_name -> gdm.Events.AuthModeSelected
-	23, // 17: gdm.EventData.isAuthenticatedRequested:type_name -> gdm.Events.IsAuthenticatedRequested
-	24, // 18: gdm.EventData.stageChanged:type_name -> gdm.Events.StageChanged
-	25, // 19: gdm.EventData.uiLayoutReceived:type_name -> gdm.Events.UiLayoutReceived
-	21, // 20: gdm.EventData.authEvent:type_name -> gdm.Events.AuthEvent
-	22, // 21: gdm.EventData.reselectAuthMode:type_name -> gdm.Events.ReselectAuthMode
-	18, // 22: gdm.EventData.startAuthentication:type_name -> gdm.Events.StartAuthentication
-	17, // 23: gdm.EventData.userSelected:type_name -> gdm.Events.UserSelected
-	26, // 24: gdm.Responses.UiLayoutCapabilities.supportedUiLayouts:type_name -> authd.UILayout
-	27, // 25: gdm.Events.BrokersReceived.brokersInfos:type_name -> authd.ABResponse.BrokerInfo
-	28, // 26: gdm.Events.AuthModesReceived.authModes:type_name -> authd.GAMResponse.AuthenticationMode
-	29, // 27: gdm.Events.AuthEvent.response:type_name -> authd.IAResponse
-	26, // 28: gdm.Events.UiLayoutReceived.uiLayout:type_name -> authd.UILayout
-	29, // [29:29] is the sub-list for method output_type
-	29, // [29:29] is the sub-list for method input_type
-	29, // [29:29] is the sub-list for extension type_name
-	29, // [29:29] is the sub-list for extension extendee
-	0,  // [0:29] is the sub-list for field type_name
+	7,  // 2: gdm.Data.request:type_name -> gdm.RequestData
+	9,  // 3: gdm.Data.response:type_name -> gdm.ResponseData
+	11, // 4: gdm.Data.event:type_name -> gdm.EventData
+	11, // 5: gdm.Data.pollResponse:type_name -> gdm.EventData
+	5,  // 6: gdm.Data.waitForEvents:type_name -> gdm.WaitForEventsData
+	1,  // 7: gdm.RequestData.type:type_name -> gdm.RequestType
+	12, // 8: gdm.RequestData.uiLayoutCapabilities:type_name -> gdm.Requests.UiLayoutCapabilities
+	13, // 9: gdm.RequestData.changeStage:type_name -> gdm.Requests.ChangeStage
+	1,  // 10: gdm.ResponseData.type:type_name -> gdm.RequestType
+	14, // 11: gdm.ResponseData.ack:type_name -> gdm.Responses.Ack
+	15, // 12: gdm.ResponseData.uiLayoutCapabilities:type_name -> gdm.Responses.UiLayoutCapabilities
+	2,  // 13: gdm.EventData.type:type_name -> gdm.EventType
+	16, // 14: gdm.EventData.brokersReceived:type_name -> gdm.Events.BrokersReceived
+	17, // 15: gdm.EventData.brokerSelected:type_name -> gdm.Events.BrokerSelected
+	20, // 16: gdm.EventData.authModesReceived:type_name -> gdm.Events.AuthModesReceived
+	21, // 17: gdm.EventData.authModeSelected:type_name -> gdm.Events.AuthModeSelected
+	24, // 18: gdm.EventData.isAuthenticatedRequested:type_name -> gdm.Events.IsAuthenticatedRequested
+	25, // 19: gdm.EventData.stageChanged:type_name -> gdm.Events.StageChanged
+	26, // 20: gdm.EventData.uiLayoutReceived:type_name -> gdm.Events.UiLayoutReceived
+	22, // 21: gdm.EventData.authEvent:type_name -> gdm.Events.AuthEvent
+	23, // 22: gdm.EventData.reselectAuthMode:type_name -> gdm.Events.ReselectAuthMode
+	19, // 23: gdm.EventData.startAuthentication:type_name -> gdm.Events.StartAuthentication
+	18, // 24: gdm.EventData.userSelected:type_name -> gdm.Events.UserSelected
+	27, // 25: gdm.Responses.UiLayoutCapabilities.supportedUiLayouts:type_name -> authd.UILayout
+	28, // 26: gdm.Events.BrokersReceived.brokersInfos:type_name -> authd.ABResponse.BrokerInfo
+	29, // 27: gdm.Events.AuthModesReceived.authModes:type_name -> authd.GAMResponse.AuthenticationMode
+	30, // 28: gdm.Events.AuthEvent.response:type_name -> authd.IAResponse
+	27, // 29: gdm.Events.UiLayoutReceived.uiLayout:type_name -> authd.UILayout
+	30, // [30:30] is the sub-list for method output_type
+	30, // [30:30] is the sub-list for method input_type
+	30, // [30:30] is the sub-list for extension type_name
+	30, // [30:30] is the sub-list for extension extendee
+	0,  // [0:30] is the sub-list for field type_name
 }
 
 func init() { file_gdm_proto_init() }
@@ -1870,7 +1943,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[2].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Requests); i {
+			switch v := v.(*WaitForEventsData); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1882,7 +1955,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[3].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*RequestData); i {
+			switch v := v.(*Requests); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1894,7 +1967,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[4].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Responses); i {
+			switch v := v.(*RequestData); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1906,7 +1979,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[5].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*ResponseData); i {
+			switch v := v.(*Responses); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1918,7 +1991,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[6].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events); i {
+			switch v := v.(*ResponseData); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1930,7 +2003,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[7].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*EventData); i {
+			switch v := v.(*Events); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1942,7 +2015,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[8].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Requests_UiLayoutCapabilities); i {
+			switch v := v.(*EventData); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1954,7 +2027,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[9].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Requests_ChangeStage); i {
+			switch v := v.(*Requests_UiLayoutCapabilities); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1966,7 +2039,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[10].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Responses_Ack); i {
+			switch v := v.(*Requests_ChangeStage); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1978,7 +2051,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[11].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Responses_UiLayoutCapabilities); i {
+			switch v := v.(*Responses_Ack); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -1990,7 +2063,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[12].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_BrokersReceived); i {
+			switch v := v.(*Responses_UiLayoutCapabilities); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2002,7 +2075,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[13].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_BrokerSelected); i {
+			switch v := v.(*Events_BrokersReceived); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2014,7 +2087,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[14].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_UserSelected); i {
+			switch v := v.(*Events_BrokerSelected); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2026,7 +2099,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[15].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_StartAuthentication); i {
+			switch v := v.(*Events_UserSelected); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2038,7 +2111,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[16].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_AuthModesReceived); i {
+			switch v := v.(*Events_StartAuthentication); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2050,7 +2123,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[17].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_AuthModeSelected); i {
+			switch v := v.(*Events_AuthModesReceived); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2062,7 +2135,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[18].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_AuthEvent); i {
+			switch v := v.(*Events_AuthModeSelected); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2074,7 +2147,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[19].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_ReselectAuthMode); i {
+			switch v := v.(*Events_AuthEvent); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2086,7 +2159,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[20].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_IsAuthenticatedRequested); i {
+			switch v := v.(*Events_ReselectAuthMode); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2098,7 +2171,7 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[21].Exporter = func(v interface{}, i int) interface{} {
-			switch v := v.(*Events_StageChanged); i {
+			switch v := v.(*Events_IsAuthenticatedRequested); i {
 			case 0:
 				return &v.state
 			case 1:
@@ -2110,6 +2183,18 @@ func file_gdm_proto_init() {
 			}
 		}
 		file_gdm_proto_msgTypes[22].Exporter = func(v interface{}, i int) interface{} {
+			switch v := v.(*Events_StageChanged); i {
+			case 0:
+				return &v.state
+			case 1:
+				return &v.sizeCache
+			case 2:
+				return &v.unknownFields
+			default:
+				return nil
+			}
+		}
+		file_gdm_proto_msgTypes[23].Exporter = func(v interface{}, i int) interface{} {
 			switch v := v.(*Events_UiLayoutReceived); i {
 			case 0:
 				return &v.state
@@ -2123,15 +2208,15 @@ func file_gdm_proto_init() {
 		}
 	}
 	file_gdm_proto_msgTypes[0].OneofWrappers = []interface{}{}
-	file_gdm_proto_msgTypes[3].OneofWrappers = []interface{}{
+	file_gdm_proto_msgTypes[4].OneofWrappers = []interface{}{
 		(*RequestData_UiLayoutCapabilities)(nil),
 		(*RequestData_ChangeStage)(nil),
 	}
-	file_gdm_proto_msgTypes[5].OneofWrappers = []interface{}{
+	file_gdm_proto_msgTypes[6].OneofWrappers = []interface{}{
 		(*ResponseData_Ack)(nil),
 		(*ResponseData_UiLayoutCapabilities)(nil),
 	}
-	file_gdm_proto_msgTypes[7].OneofWrappers = []interface{}{
+	file_gdm_proto_msgTypes[8].OneofWrappers = []interface{}{
 		(*EventData_BrokersReceived)(nil),
 		(*EventData_BrokerSelected)(nil),
 		(*EventData_AuthModesReceived)(nil),
@@ -2144,14 +2229,14 @@ func file_gdm_proto_init() {
 		(*EventData_StartAuthentication)(nil),
 		(*EventData_UserSelected)(nil),
 	}
-	file_gdm_proto_msgTypes[20].OneofWrappers = []interface{}{}
+	file_gdm_proto_msgTypes[21].OneofWrappers = []interface{}{}
 	type x struct{}
 	out := protoimpl.TypeBuilder{
 		File: protoimpl.DescBuilder{
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: file_gdm_proto_rawDesc,
 			NumEnums:      3,
-			NumMessages:   23,
+			NumMessages:   24,
 			NumExtensions: 0,
 			NumServices:   0,
 		},
@@ -13,8 +13,15 @@ import (
 )
 
 const (
-	// ProtoVersion is the version of the JSON protocol.
-	ProtoVersion = uint32(1)
+	// ProtoVersion is the latest version of the JSON protocol we support,
+	// the version actually used is negotiated with GDM on hello.
+	ProtoVersion = uint32(2)
+	// BatchProtoVersion is the first version of the JSON protocol supporting
+	// batches of values in a single conversation.
+	BatchProtoVersion = uint32(2)
+	// WaitForEventsProtoVersion is the first version of the JSON protocol
+	// supporting the waitForEvents requests.
+	WaitForEventsProtoVersion = uint32(2)
 )
 
 // Request is an interface implementing all the gdm requests.
@@ -136,6 +143,17 @@ func (d *Data) Check() error {
 			return err
 		}
 
+	case DataType_waitForEvents:
+		if d.WaitForEvents == nil {
+			return errors.New("missing wait for events data")
+		}
+		if d.WaitForEvents.TimeoutMs == 0 {
+			return errors.New("missing wait for events timeout")
+		}
+		if err := checkMembersFunc(d, []string{"WaitForEvents"}); err != nil {
+			return err
+		}
+
 	case DataType_pollResponse:
 		if err := checkMembersFunc(d, []string{"PollResponse"}); err != nil {
 			return err
@@ -128,6 +128,14 @@ func TestGdmStructsMarshal(t *testing.T) {
 
 			wantJSON: `{"type":"poll"}`,
 		},
+		"WaitForEvents packet": {
+			gdmData: &gdm.Data{
+				Type:          gdm.DataType_waitForEvents,
+				WaitForEvents: &gdm.WaitForEventsData{TimeoutMs: 5000},
+			},
+
+			wantJSON: `{"type":"waitForEvents","waitForEvents":{"timeoutMs":5000}}`,
+		},
 		"PollResponse packet": {
 			gdmData: &gdm.Data{
 				Type: gdm.DataType_pollResponse,
@@ -308,6 +316,28 @@ func TestGdmStructsMarshal(t *testing.T) {
 
 			wantErrMsg: "field Request should not be defined",
 		},
+		"Error waitForEvents packet with missing data": {
+			gdmData: &gdm.Data{Type: gdm.DataType_waitForEvents},
+
+			wantErrMsg: "missing wait for events data",
+		},
+		"Error waitForEvents packet with missing timeout": {
+			gdmData: &gdm.Data{
+				Type:          gdm.DataType_waitForEvents,
+				WaitForEvents: &gdm.WaitForEventsData{},
+			},
+
+			wantErrMsg: "missing wait for events timeout",
+		},
+		"Error waitForEvents packet with unexpected data": {
+			gdmData: &gdm.Data{
+				Type:          gdm.DataType_waitForEvents,
+				WaitForEvents: &gdm.WaitForEventsData{TimeoutMs: 1},
+				Request:       &gdm.RequestData{},
+			},
+
+			wantErrMsg: "field Request should not be defined",
+		},
 		"Error pollResponse packet with missing event type": {
 			gdmData: &gdm.Data{
 				Type: gdm.DataType_pollResponse,
@@ -461,6 +491,14 @@ func TestGdmStructsUnMarshal(t *testing.T) {
 
 			wantData: &gdm.Data{Type: gdm.DataType_poll},
 		},
+		"WaitForEvents packet": {
+			JSON: `{"type":"waitForEvents","waitForEvents":{"timeoutMs":100}}`,
+
+			wantData: &gdm.Data{
+				Type:          gdm.DataType_waitForEvents,
+				WaitForEvents: &gdm.WaitForEventsData{TimeoutMs: 100},
+			},
+		},
 		"PollResponse packet": {
 			JSON: `{"type":"pollResponse","pollResponse":` +
 				`[{"type":"brokerSelected","brokerSelected":{"brokerId":"a broker"}}]}`,
@@ -582,6 +620,16 @@ func TestGdmStructsUnMarshal(t *testing.T) {
 
 			wantErrMsg: "field Response should not be defined",
 		},
+		"Error waitForEvents packet with missing data": {
+			JSON: `{"type":"waitForEvents"}`,
+
+			wantErrMsg: "missing wait for events data",
+		},
+		"Error waitForEvents packet with missing timeout": {
+			JSON: `{"type":"waitForEvents","waitForEvents":{}}`,
+
+			wantErrMsg: "missing wait for events timeout",
+		},
 		"Error pollResponse packet with missing event type": {
 			JSON: `{"type":"pollResponse","pollResponse":` +
 				`[{"type":"brokerSelected","brokerSelected":{"brokerId":"a broker"}},` +
@@ -21,7 +21,7 @@ fi
 
 ${CC:-cc} -o go-loader/"$loader_libname" \
     go-loader/module.c ${CFLAGS:-} -Wl,--as-needed -Wl,--allow-shlib-undefined \
-    -shared -fPIC -Wl,--unresolved-symbols=report-all \
+    -shared -fPIC -pthread -Wl,--unresolved-symbols=report-all -Wl,-z,nodelete \
     -Wl,-soname,"$loader_libname" -lpam ${LDFLAGS:-} "${cc_args[@]}"
 
 chmod 644 go-loader/"$loader_libname"
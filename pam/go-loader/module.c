@@ -22,11 +22,17 @@
 
 #include <dlfcn.h>
 #include <limits.h>
+#include <pthread.h>
 #include <security/pam_modules.h>
 #include <security/pam_ext.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <syslog.h>
+#include <time.h>
+#include <unistd.h>
 
 #ifndef AUTHD_PAM_MODULES_PATH
 #  if defined(__x86_64__) && defined(__gnu_linux__)
@@ -37,6 +43,11 @@
 #  endif
 #endif
 
+/* Benchmarks build the loader with AUTHD_PAM_GO_LOADER_REPORT_LOAD_TIME
+ * defined, so that the time it took to get the module ready for a PAM handle
+ * is exposed to the application in the PAM environment, in microseconds. */
+#define AUTHD_PAM_GO_LOADER_LOAD_TIME_ENV "AUTHD_PAM_GO_LOADER_LOAD_TIME_US"
+
 /* When a Go shared library is loaded from C, go starts various goroutine
  * (as init() at first) and if the loading code is then performing a fork
  * we end up having an undefined behavior and very likely, deadlocks.
@@ -55,53 +66,370 @@ typedef int (*PamHandler)(pam_handle_t *,
                           int          argc,
                           const char **argv);
 
+/* By default the go module is loaded for each PAM handle and unloaded once
+ * the handle is released. Long-lived applications (such as cron or sshd
+ * when not forking per connection) can use the "keep-loaded" loader option
+ * to keep it in a process-wide table instead, so that it is only loaded once.
+ *
+ * The keep-loaded option is only meant for applications that do not fork
+ * after having loaded the module. As per the fork constraint explained above,
+ * a module loaded in a parent process is not usable in its children, and it
+ * can't be loaded again there either: go shared objects can't be unloaded
+ * (they are linked with -z nodelete), so dlopen would return the inherited
+ * runtime, whose threads did not survive the fork. So we record the pid of
+ * the loader and we refuse to use the module from a different process.
+ *
+ * libpam unloads this loader once a PAM handle is released, so that the table
+ * would be lost with it: the loader is linked with -z nodelete, so that its
+ * state survives across the handles of the process. The kept modules are
+ * also never cleaned up, so that what they initialized (such as the
+ * connection to authd) is reused by the next handles.
+ */
+typedef struct
+{
+  PamHandler authenticate;
+  PamHandler setcred;
+  PamHandler acct_mgmt;
+  PamHandler open_session;
+  PamHandler close_session;
+  PamHandler chauthtok;
+} GoModuleVTable;
+
+static const struct
+{
+  const char *symbol;
+  size_t      offset;
+} go_module_vtable_symbols[] = {
+  { "pam_sm_authenticate", offsetof (GoModuleVTable, authenticate) },
+  { "pam_sm_setcred", offsetof (GoModuleVTable, setcred) },
+  { "pam_sm_acct_mgmt", offsetof (GoModuleVTable, acct_mgmt) },
+  { "pam_sm_open_session", offsetof (GoModuleVTable, open_session) },
+  { "pam_sm_close_session", offsetof (GoModuleVTable, close_session) },
+  { "pam_sm_chauthtok", offsetof (GoModuleVTable, chauthtok) },
+};
+
+typedef struct _GoModule GoModule;
+struct _GoModule
+{
+  GoModule      *next;
+  char          *path;
+  void          *handle;
+  GoModuleVTable vtable;
+  pid_t          pid;
+  bool           keep_loaded;
+};
+
+/* PAM data is shared by all the stacks (auth, account, session, password)
+ * of a PAM handle, so we keep there the list of the modules that have been
+ * loaded for it, in order to use the same instance for all the stages that
+ * are configured with the same sub-module. Since a sub-module can only be
+ * loaded once, all these stages must use the same loader options.
+ */
+typedef struct _GoModuleRef GoModuleRef;
+struct _GoModuleRef
+{
+  GoModuleRef *next;
+  GoModule    *module;
+  bool         keep_loaded;
+  char         sub_module[];
+};
+
+typedef struct
+{
+  GoModuleRef *refs;
+} GoHandleModules;
+
+static pthread_mutex_t loaded_modules_lock = PTHREAD_MUTEX_INITIALIZER;
+static GoModule *loaded_modules = NULL;
+
+/* Another thread of the application may hold the lock while it forks, so we
+ * take it around fork, to leave it in a consistent state in the child. */
 static void
-on_go_module_removed (pam_handle_t *pamh,
-                      void         *go_module,
-                      int           error_status)
+loaded_modules_lock_before_fork (void)
+{
+  pthread_mutex_lock (&loaded_modules_lock);
+}
+
+static void
+loaded_modules_unlock_after_fork (void)
+{
+  pthread_mutex_unlock (&loaded_modules_lock);
+}
+
+__attribute__((constructor)) static void
+register_fork_handlers (void)
+{
+  pthread_atfork (loaded_modules_lock_before_fork,
+                  loaded_modules_unlock_after_fork,
+                  loaded_modules_unlock_after_fork);
+}
+
+static void
+go_module_cleanup (GoModule *module)
 {
   void (*go_pam_cleanup) (void);
-  *(void **) (&go_pam_cleanup) = dlsym (go_module, "go_pam_cleanup_module");
+  *(void **) (&go_pam_cleanup) = dlsym (module->handle, "go_pam_cleanup_module");
   if (go_pam_cleanup)
     go_pam_cleanup ();
+}
 
-  dlclose (go_module);
+static void
+go_module_free (GoModule *module)
+{
+  free (module->path);
+  free (module);
 }
 
-static void *
-load_module (pam_handle_t *pamh,
-             const char   *module_path)
+static void
+go_module_release (GoModule *module)
 {
-  void *go_module;
+  /* Kept modules stay loaded and initialized for the next handles. */
+  if (module->keep_loaded)
+    return;
 
-  if (pam_get_data (pamh, "go-module", (const void **) &go_module) == PAM_SUCCESS)
-    return go_module;
+  go_module_cleanup (module);
+  dlclose (module->handle);
+  go_module_free (module);
+}
+
+static GoModule *
+go_module_new (const char *module_path,
+               bool        keep_loaded)
+{
+  GoModule *module;
+  void *handle;
 
-  go_module = dlopen (module_path, RTLD_LAZY);
-  if (!go_module)
+  handle = dlopen (module_path, RTLD_LAZY);
+  if (!handle)
     return NULL;
 
-  pam_set_data (pamh, "go-module", go_module, on_go_module_removed);
+  module = calloc (1, sizeof (GoModule));
+  if (!module)
+    {
+      dlclose (handle);
+      return NULL;
+    }
+
+  module->path = strdup (module_path);
+  if (!module->path)
+    {
+      dlclose (handle);
+      free (module);
+      return NULL;
+    }
+
+  module->handle = handle;
+  module->pid = getpid ();
+
+  /* Resolve all the PAM functions at once, so that we don't have to look
+   * them up on each call. */
+  for (size_t i = 0; i < sizeof (go_module_vtable_symbols) /
+                         sizeof (*go_module_vtable_symbols); i++)
+    {
+      void **func = (void **) ((char *) &module->vtable +
+                               go_module_vtable_symbols[i].offset);
+      *func = dlsym (handle, go_module_vtable_symbols[i].symbol);
+    }
+
+  module->keep_loaded = keep_loaded;
 
   void (*init_module) (void);
-  *(void **) (&init_module) = dlsym (go_module, "go_pam_init_module");
+  *(void **) (&init_module) = dlsym (handle, "go_pam_init_module");
   if (init_module)
     init_module ();
 
-  return go_module;
+  return module;
+}
+
+/* Must be called with loaded_modules_lock held. */
+static GoModule *
+lookup_loaded_module (const char *module_path)
+{
+  for (GoModule *module = loaded_modules; module; module = module->next)
+    {
+      if (strcmp (module->path, module_path) == 0)
+        return module;
+    }
+
+  return NULL;
+}
+
+static GoModule *
+load_kept_module (pam_handle_t *pamh,
+                  const char   *module_path)
+{
+  GoModule *module;
+
+  pthread_mutex_lock (&loaded_modules_lock);
+
+  module = lookup_loaded_module (module_path);
+  if (module && module->pid != getpid ())
+    {
+      /* We have been forked after the module was loaded: the go runtime
+       * threads did not survive it, and it can't be loaded again. */
+      pam_syslog (pamh, LOG_ERR,
+                  "Module %s was loaded before the application forked, "
+                  "keep-loaded can't be used by applications forking after loading it",
+                  module_path);
+      module = NULL;
+    }
+  else if (!module)
+    {
+      module = go_module_new (module_path, true);
+      if (module)
+        {
+          module->next = loaded_modules;
+          loaded_modules = module;
+        }
+    }
+
+  pthread_mutex_unlock (&loaded_modules_lock);
+
+  return module;
+}
+
+static void
+on_go_modules_removed (pam_handle_t *pamh,
+                       void         *data,
+                       int           error_status)
+{
+  GoHandleModules *handle_modules = data;
+  GoModuleRef *ref = handle_modules->refs;
+
+  while (ref)
+    {
+      GoModuleRef *next = ref->next;
+
+      go_module_release (ref->module);
+      free (ref);
+      ref = next;
+    }
+
+  free (handle_modules);
+}
+
+static GoHandleModules *
+get_handle_modules (pam_handle_t *pamh)
+{
+  GoHandleModules *handle_modules;
+
+  if (pam_get_data (pamh, "go-modules", (const void **) &handle_modules) == PAM_SUCCESS)
+    return handle_modules;
+
+  handle_modules = calloc (1, sizeof (GoHandleModules));
+  if (!handle_modules)
+    return NULL;
+
+  if (pam_set_data (pamh, "go-modules", handle_modules, on_go_modules_removed) != PAM_SUCCESS)
+    {
+      free (handle_modules);
+      return NULL;
+    }
+
+  return handle_modules;
+}
+
+static GoModule *
+load_module (pam_handle_t *pamh,
+             const char   *sub_module,
+             bool          keep_loaded)
+{
+  char module_path[PATH_MAX] = {0};
+  GoHandleModules *handle_modules;
+  GoModuleRef *ref;
+  GoModule *module;
+  size_t sub_module_len;
+
+  handle_modules = get_handle_modules (pamh);
+  if (!handle_modules)
+    {
+      pam_error (pamh, "Impossible to allocate the modules data");
+      return NULL;
+    }
+
+  for (ref = handle_modules->refs; ref; ref = ref->next)
+    {
+      if (strcmp (ref->sub_module, sub_module) != 0)
+        continue;
+
+      if (ref->keep_loaded != keep_loaded)
+        {
+          pam_error (pamh, "Module %s is already loaded with different loader options", sub_module);
+          return NULL;
+        }
+
+      return ref->module;
+    }
+
+  if (*sub_module == '/')
+    strncpy (module_path, sub_module, PATH_MAX - 1);
+  else
+    snprintf (module_path, PATH_MAX - 1, AUTHD_PAM_MODULES_PATH "/%s", sub_module);
+
+  sub_module_len = strlen (sub_module);
+  ref = malloc (sizeof (GoModuleRef) + sub_module_len + 1);
+  if (!ref)
+    {
+      pam_error (pamh, "Impossible to allocate the module data for %s", module_path);
+      return NULL;
+    }
+
+#ifdef AUTHD_PAM_GO_LOADER_REPORT_LOAD_TIME
+  struct timespec load_start, load_end;
+  clock_gettime (CLOCK_MONOTONIC, &load_start);
+#endif
+
+  if (keep_loaded)
+    module = load_kept_module (pamh, module_path);
+  else
+    module = go_module_new (module_path, false);
+
+#ifdef AUTHD_PAM_GO_LOADER_REPORT_LOAD_TIME
+  clock_gettime (CLOCK_MONOTONIC, &load_end);
+  char load_time[64];
+  snprintf (load_time, sizeof (load_time), AUTHD_PAM_GO_LOADER_LOAD_TIME_ENV "=%lld",
+            (long long) (load_end.tv_sec - load_start.tv_sec) * 1000000 +
+            (load_end.tv_nsec - load_start.tv_nsec) / 1000);
+  pam_putenv (pamh, load_time);
+#endif
+
+  if (!module)
+    {
+      pam_error (pamh, "Impossible to load module %s", module_path);
+      free (ref);
+      return NULL;
+    }
+
+  memcpy (ref->sub_module, sub_module, sub_module_len + 1);
+  ref->module = module;
+  ref->keep_loaded = keep_loaded;
+  ref->next = handle_modules->refs;
+  handle_modules->refs = ref;
+
+  return module;
 }
 
 static inline int
 call_pam_function (pam_handle_t *pamh,
                    const char   *function,
+                   size_t        vtable_offset,
                    int           flags,
                    int           argc,
                    const char  **argv)
 {
-  char module_path[PATH_MAX] = {0};
   const char *sub_module;
+  bool keep_loaded = false;
+  GoModule *module;
   PamHandler func;
-  void *go_module;
+
+  /* Loader options come before the module name, the rest is for the module */
+  for (; argc > 0 && argv[0]; argc--, argv++)
+    {
+      if (strcmp (argv[0], "keep-loaded") == 0)
+        keep_loaded = true;
+      else
+        break;
+    }
 
   if (argc < 1)
     {
@@ -119,22 +447,14 @@ call_pam_function (pam_handle_t *pamh,
       return PAM_MODULE_UNKNOWN;
     }
 
-  if (*sub_module == '/')
-    strncpy (module_path, sub_module, PATH_MAX - 1);
-  else
-    snprintf (module_path, PATH_MAX - 1, AUTHD_PAM_MODULES_PATH "/%s", sub_module);
-
-  go_module = load_module (pamh, module_path);
-  if (!go_module)
-    {
-      pam_error (pamh, "Impossible to load module %s", module_path);
-      return PAM_OPEN_ERR;
-    }
+  module = load_module (pamh, sub_module, keep_loaded);
+  if (!module)
+    return PAM_OPEN_ERR;
 
-  *(void **) (&func) = dlsym (go_module, function);
+  func = *(PamHandler *) ((char *) &module->vtable + vtable_offset);
   if (!func)
     {
-      pam_error (pamh, "Symbol %s not found in %s", function, module_path);
+      pam_error (pamh, "Symbol %s not found in %s", function, module->path);
       return PAM_OPEN_ERR;
     }
 
@@ -145,9 +465,12 @@ call_pam_function (pam_handle_t *pamh,
   PAM_EXTERN int \
     (pam_sm_ ## name) (pam_handle_t * pamh, int flags, int argc, const char **argv) \
   { \
-    return call_pam_function (pamh, "pam_sm_" #name, flags, argc, argv); \
+    return call_pam_function (pamh, "pam_sm_" #name, \
+                              offsetof (GoModuleVTable, name), \
+                              flags, argc, argv); \
   }
 
+DEFINE_PAM_WRAPPER (acct_mgmt)
 DEFINE_PAM_WRAPPER (authenticate)
 DEFINE_PAM_WRAPPER (chauthtok)
 DEFINE_PAM_WRAPPER (close_session)
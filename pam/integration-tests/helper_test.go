@@ -0,0 +1,172 @@
+package pam_test
+
+import (
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"runtime"
+	"strings"
+	"syscall"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+	"github.com/ubuntu/authd/internal/testutils"
+	"golang.org/x/sys/unix"
+)
+
+// pamServiceName is the name of the PAM service used by the benchmarks.
+const pamServiceName = "authd-bench"
+
+// buildArtifacts builds in dir the daemon with the example broker, the authd PAM module, the go-loader and the PAM
+// client of the benchmarks. The loader is built so that it reports the module load time.
+func buildArtifacts(b *testing.B, dir string) (daemon, module, loader, client string) {
+	b.Helper()
+
+	projectRoot := getProjectRoot()
+	daemon = filepath.Join(dir, "authd")
+	module = filepath.Join(dir, "pam_authd.so")
+	loader = filepath.Join(dir, "pam_go_loader.so")
+	client = filepath.Join(dir, "pamclient")
+
+	cmds := [][]string{
+		{"go", "build", "-tags", "withexamplebroker", "-o", daemon, "./cmd/authd"},
+		{"go", "build", "-ldflags=-extldflags -Wl,-soname,pam_authd.so", "-buildmode=c-shared", "-tags", "go_pam_module",
+			"-o", module, "./pam"},
+		{"go", "build", "-o", client, "./pam/integration-tests/pamclient"},
+		append(loaderBuildCommand(loader, dir), "-DAUTHD_PAM_GO_LOADER_REPORT_LOAD_TIME"),
+	}
+	for _, args := range cmds {
+		runBuildCommand(b, projectRoot, args)
+	}
+
+	return daemon, module, loader, client
+}
+
+// loaderBuildCommand returns the command building the go-loader as loader, loading the modules from modulesPath, as
+// pam/generate.sh does.
+func loaderBuildCommand(loader, modulesPath string) []string {
+	return []string{cc(), "-o", loader, "pam/go-loader/module.c", "-shared", "-fPIC", "-pthread", "-Wl,--as-needed",
+		"-Wl,--allow-shlib-undefined", "-Wl,--unresolved-symbols=report-all", "-Wl,-z,nodelete",
+		"-Wl,-soname,pam_go_loader.so", "-lpam", fmt.Sprintf("-DAUTHD_PAM_MODULES_PATH=%q", modulesPath)}
+}
+
+// runBuildCommand runs the build command args from the project root.
+func runBuildCommand(tb testing.TB, projectRoot string, args []string) {
+	tb.Helper()
+
+	// #nosec:G204 - we control the command arguments in tests
+	cmd := exec.Command(args[0], args[1:]...)
+	cmd.Dir = projectRoot
+	out, err := cmd.CombinedOutput()
+	require.NoError(tb, err, "Setup: could not build %s: %s", args[len(args)-1], out)
+}
+
+// cc returns the C compiler to use.
+func cc() string {
+	if cc := os.Getenv("CC"); cc != "" {
+		return cc
+	}
+	return "cc"
+}
+
+// writePAMService writes in confDir the PAM service of the benchmarks, loading module through loader with the
+// loaderOptions, and connecting to the daemon on socketPath.
+func writePAMService(b *testing.B, confDir, loader, module, socketPath string, loaderOptions ...string) {
+	b.Helper()
+
+	moduleLine := strings.Join(append(append([]string{loader}, loaderOptions...), module, "socket="+socketPath), " ")
+	service := fmt.Sprintf(`auth required %s
+account optional %s
+account required pam_permit.so
+`, moduleLine, moduleLine)
+
+	err := os.WriteFile(filepath.Join(confDir, pamServiceName), []byte(service), 0600)
+	require.NoError(b, err, "Setup: could not write PAM service")
+}
+
+// runDaemon runs daemonPath with an empty cache and returns the socket it listens on.
+func runDaemon(b *testing.B, daemonPath string) (socketPath string) {
+	b.Helper()
+
+	// Socket name has a maximum size, so we can't use b.TempDir() directly.
+	tempDir, err := os.MkdirTemp("", "authd-pam-bench")
+	require.NoError(b, err, "Setup: failed to create socket dir for benchmarks")
+	b.Cleanup(func() { os.RemoveAll(tempDir) })
+
+	socketPath = filepath.Join(tempDir, "authd.socket")
+	config := fmt.Sprintf(`
+verbosity: 0
+paths:
+  cache: %s
+  socket: %s
+`, filepath.Join(tempDir, "cache"), socketPath)
+
+	configPath := filepath.Join(tempDir, "testconfig.yaml")
+	require.NoError(b, os.WriteFile(configPath, []byte(config), 0600), "Setup: failed to create config file for benchmarks")
+
+	// #nosec:G204 - we control the command arguments in tests
+	cmd := exec.Command(daemonPath, "-c", configPath)
+	cmd.Stderr = os.Stderr
+	cmd.Env = testutils.AppendCovEnv(os.Environ())
+	require.NoError(b, cmd.Start(), "Setup: daemon should start with no error")
+	b.Cleanup(func() {
+		// The daemon can trigger some background tasks so, in order to stop it gracefully, we need to send either
+		// SIGTERM or SIGINT to tell it that it's time to cleanup and stop.
+		require.NoError(b, cmd.Process.Signal(syscall.SIGTERM), "Teardown: Failed to send signal to stop daemon")
+		require.NoError(b, cmd.Wait(), "Teardown: daemon should stop with no error")
+	})
+
+	// The example broker takes some time to be exported on the bus.
+	for start := time.Now(); time.Since(start) < 10*time.Second; time.Sleep(100 * time.Millisecond) {
+		if _, err := os.Stat(socketPath); err == nil {
+			break
+		}
+	}
+	time.Sleep(time.Second)
+
+	return socketPath
+}
+
+// openPty returns a new pseudo-terminal pair, with a fixed window size so that the module UI is fully rendered.
+func openPty() (pty, tty *os.File, err error) {
+	pty, err = os.OpenFile("/dev/ptmx", os.O_RDWR|unix.O_NOCTTY|unix.O_CLOEXEC, 0)
+	if err != nil {
+		return nil, nil, fmt.Errorf("could not open pseudo-terminal: %w", err)
+	}
+	defer func() {
+		if err != nil {
+			pty.Close()
+		}
+	}()
+
+	fd := int(pty.Fd())
+	if err := unix.IoctlSetPointerInt(fd, unix.TIOCSPTLCK, 0); err != nil {
+		return nil, nil, fmt.Errorf("could not unlock pseudo-terminal: %w", err)
+	}
+	n, err := unix.IoctlGetInt(fd, unix.TIOCGPTN)
+	if err != nil {
+		return nil, nil, fmt.Errorf("could not get pseudo-terminal number: %w", err)
+	}
+
+	tty, err = os.OpenFile(fmt.Sprintf("/dev/pts/%d", n), os.O_RDWR|unix.O_NOCTTY, 0)
+	if err != nil {
+		return nil, nil, fmt.Errorf("could not open pseudo-terminal: %w", err)
+	}
+	if err := unix.IoctlSetWinsize(int(tty.Fd()), unix.TIOCSWINSZ, &unix.Winsize{Row: 40, Col: 120}); err != nil {
+		tty.Close()
+		return nil, nil, fmt.Errorf("could not set pseudo-terminal size: %w", err)
+	}
+
+	return pty, tty, nil
+}
+
+func getProjectRoot() string {
+	// Gets the path to the integration-tests.
+	_, p, _, _ := runtime.Caller(0)
+	l := strings.Split(filepath.Dir(p), "/")
+
+	// Walk up the tree to get the path of the project root
+	return "/" + filepath.Join(l[:len(l)-2]...)
+}
@@ -0,0 +1,66 @@
+package pam_test
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/msteinert/pam/v2"
+	"github.com/stretchr/testify/require"
+)
+
+func TestGoLoaderAcrossHandles(t *testing.T) {
+	t.Parallel()
+
+	tests := map[string]struct {
+		loaderOptions string
+
+		wantInits    string
+		wantCleanups string
+	}{
+		"Module is loaded again for each handle by default": {wantInits: "2", wantCleanups: "1"},
+		"Module stays loaded and initialized across handles with keep-loaded": {
+			loaderOptions: "keep-loaded",
+			wantInits:     "1",
+			wantCleanups:  "0",
+		},
+	}
+	for name, tc := range tests {
+		tc := tc
+		t.Run(name, func(t *testing.T) {
+			t.Parallel()
+
+			// The handles are started in the test process, where the loader and the module are never unloaded: each
+			// test case uses its own copies, so that they don't share their state.
+			dir := t.TempDir()
+			loader := filepath.Join(dir, "pam_go_loader.so")
+			module := filepath.Join(dir, "pam_counting.so")
+			projectRoot := getProjectRoot()
+			runBuildCommand(t, projectRoot, loaderBuildCommand(loader, dir))
+			// Like go modules, the counting module can't be unloaded.
+			runBuildCommand(t, projectRoot, []string{cc(), "-o", module,
+				"pam/integration-tests/testdata/counting_module.c", "-shared", "-fPIC", "-Wl,-z,nodelete", "-lpam"})
+
+			confDir := t.TempDir()
+			service := fmt.Sprintf("auth required %s %s %s\n", loader, tc.loaderOptions, module)
+			err := os.WriteFile(filepath.Join(confDir, pamServiceName), []byte(service), 0600)
+			require.NoError(t, err, "Setup: could not write PAM service")
+
+			var inits, cleanups string
+			for i := 0; i < 2; i++ {
+				tx, err := pam.StartConfDir(pamServiceName, "user1", pam.ConversationFunc(
+					func(style pam.Style, msg string) (string, error) {
+						return "", fmt.Errorf("unexpected conversation: %s", msg)
+					}), confDir)
+				require.NoError(t, err, "Setup: could not start PAM transaction")
+				require.NoError(t, tx.Authenticate(pam.Silent), "Authenticate should not return an error")
+				inits, cleanups = tx.GetEnv("COUNTING_MODULE_INITS"), tx.GetEnv("COUNTING_MODULE_CLEANUPS")
+				require.NoError(t, tx.End(), "Teardown: could not end PAM transaction")
+			}
+
+			require.Equal(t, tc.wantInits, inits, "Module should have been initialized the expected times")
+			require.Equal(t, tc.wantCleanups, cleanups, "Module should have been cleaned up the expected times")
+		})
+	}
+}
@@ -0,0 +1,306 @@
+package pam_test
+
+import (
+	"bytes"
+	"context"
+	"errors"
+	"flag"
+	"fmt"
+	"io"
+	"os"
+	"os/exec"
+	"regexp"
+	"sort"
+	"strconv"
+	"sync"
+	"syscall"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+)
+
+var (
+	benchConcurrency      = flag.Int("pam-bench-concurrency", 8, "number of concurrent logins of the PAM benchmarks")
+	benchLoginsPerProcess = flag.Int("pam-bench-logins-per-process", 0, "number of sequential logins run by each PAM application process, 0 for all the logins of a worker")
+)
+
+const (
+	// exampleBrokerChoice is the key selecting the example broker in the broker list, after the local one.
+	exampleBrokerChoice = "2"
+	// examplePassword is the password accepted by the example broker.
+	examplePassword = "goodpass"
+
+	// loginTimeout is the time after which a login is considered stuck.
+	loginTimeout = 30 * time.Second
+
+	// maxEventLength is the maximum length of the PAM application output matching an event.
+	maxEventLength = 4096
+)
+
+// benchUsers are the example broker users logging in during the benchmarks. The logins are spread over them.
+var benchUsers = []string{"user1", "user2"}
+
+// loaderModes are the go-loader configurations the benchmarks compare.
+var loaderModes = []struct {
+	name    string
+	options []string
+}{
+	// The module is loaded for each PAM handle, as it's done by default.
+	{name: "one-shot"},
+	// The module is loaded once per PAM application process.
+	{name: "keep-loaded", options: []string{"keep-loaded"}},
+}
+
+// benchEvents are the parts of the PAM application terminal output the harness reacts to: the timing reports of the
+// application, the broker selection list and the password prompt of the example broker.
+var benchEvents = regexp.MustCompile(`AUTHD-BENCH (start|end) ([^\r\n]*)\r?\n|Select your provider|Gimme your password`)
+
+// loginTimings are the timings of a login.
+type loginTimings struct {
+	moduleLoad  time.Duration
+	firstPrompt time.Duration
+	total       time.Duration
+}
+
+// BenchmarkLoginStorm runs concurrent full authentication transactions through the go-loader and the authd module,
+// against a daemon using the example broker. It reports the module load time, the time to the first prompt and the
+// total login time.
+//
+// The module is driven through a pseudo-terminal per PAM application, as it interacts with the user on the terminal.
+// Use -pam-bench-logins-per-process=1 for a new process per login, as sshd or su do.
+func BenchmarkLoginStorm(b *testing.B) {
+	if os.Geteuid() != 0 {
+		// The example broker users are members of local groups, which the daemon adds them to.
+		b.Skip("PAM login benchmarks need to run as root")
+	}
+
+	dir := b.TempDir()
+	daemon, module, loader, client := buildArtifacts(b, dir)
+	socketPath := runDaemon(b, daemon)
+
+	// The first login of each user selects the example broker, the next ones automatically use it.
+	warmupConfDir := b.TempDir()
+	writePAMService(b, warmupConfDir, loader, module, socketPath)
+	for _, user := range benchUsers {
+		_, err := runLogins(client, warmupConfDir, user, 1, true)
+		require.NoError(b, err, "Setup: warm-up login of %q should succeed", user)
+	}
+
+	for _, mode := range loaderModes {
+		b.Run("loader="+mode.name, func(b *testing.B) {
+			confDir := b.TempDir()
+			writePAMService(b, confDir, loader, module, socketPath, mode.options...)
+
+			b.ResetTimer()
+			timings, err := loginStorm(client, confDir, b.N, *benchConcurrency, *benchLoginsPerProcess)
+			b.StopTimer()
+			require.NoError(b, err, "All logins should succeed")
+
+			reportTimings(b, timings)
+		})
+	}
+}
+
+// loginStorm runs n logins from concurrency workers, each running its logins in PAM application processes of
+// perProcess logins, or of all its logins if perProcess is 0.
+func loginStorm(client, confDir string, n, concurrency, perProcess int) (timings []loginTimings, err error) {
+	var mu sync.Mutex
+	var wg sync.WaitGroup
+	for w := 0; w < concurrency; w++ {
+		workerLogins := n / concurrency
+		if w < n%concurrency {
+			workerLogins++
+		}
+		user := benchUsers[w%len(benchUsers)]
+
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for workerLogins > 0 {
+				k := workerLogins
+				if perProcess > 0 {
+					k = min(k, perProcess)
+				}
+				workerLogins -= k
+
+				t, loginsErr := runLogins(client, confDir, user, k, false)
+				mu.Lock()
+				timings = append(timings, t...)
+				err = errors.Join(err, loginsErr)
+				mu.Unlock()
+				if loginsErr != nil {
+					return
+				}
+			}
+		}()
+	}
+	wg.Wait()
+
+	return timings, err
+}
+
+// runLogins runs n sequential logins of user from a single PAM application process on its own pseudo-terminal,
+// selecting the example broker when asked to if selectBroker is true.
+func runLogins(client, confDir, user string, n int, selectBroker bool) (timings []loginTimings, err error) {
+	pty, tty, err := openPty()
+	if err != nil {
+		return nil, err
+	}
+	defer pty.Close()
+
+	ctx, cancel := context.WithTimeout(context.Background(), time.Duration(n)*loginTimeout)
+	defer cancel()
+
+	// #nosec:G204 - we control the command arguments in tests
+	cmd := exec.CommandContext(ctx, client, "-confdir", confDir, "-service", pamServiceName, "-user", user,
+		"-transactions", strconv.Itoa(n))
+	cmd.Env = append(os.Environ(), "TERM=xterm-256color")
+	cmd.Stdin, cmd.Stdout, cmd.Stderr = tty, tty, tty
+	cmd.SysProcAttr = &syscall.SysProcAttr{Setsid: true, Setctty: true}
+	err = cmd.Start()
+	tty.Close()
+	if err != nil {
+		return nil, fmt.Errorf("could not start PAM application: %w", err)
+	}
+
+	timings, err = driveLogins(pty, selectBroker)
+	// Stop reading the application output on error: it's hung up and won't block on it.
+	if err != nil {
+		pty.Close()
+	}
+	if waitErr := cmd.Wait(); waitErr != nil {
+		err = errors.Join(err, fmt.Errorf("PAM application failed: %w", waitErr))
+	}
+	if err == nil && len(timings) != n {
+		err = fmt.Errorf("PAM application ran %d logins out of %d", len(timings), n)
+	}
+	return timings, err
+}
+
+// driveLogins plays the user on the pseudo-terminal of a PAM application, until its output ends.
+func driveLogins(pty *os.File, selectBroker bool) (timings []loginTimings, err error) {
+	var out []byte
+	var start, promptAt time.Time
+	var prompted, brokerSelected bool
+
+	buf := make([]byte, 32*1024)
+	for {
+		n, readErr := pty.Read(buf)
+		now := time.Now()
+		out = append(out, buf[:n]...)
+
+		for {
+			loc := benchEvents.FindSubmatchIndex(out)
+			if loc == nil {
+				// Only keep what could be the beginning of an event, not the whole UI rendering.
+				out = out[max(0, len(out)-maxEventLength):]
+				break
+			}
+			event := out[loc[0]:loc[1]]
+			var args []byte
+			if loc[4] >= 0 {
+				event = out[loc[2]:loc[3]]
+				args = out[loc[4]:loc[5]]
+			}
+
+			switch {
+			case bytes.Equal(event, []byte("start")):
+				ns, _ := strconv.ParseInt(string(args), 10, 64)
+				start = time.Unix(0, ns)
+				prompted, brokerSelected, promptAt = false, false, time.Time{}
+
+			case bytes.Equal(event, []byte("end")):
+				t, endErr := parseEnd(args, start, promptAt)
+				if endErr != nil {
+					return timings, endErr
+				}
+				timings = append(timings, t)
+
+			case bytes.Equal(event, []byte("Select your provider")):
+				if selectBroker && !brokerSelected {
+					brokerSelected = true
+					if _, err := pty.WriteString(exampleBrokerChoice); err != nil {
+						return timings, err
+					}
+				}
+
+			default:
+				// The prompt is rendered again on each key press.
+				if prompted {
+					break
+				}
+				prompted, promptAt = true, now
+				if _, err := pty.WriteString(examplePassword + "\r"); err != nil {
+					return timings, err
+				}
+			}
+			out = out[loc[1]:]
+		}
+
+		// Reading the pseudo-terminal fails with EIO once the application has exited.
+		if readErr != nil {
+			if errors.Is(readErr, io.EOF) || errors.Is(readErr, syscall.EIO) {
+				return timings, nil
+			}
+			return timings, readErr
+		}
+	}
+}
+
+// parseEnd returns the timings of a login from the arguments of its end report.
+func parseEnd(args []byte, start, promptAt time.Time) (t loginTimings, err error) {
+	fields := bytes.SplitN(args, []byte(" "), 3)
+	if len(fields) < 2 {
+		return t, fmt.Errorf("invalid end report %q", args)
+	}
+	if len(fields) == 3 && len(bytes.TrimSpace(fields[2])) > 0 {
+		return t, fmt.Errorf("login failed: %s", fields[2])
+	}
+
+	endNs, err := strconv.ParseInt(string(fields[0]), 10, 64)
+	if err != nil {
+		return t, fmt.Errorf("invalid end time %q: %w", fields[0], err)
+	}
+	loadUs, err := strconv.ParseInt(string(fields[1]), 10, 64)
+	if err != nil {
+		return t, fmt.Errorf("invalid module load time %q: %w", fields[1], err)
+	}
+
+	return loginTimings{
+		moduleLoad:  time.Duration(loadUs) * time.Microsecond,
+		firstPrompt: promptAt.Sub(start),
+		total:       time.Unix(0, endNs).Sub(start),
+	}, nil
+}
+
+// reportTimings reports the median and 99th percentile of the timings of the logins.
+func reportTimings(b *testing.B, timings []loginTimings) {
+	b.Helper()
+
+	for _, m := range []struct {
+		name string
+		get  func(loginTimings) time.Duration
+	}{
+		{"module-load", func(t loginTimings) time.Duration { return t.moduleLoad }},
+		{"first-prompt", func(t loginTimings) time.Duration { return t.firstPrompt }},
+		{"login", func(t loginTimings) time.Duration { return t.total }},
+	} {
+		durations := make([]time.Duration, 0, len(timings))
+		for _, t := range timings {
+			durations = append(durations, m.get(t))
+		}
+		sort.Slice(durations, func(i, j int) bool { return durations[i] < durations[j] })
+
+		b.ReportMetric(quantile(durations, 0.50).Seconds()*1000, m.name+"-p50-ms")
+		b.ReportMetric(quantile(durations, 0.99).Seconds()*1000, m.name+"-p99-ms")
+	}
+}
+
+// quantile returns the q quantile of the sorted durations.
+func quantile(sorted []time.Duration, q float64) time.Duration {
+	if len(sorted) == 0 {
+		return 0
+	}
+	return sorted[int(q*float64(len(sorted)-1))]
+}
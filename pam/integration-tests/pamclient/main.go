@@ -0,0 +1,72 @@
+// Package main is a minimal PAM application for the login benchmarks. It runs sequential authentication
+// transactions with a service configured in a custom directory and reports their timings to the benchmark harness.
+//
+// The terminal of the application is the one the authd module interacts with. The timings are written on it too, so
+// that the harness gets them in order with the module output, one line per event:
+//   - "AUTHD-BENCH start <unix time in ns>" when a transaction starts;
+//   - "AUTHD-BENCH end <unix time in ns> <module load time in µs> <error>" when it's done, the error being empty on
+//     success.
+package main
+
+import (
+	"flag"
+	"fmt"
+	"strconv"
+	"strings"
+	"time"
+
+	"github.com/msteinert/pam/v2"
+)
+
+// loadTimeEnv is the PAM environment variable in which the loader reports the module load time, when built for
+// benchmarks.
+const loadTimeEnv = "AUTHD_PAM_GO_LOADER_LOAD_TIME_US"
+
+var (
+	confDir      = flag.String("confdir", "", "directory of the PAM service configuration")
+	service      = flag.String("service", "authd-bench", "name of the PAM service")
+	user         = flag.String("user", "user1", "user to authenticate")
+	transactions = flag.Int("transactions", 1, "number of sequential authentication transactions")
+)
+
+func main() {
+	flag.Parse()
+
+	for i := 0; i < *transactions; i++ {
+		fmt.Printf("\nAUTHD-BENCH start %d\n", time.Now().UnixNano())
+		loadTime, err := login()
+		var errMsg string
+		if err != nil {
+			errMsg = strings.ReplaceAll(err.Error(), "\n", " ")
+		}
+		fmt.Printf("\nAUTHD-BENCH end %d %d %s\n", time.Now().UnixNano(), loadTime, errMsg)
+	}
+}
+
+// login runs a full authentication transaction, returning the module load time reported by the loader.
+func login() (loadTime int64, err error) {
+	tx, err := pam.StartConfDir(*service, *user, pam.ConversationFunc(
+		func(style pam.Style, msg string) (string, error) {
+			switch style {
+			case pam.TextInfo, pam.ErrorMsg:
+				return "", nil
+			default:
+				return "", fmt.Errorf("pam style %d not supported by the benchmarks", style)
+			}
+		}), *confDir)
+	if err != nil {
+		return 0, fmt.Errorf("could not start transaction: %w", err)
+	}
+	defer func() { _ = tx.End() }()
+
+	if err := tx.Authenticate(pam.Silent); err != nil {
+		return 0, fmt.Errorf("authentication failed: %w", err)
+	}
+	// The loader reports the time only once per handle, when the module is loaded for the first stage.
+	loadTime, _ = strconv.ParseInt(tx.GetEnv(loadTimeEnv), 10, 64)
+
+	if err := tx.AcctMgmt(pam.Silent); err != nil {
+		return loadTime, fmt.Errorf("account management failed: %w", err)
+	}
+	return loadTime, nil
+}
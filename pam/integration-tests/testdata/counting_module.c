@@ -0,0 +1,54 @@
+/* A PAM module exposing the go-loader entry points, which reports how many
+ * times it has been initialized and cleaned up in the PAM environment, so that
+ * tests can check how the loader manages the modules it loads.
+ *
+ * Like go modules, it must be linked with -z nodelete, so that its counters
+ * survive being unloaded.
+ */
+
+#include <security/pam_modules.h>
+#include <security/pam_ext.h>
+#include <stdio.h>
+
+static int inits;
+static int cleanups;
+
+void
+go_pam_init_module (void)
+{
+  inits++;
+}
+
+void
+go_pam_cleanup_module (void)
+{
+  cleanups++;
+}
+
+PAM_EXTERN int
+pam_sm_authenticate (pam_handle_t *pamh,
+                     int           flags,
+                     int           argc,
+                     const char  **argv)
+{
+  char env[64];
+
+  snprintf (env, sizeof (env), "COUNTING_MODULE_INITS=%d", inits);
+  if (pam_putenv (pamh, env) != PAM_SUCCESS)
+    return PAM_BUF_ERR;
+
+  snprintf (env, sizeof (env), "COUNTING_MODULE_CLEANUPS=%d", cleanups);
+  if (pam_putenv (pamh, env) != PAM_SUCCESS)
+    return PAM_BUF_ERR;
+
+  return PAM_SUCCESS;
+}
+
+PAM_EXTERN int
+pam_sm_setcred (pam_handle_t *pamh,
+                int           flags,
+                int           argc,
+                const char  **argv)
+{
+  return PAM_SUCCESS;
+}
@@ -69,6 +69,16 @@ type SessionStarted struct {
 	encryptionKey string
 }
 
+// authenticationBegun signals that we started a session with a given broker, and that its first authentication
+// mode has been selected, in a single call.
+type authenticationBegun struct {
+	SessionStarted
+
+	authModes  []*authd.GAMResponse_AuthenticationMode
+	authModeID string
+	layout     *authd.UILayout
+}
+
 // GetAuthenticationModesRequested signals that a model needs to get the broker authentication modes.
 type GetAuthenticationModesRequested struct{}
 
@@ -157,7 +167,7 @@ func (m *model) Update(msg tea.Msg) (tea.Model, tea.Cmd) {
 		// Got user and brokers? Time to auto or manually select.
 		return m, tea.Sequence(
 			m.changeStage(stageBrokerSelection),
-			AutoSelectForUser(m.client, m.username()))
+			AutoSelectForUser(m.client, m.username(), m.authModeSelectionModel.SupportedUILayouts()))
 
 	case BrokerSelected:
 		return m, startBrokerSession(m.client, msg.BrokerID, m.username())
@@ -170,6 +180,20 @@ func (m *model) Update(msg tea.Msg) (tea.Model, tea.Cmd) {
 		}
 		return m, sendEvent(GetAuthenticationModesRequested{})
 
+	case authenticationBegun:
+		m.currentSession = &sessionInfo{
+			brokerID:      msg.brokerID,
+			sessionID:     msg.sessionID,
+			encryptionKey: msg.encryptionKey,
+		}
+		// Synchronise the previous steps with what was selected, in case we go back to them.
+		m.brokerSelectionModel.selectItem(msg.brokerID)
+		cmd := m.authModeSelectionModel.setAuthModes(msg.authModes)
+		m.authModeSelectionModel.currentAuthModeSelectedID = msg.authModeID
+		m.authModeSelectionModel.selectItem(msg.authModeID)
+
+		return m, tea.Sequence(cmd, sendEvent(UILayoutReceived{layout: msg.layout}))
+
 	case GetAuthenticationModesRequested:
 		if m.currentSession == nil || !m.authModeSelectionModel.IsReady() {
 			return m, nil
@@ -10,6 +10,8 @@ import (
 	"os"
 	"runtime"
 	"strings"
+	"sync"
+	"sync/atomic"
 
 	tea "github.com/charmbracelet/bubbletea"
 	"github.com/msteinert/pam/v2"
@@ -26,6 +28,19 @@ import (
 type pamModule struct {
 }
 
+var (
+	// clientConns are the connections to authd, indexed by socket path, that
+	// are shared by all the PAM stages using this module instance.
+	// They are closed when the module is cleaned up.
+	clientConns   = make(map[string]*grpc.ClientConn)
+	clientConnsMu sync.Mutex
+
+	// shareClientConns is set when the module is loaded by the go-loader, which
+	// tells us when the module is cleaned up. Otherwise, nothing would close the
+	// shared connections, so each stage uses its own connection.
+	shareClientConns atomic.Bool
+)
+
 const (
 	// authenticationBrokerIDKey is the Key used to store the data in the
 	// PAM module for the second stage authentication to select the default
@@ -78,9 +93,15 @@ func (h *pamModule) Authenticate(mTx pam.ModuleTransaction, flags pam.Flags, arg
 	}
 	defer closeConn()
 
+	// The user may be set later in the UI, in which case only the broker list is prefetched.
+	pamUser, err := mTx.GetItem(pam.User)
+	if err != nil {
+		return err
+	}
+
 	appState := model{
 		pamMTx:              mTx,
-		client:              client,
+		client:              newPrefetchingClient(client, pamUser),
 		interactiveTerminal: interactiveTerminal,
 	}
 
@@ -173,15 +194,75 @@ func (h *pamModule) AcctMgmt(mTx pam.ModuleTransaction, flags pam.Flags, args []
 	return nil
 }
 
-// newClient returns a new GRPC client ready to emit requests.
-func newClient(args []string) (client authd.PAMClient, close func(), err error) {
-	conn, err := grpc.Dial("unix://"+getSocketPath(args), grpc.WithTransportCredentials(insecure.NewCredentials()))
+// newClient returns a GRPC client ready to emit requests, and the function to call once the stage is done with it.
+// When the module is loaded by the go-loader, the underlying connection is shared with the other PAM stages and is
+// only closed on module cleanup. Otherwise, the stage has its own connection, closed by the returned function.
+func newClient(args []string) (client authd.PAMClient, closeConn func(), err error) {
+	socketPath := getSocketPath(args)
+
+	if shareClientConns.Load() {
+		conn, err := clientConn(socketPath)
+		if err != nil {
+			return nil, nil, err
+		}
+		return authd.NewPAMClient(conn), func() {}, nil
+	}
+
+	conn, err := dialAuthd(socketPath)
 	if err != nil {
-		return nil, nil, fmt.Errorf("could not connect to authd: %v", err)
+		return nil, nil, err
 	}
 	return authd.NewPAMClient(conn), func() { conn.Close() }, nil
 }
 
+// clientConn returns the shared connection to authd for socketPath, creating it if needed.
+func clientConn(socketPath string) (*grpc.ClientConn, error) {
+	clientConnsMu.Lock()
+	defer clientConnsMu.Unlock()
+
+	if conn, ok := clientConns[socketPath]; ok {
+		return conn, nil
+	}
+
+	conn, err := dialAuthd(socketPath)
+	if err != nil {
+		return nil, err
+	}
+	clientConns[socketPath] = conn
+	return conn, nil
+}
+
+// dialAuthd returns a new connection to authd on socketPath.
+func dialAuthd(socketPath string) (*grpc.ClientConn, error) {
+	conn, err := grpc.Dial("unix://"+socketPath, grpc.WithTransportCredentials(insecure.NewCredentials()))
+	if err != nil {
+		return nil, fmt.Errorf("could not connect to authd: %v", err)
+	}
+	return conn, nil
+}
+
+// preconnect starts connecting in the background to authd on socketPath, so that the connection is ready by the
+// time the first PAM stage is called.
+func preconnect(socketPath string) {
+	conn, err := clientConn(socketPath)
+	if err != nil {
+		log.Debugf(context.TODO(), "Could not preconnect to authd: %v", err)
+		return
+	}
+	conn.Connect()
+}
+
+// closeClientConnections closes all the connections to authd.
+func closeClientConnections() {
+	clientConnsMu.Lock()
+	defer clientConnsMu.Unlock()
+
+	for socketPath, conn := range clientConns {
+		conn.Close()
+		delete(clientConns, socketPath)
+	}
+}
+
 // getSocketPath returns the socket path to connect to which can be overridden manually.
 func getSocketPath(args []string) string {
 	socketPath := consts.DefaultSocketPath
@@ -216,9 +297,21 @@ func (h *pamModule) CloseSession(pam.ModuleTransaction, pam.Flags, []string) err
 	return pam.ErrIgnore
 }
 
+// go_pam_init_module is called by the go-loader PAM module when the module is loaded.
+//
+// The socket path passed as module argument is only known once a PAM stage is called, so we only preconnect to
+// the default one here.
+//
+//export go_pam_init_module
+func go_pam_init_module() {
+	shareClientConns.Store(true)
+	preconnect(consts.DefaultSocketPath)
+}
+
 // go_pam_cleanup_module is called by the go-loader PAM module during onload.
 //
 //export go_pam_cleanup_module
 func go_pam_cleanup_module() {
+	closeClientConnections()
 	runtime.GC()
 }
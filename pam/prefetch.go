@@ -0,0 +1,99 @@
+package main
+
+import (
+	"context"
+	"sync"
+
+	"github.com/ubuntu/authd"
+	"google.golang.org/grpc"
+)
+
+// prefetchingClient is an authd PAM client which requests the broker list, and the previous broker of the user
+// when it's already known, as soon as it's created. The first calls to AvailableBrokers and GetPreviousBroker are
+// served with those replies, so that the UI does not wait for a round trip to authd before its first frame.
+// Any other call is forwarded to authd.
+type prefetchingClient struct {
+	authd.PAMClient
+
+	mu             sync.Mutex
+	brokers        *prefetchedReply[*authd.ABResponse]
+	username       string
+	previousBroker *prefetchedReply[*authd.GPBResponse]
+}
+
+// prefetchedReply is the reply of a request running in the background.
+type prefetchedReply[T any] struct {
+	done  chan struct{}
+	reply T
+	err   error
+}
+
+// newPrefetchingClient wraps client and starts the prefetching requests in parallel.
+// username is the PAM user, and can be empty if it's not known yet.
+func newPrefetchingClient(client authd.PAMClient, username string) *prefetchingClient {
+	c := &prefetchingClient{
+		PAMClient: client,
+		brokers: prefetch(func() (*authd.ABResponse, error) {
+			return client.AvailableBrokers(context.Background(), &authd.Empty{})
+		}),
+	}
+
+	if username != "" {
+		c.username = username
+		c.previousBroker = prefetch(func() (*authd.GPBResponse, error) {
+			return client.GetPreviousBroker(context.Background(), &authd.GPBRequest{Username: username})
+		})
+	}
+
+	return c
+}
+
+// prefetch runs request in the background.
+func prefetch[T any](request func() (T, error)) *prefetchedReply[T] {
+	p := &prefetchedReply[T]{done: make(chan struct{})}
+	go func() {
+		defer close(p.done)
+		p.reply, p.err = request()
+	}()
+	return p
+}
+
+// wait returns the prefetched reply, once available.
+func (p *prefetchedReply[T]) wait(ctx context.Context) (reply T, err error) {
+	select {
+	case <-p.done:
+		return p.reply, p.err
+	case <-ctx.Done():
+		return reply, ctx.Err()
+	}
+}
+
+// AvailableBrokers returns the prefetched broker list on first call, and requests it from authd afterwards.
+func (c *prefetchingClient) AvailableBrokers(ctx context.Context, in *authd.Empty, opts ...grpc.CallOption) (*authd.ABResponse, error) {
+	c.mu.Lock()
+	p := c.brokers
+	c.brokers = nil
+	c.mu.Unlock()
+
+	if p == nil {
+		return c.PAMClient.AvailableBrokers(ctx, in, opts...)
+	}
+	return p.wait(ctx)
+}
+
+// GetPreviousBroker returns the prefetched previous broker on first call for the prefetched user, and requests it
+// from authd otherwise.
+func (c *prefetchingClient) GetPreviousBroker(ctx context.Context, in *authd.GPBRequest, opts ...grpc.CallOption) (*authd.GPBResponse, error) {
+	c.mu.Lock()
+	var p *prefetchedReply[*authd.GPBResponse]
+	if in.GetUsername() == c.username {
+		p = c.previousBroker
+		c.previousBroker = nil
+	}
+	c.mu.Unlock()
+
+	if p == nil {
+		return c.PAMClient.GetPreviousBroker(ctx, in, opts...)
+	}
+	return p.wait(ctx)
+}